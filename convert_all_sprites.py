@@ -5,6 +5,7 @@ Complete PNG to RGB565 Converter for all remaining sprites
 
 from PIL import Image
 import os
+from convert_sprite import c565
 
 def rgb888_to_rgb565(r, g, b):
     """Convert RGB888 to RGB565"""
@@ -44,7 +45,7 @@ def png_to_rgb565_array(png_path, var_name, target_size=None, crop_box=None):
     
     for i in range(0, len(pixels), 16):
         line = pixels[i:i+16]
-        output += "  " + ", ".join(f"0x{p:04X}" for p in line)
+        output += "  " + ", ".join(c565(p) for p in line)
         if i + 16 < len(pixels):
             output += ","
         output += "\n"
@@ -72,7 +73,7 @@ def main():
         img = Image.open(particle_path)
         # Assuming grid layout: top-left crumb, top-right heart, middle ZZZ, bottom-left/right dirt
         
-        particles_output = "#pragma once\n#include <Arduino.h>\n\n"
+        particles_output = "#pragma once\n#include <Arduino.h>\n#include \"../sprite_common.h\"\n\n"
         particles_output += "// Particle sprites - 8x8\n\n"
         
         # Food Crumb (top-left quadrant)
@@ -116,7 +117,7 @@ def main():
         array, w, h = png_to_rgb565_array(kelp_path, "kelpBitmap", target_size=(16, 32))
         
         with open(os.path.join(output_dir, "kelp.h"), "w") as f:
-            f.write("#pragma once\n#include <Arduino.h>\n\n")
+            f.write("#pragma once\n#include <Arduino.h>\n#include \"../sprite_common.h\"\n\n")
             f.write("// Kelp/Seaweed - 16x32\n")
             f.write(array)
         
@@ -133,7 +134,7 @@ def main():
         img = Image.open(coral_path)
         # 3x3 grid layout
         
-        corals_output = "#pragma once\n#include <Arduino.h>\n\n"
+        corals_output = "#pragma once\n#include <Arduino.h>\n#include \"../sprite_common.h\"\n\n"
         corals_output += "// Coral sprites from collection\n\n"
         
         # Brain Coral (top-left)
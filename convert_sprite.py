@@ -3,12 +3,18 @@
 from PIL import Image
 import sys
 import os
+import re
 
 def rgb888_to_rgb565(r, g, b):
     """Convert RGB888 to RGB565 format"""
     return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
-def png_to_rgb565_array(png_path, width, height, var_name, output_file=None):
+def c565(p):
+    """RGB565 literal in memory format: px565() (sprite_common.h) swaps the
+    bytes at compile time when WIRE_ORDER_PIXELS is set"""
+    return f"px565(0x{p:04X})"
+
+def png_to_rgb565_array(png_path, width, height, var_name, output_file=None, emit_spans=False):
     """Convert PNG to RGB565 C array for Arduino/Teensy"""
     
     if not os.path.exists(png_path):
@@ -19,8 +25,9 @@ def png_to_rgb565_array(png_path, width, height, var_name, output_file=None):
     img = img.resize((width, height), Image.NEAREST)
     
     output = []
+    pixels = []
     output.append(f"// Generated from: {os.path.basename(png_path)}")
-    output.append(f"// Dimensions: {width}x{height} pixels")
+    output.append(f"// Dimensions: {width}x{height} pixels (needs sprite_common.h for px565)")
     output.append(f"const uint16_t {var_name}[] PROGMEM = {{")
     
     for y in range(height):
@@ -29,10 +36,12 @@ def png_to_rgb565_array(png_path, width, height, var_name, output_file=None):
             r, g, b, a = img.getpixel((x, y))
             
             if a < 128:
-                row.append("0xF81F")
+                pixels.append(0xF81F)
+                row.append(c565(0xF81F))
             else:
                 rgb565 = rgb888_to_rgb565(r, g, b)
-                row.append(f"0x{rgb565:04X}")
+                pixels.append(rgb565)
+                row.append(c565(rgb565))
         
         line = "  " + ", ".join(row)
         if y < height - 1:
@@ -40,6 +49,10 @@ def png_to_rgb565_array(png_path, width, height, var_name, output_file=None):
         output.append(line)
     
     output.append("};")
+
+    if emit_spans:
+        output.append("")
+        output.append(spans_to_c(var_name, width, height, pixels))
     
     result = "\n".join(output)
     
@@ -52,12 +65,273 @@ def png_to_rgb565_array(png_path, width, height, var_name, output_file=None):
     
     return result
 
+TRANSPARENT = (0xF81F, 0x1FF8)
+
+def find_spans(pixels, width, height):
+    """Opaque runs per row: list of rows, each a list of (x, len, offset)"""
+    rows = []
+    for y in range(height):
+        row = []
+        x = 0
+        while x < width:
+            while x < width and pixels[y * width + x] in TRANSPARENT:
+                x += 1
+            start = x
+            while x < width and pixels[y * width + x] not in TRANSPARENT:
+                x += 1
+            if x > start:
+                row.append((start, x - start, y * width + start))
+        rows.append(row)
+    return rows
+
+def spans_to_c(var_name, width, height, pixels, indexed=False, trim=(0, 0, None)):
+    """Span table (start, length, pixel offset) + mirrored table for flipX.
+
+    Offsets index the sprite's pixel data (RGB565 array or palette indices),
+    the blitter copies runs straight from it without any transparency test.
+    trim = (ox, oy, full_width) of a cropped sprite (see trim_pixels).
+    """
+    rows = find_spans(pixels, width, height)
+    opaque = sum(1 for p in pixels if p not in TRANSPARENT)
+    total = sum(len(r) for r in rows)
+    if width > 255 or len(pixels) > 0xFFFF:
+        raise ValueError(f"{var_name}: sprite too large for SpriteSpan")
+
+    index = [0]
+    for r in rows:
+        index.append(index[-1] + len(r))
+
+    def fmt(spans):
+        return ", ".join(f"{{{x}, {n}, {o}}}" for x, n, o in spans)
+
+    bitmap = "nullptr" if indexed else var_name
+    idx = f"&{var_name}Idx" if indexed else "nullptr"
+    ox, oy, full_width = trim
+
+    out = []
+    out.append(f"// {var_name}: {width}x{height}, {opaque}/{width * height} opaque px, {total} spans")
+    out.append(f"const uint16_t {var_name}_rows[] PROGMEM = {{")
+    out.append("  " + ", ".join(str(i) for i in index))
+    out.append("};")
+    out.append(f"const SpriteSpan {var_name}_spans[] PROGMEM = {{")
+    out.extend(f"  {fmt(r)}," for r in rows if r)
+    out.append("};")
+    out.append(f"const SpriteSpan {var_name}_spansFlip[] PROGMEM = {{")
+    out.extend(f"  {fmt([(width - x - n, n, o) for x, n, o in reversed(r)])}," for r in rows if r)
+    out.append("};")
+    out.append(f"const SpriteSpanTable {var_name}Spans = {{")
+    out.append(f"  {bitmap}, {width}, {height}, {var_name}_rows, {var_name}_spans, {var_name}_spansFlip, {idx},")
+    out.append(f"  {ox}, {oy}, {full_width or width}")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+def build_palette(pixels):
+    """Palette in order of first use; index 0 is reserved for transparency"""
+    palette = [0xF81F]
+    lookup = {}
+    indices = []
+    for p in pixels:
+        if p in TRANSPARENT:
+            indices.append(0)
+            continue
+        if p not in lookup:
+            lookup[p] = len(palette)
+            palette.append(p)
+        indices.append(lookup[p])
+    return palette, indices
+
+def indexed_bits(pixels):
+    """4 or 8 bit indices, None if the sprite has more than 255 colours"""
+    colors = len(set(p for p in pixels if p not in TRANSPARENT))
+    if colors <= 15:
+        return 4
+    if colors <= 255:
+        return 8
+    return None
+
+def indexed_to_c(var_name, width, height, pixels, trim=(0, 0, None)):
+    """Palette + 4/8-bit index array + IndexedSprite descriptor"""
+    bits = indexed_bits(pixels)
+    palette, indices = build_palette(pixels)
+    if bits == 4:
+        if len(indices) % 2:
+            indices.append(0)
+        data = [(indices[i] << 4) | indices[i + 1] for i in range(0, len(indices), 2)]
+    else:
+        data = indices
+
+    per_line = 16
+    out = []
+    out.append(f"// {var_name}: {width}x{height}, {len(palette) - 1} colours, {bits}-bit "
+               f"({len(data) + 2 * len(palette)} B instead of {2 * width * height} B)")
+    out.append(f"const uint16_t {var_name}_pal[] PROGMEM = {{")
+    for i in range(0, len(palette), per_line):
+        out.append("  " + ", ".join(c565(p) for p in palette[i:i + per_line]) + ",")
+    out.append("};")
+    out.append(f"const uint8_t {var_name}_idx[] PROGMEM = {{")
+    for i in range(0, len(data), per_line):
+        out.append("  " + ", ".join(f"0x{d:02X}" for d in data[i:i + per_line]) + ",")
+    out.append("};")
+    out.append(f"const IndexedSprite {var_name}Idx = {{")
+    out.append(f"  {width}, {height}, {bits}, {var_name}_idx, {var_name}_pal, {trim[0]}, {trim[1]}")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+def trim_pixels(pixels, width, height):
+    """Crop to the opaque bounding box: (pixels, width, height, ox, oy).
+
+    ox/oy locate the crop inside the original frame, so all frames of an
+    animation keep the anchor of the uncropped sprite.
+    """
+    opaque = [i for i, p in enumerate(pixels) if p not in TRANSPARENT]
+    if not opaque:
+        return pixels, width, height, 0, 0
+    xs = [i % width for i in opaque]
+    ys = [i // width for i in opaque]
+    x0, x1, y0, y1 = min(xs), max(xs) + 1, min(ys), max(ys) + 1
+    cropped = [pixels[y * width + x] for y in range(y0, y1) for x in range(x0, x1)]
+    return cropped, x1 - x0, y1 - y0, x0, y0
+
+def rgb565_to_c(var_name, width, pixels):
+    """Plain RGB565 array (fallback for sprites with too many colours)"""
+    out = [f"const uint16_t {var_name}[] PROGMEM = {{"]
+    for i in range(0, len(pixels), width):
+        out.append("  " + ", ".join(c565(p) for p in pixels[i:i + width]) + ",")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+def parse_header_arrays(header_path):
+    """RGB565 arrays from an existing sprite header: [(name, width, pixels)]
+
+    The width comes from the closest preceding *_WIDTH constant or
+    '- WxH' dimension comment.
+    """
+    with open(header_path) as f:
+        text = f.read()
+
+    arrays = []
+    width = None
+    pattern = re.compile(
+        r"const\s+uint16_t\s+(\w+_WIDTH)\s*=\s*(\d+)"
+        r"|-\s*(\d+)x(\d+)"
+        r"|const\s+uint16_t\s+(\w+)\[\]\s*PROGMEM\s*=\s*\{([^}]*)\}")
+    for m in pattern.finditer(text):
+        if m.group(1):
+            width = int(m.group(2))
+        elif m.group(3):
+            width = int(m.group(3))
+        else:
+            values = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", m.group(6))]
+            arrays.append((m.group(5), width, values))
+    return arrays
+
+def parse_header_constants(header_path):
+    """Scalar dimension constants (FOO_WIDTH = 16, ...) in header order"""
+    with open(header_path) as f:
+        text = f.read()
+    return re.findall(r"const\s+uint16_t\s+(\w+)\s*=\s*(\d+)\s*;", text)
+
+def header_to_sprites(header_path, output_file=None, width_override=None, only=None,
+                      spans=True, indexed=False, trim=False):
+    """Generate a standalone sprite header from an existing RGB565 header.
+
+    spans:   add span tables for drawSpriteSpans()
+    indexed: store pixels as palette + 4/8-bit indices (RGB565 is kept for
+             sprites with more than 255 colours)
+    trim:    crop every sprite to its opaque bounding box; the blitters add
+             the stored ox/oy, the *_WIDTH/*_HEIGHT constants keep the
+             uncropped size
+    The result replaces the source header in the firmware; the source stays
+    as converter input.
+    """
+    base = os.path.splitext(os.path.basename(header_path))[0]
+    suffix = "spans" if spans else "indexed"
+    mode = " ".join(m for m, on in (("--spans", spans), ("--indexed", indexed), ("--trim", trim)) if on)
+
+    output = []
+    output.append("#pragma once")
+    output.append(f"// Generated by convert_sprite.py {mode} from {os.path.basename(header_path)}")
+    output.append(f"// (the source header is only converter input, include this one instead)")
+    output.append("#include <Arduino.h>")
+    output.append('#include "../sprite_common.h"')
+    output.append("")
+
+    constants = parse_header_constants(header_path)
+    for name, value in constants:
+        output.append(f"const uint16_t {name} = {value};")
+    if constants:
+        output.append("")
+
+    for name, width, pixels in parse_header_arrays(header_path):
+        if only and name not in only:
+            continue
+        if width_override:
+            width = width_override
+        if not width or len(pixels) % width:
+            print(f"Error: cannot determine width of '{name}' (use --width)")
+            sys.exit(1)
+        height = len(pixels) // width
+
+        trim_info = (0, 0, None)
+        if trim:
+            full_width, full_height = width, height
+            pixels, width, height, ox, oy = trim_pixels(pixels, width, height)
+            trim_info = (ox, oy, full_width)
+            if (width, height) != (full_width, full_height):
+                output.append(f"// {name}: trimmed {full_width}x{full_height} -> {width}x{height} at +{ox},+{oy}")
+
+        use_indexed = indexed and indexed_bits(pixels) is not None
+        if use_indexed:
+            output.append(indexed_to_c(name, width, height, pixels, trim_info))
+        else:
+            if indexed:
+                print(f"  {name}: more than 255 colours, kept as RGB565")
+            if trim and not spans:
+                print(f"  {name}: RGB565 without spans has no offset field, not trimmed")
+            output.append(rgb565_to_c(name, width, pixels))
+        if spans:
+            output.append(spans_to_c(name, width, height, pixels, use_indexed, trim_info))
+
+    result = "\n".join(output)
+    if output_file is None:
+        output_file = os.path.join(os.path.dirname(header_path), f"{base}_{suffix}.h")
+    with open(output_file, 'w') as f:
+        f.write(result)
+    print(f"✓ Sprite header written to: {output_file}")
+    return result
+
 def main():
-    if len(sys.argv) < 5:
-        print("Usage: python convert_sprite.py <input.png> <width> <height> <var_name> [output.txt]")
+    if len(sys.argv) >= 3 and sys.argv[1] in ("--spans", "--indexed", "--trim"):
+        # Standalone-Header (Span-Tabellen und/oder Palette) aus einem vorhandenen Sprite-Header
+        args = sys.argv[1:]
+        spans = "--spans" in args
+        indexed = "--indexed" in args
+        trim = "--trim" in args
+        args = [a for a in args if a not in ("--spans", "--indexed", "--trim")]
+        width = None
+        only = None
+        if "--width" in args:
+            i = args.index("--width")
+            width = int(args[i + 1])
+            del args[i:i + 2]
+        if "--only" in args:
+            i = args.index("--only")
+            only = args[i + 1].split(",")
+            del args[i:i + 2]
+        header_to_sprites(args[0], args[1] if len(args) > 1 else None, width, only, spans, indexed, trim)
+        return
+
+    emit_spans = "--with-spans" in sys.argv
+    argv = [a for a in sys.argv if a != "--with-spans"]
+
+    if len(argv) < 5:
+        print("Usage: python convert_sprite.py <input.png> <width> <height> <var_name> [output.txt] [--with-spans]")
+        print("       python convert_sprite.py [--spans] [--indexed] [--trim] <sprite_header.h> [output.h] [--width W] [--only a,b]")
         print("\nExample:")
         print("  python convert_sprite.py clownfish.png 30 25 clownfish_idle1")
         print("  python convert_sprite.py clownfish.png 30 25 clownfish_idle1 output.txt")
+        print("  python convert_sprite.py --spans --indexed --trim src/sprites/clownfish_frames.h --width 30")
+        print("  python convert_sprite.py --indexed --trim src/sprites/corals.h")
         print("\nSprite Dimensions:")
         print("  - Clownfish: 30x25")
         print("  - Corals: 16x16")
@@ -66,13 +340,13 @@ def main():
         print("  - Particles: 8x8")
         sys.exit(1)
     
-    png_path = sys.argv[1]
-    width = int(sys.argv[2])
-    height = int(sys.argv[3])
-    var_name = sys.argv[4]
-    output_file = sys.argv[5] if len(sys.argv) > 5 else None
+    png_path = argv[1]
+    width = int(argv[2])
+    height = int(argv[3])
+    var_name = argv[4]
+    output_file = argv[5] if len(argv) > 5 else None
     
-    png_to_rgb565_array(png_path, width, height, var_name, output_file)
+    png_to_rgb565_array(png_path, width, height, var_name, output_file, emit_spans)
 
 if __name__ == "__main__":
     main()
@@ -7,6 +7,7 @@ Converts PNG sprites with transparency to RGB565 arrays
 from PIL import Image
 import os
 import glob
+from convert_sprite import header_to_sprites, c565
 
 def rgb888_to_rgb565(r, g, b):
     """Convert RGB888 to RGB565"""
@@ -44,7 +45,7 @@ def png_to_rgb565_array(png_path, var_name, target_size=None):
     
     for i in range(0, len(pixels), 16):
         line = pixels[i:i+16]
-        output += "  " + ", ".join(f"0x{p:04X}" for p in line)
+        output += "  " + ", ".join(c565(p) for p in line)
         if i + 16 < len(pixels):
             output += ","
         output += "\n"
@@ -72,7 +73,7 @@ def main():
         "Clownfish_sleeping_sprite_frame_ae843813.png": ("clownfish_sleeping_f0", "SLEEPING Frame 0"),
     }
     
-    clownfish_output = "#pragma once\n#include <Arduino.h>\n\n"
+    clownfish_output = "#pragma once\n#include <Arduino.h>\n#include \"../sprite_common.h\"\n\n"
     clownfish_output += "// =============================================================================\n"
     clownfish_output += "// CLOWNFISH SPRITES - Generated from PNG\n"
     clownfish_output += "// =============================================================================\n\n"
@@ -95,8 +96,13 @@ def main():
     with open(os.path.join(output_dir, "clownfish_frames.h"), "w") as f:
         f.write(clownfish_output)
     
+    # Palette-indexed frames + span tables for drawSpriteSpans() (flipX included),
+    # cropped to the opaque area with per-frame offsets
+    header_to_sprites(os.path.join(output_dir, "clownfish_frames.h"), width_override=30,
+                      spans=True, indexed=True, trim=True)
+    
     print(f"\n[OK] Clownfish sprites: {clownfish_width}x{clownfish_height}")
-    print(f"   Output: {output_dir}/clownfish_frames.h")
+    print(f"   Output: {output_dir}/clownfish_frames.h + clownfish_frames_spans.h")
     
     # Seahorse
     seahorse_file = "Seahorse_decoration_sprite_16x16_0d8b935d.png"
@@ -106,7 +112,7 @@ def main():
         # Resize seahorse to 16x16 as specified in filename
         array, w, h = png_to_rgb565_array(seahorse_path, "seahorseBitmap", target_size=(16, 16))
         with open(os.path.join(output_dir, "seahorse.h"), "w") as f:
-            f.write("#pragma once\n#include <Arduino.h>\n\n")
+            f.write("#pragma once\n#include <Arduino.h>\n#include \"../sprite_common.h\"\n\n")
             f.write(array)
         print(f"[OK] Seahorse: {w}x{h}")
     
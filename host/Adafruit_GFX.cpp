@@ -0,0 +1,334 @@
+#include "Adafruit_GFX.h"
+
+// Classic 5x7 font (column-major, bit 0 = top row, bit 7 = descender),
+// printable ASCII only. Characters outside 32..126 render blank.
+static const uint8_t hostFont[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+    0x00, 0x00, 0x5F, 0x00, 0x00,  // '!'
+    0x00, 0x07, 0x00, 0x07, 0x00,  // '"'
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  // '#'
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  // '$'
+    0x23, 0x13, 0x08, 0x64, 0x62,  // '%'
+    0x36, 0x49, 0x55, 0x22, 0x50,  // '&'
+    0x00, 0x04, 0x03, 0x00, 0x00,  // "'"
+    0x00, 0x1C, 0x22, 0x41, 0x00,  // '('
+    0x00, 0x41, 0x22, 0x1C, 0x00,  // ')'
+    0x14, 0x08, 0x3E, 0x08, 0x14,  // '*'
+    0x08, 0x08, 0x3E, 0x08, 0x08,  // '+'
+    0x00, 0x50, 0x30, 0x00, 0x00,  // ','
+    0x08, 0x08, 0x08, 0x08, 0x08,  // '-'
+    0x00, 0x60, 0x60, 0x00, 0x00,  // '.'
+    0x20, 0x10, 0x08, 0x04, 0x02,  // '/'
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  // '0'
+    0x00, 0x42, 0x7F, 0x40, 0x00,  // '1'
+    0x42, 0x61, 0x51, 0x49, 0x46,  // '2'
+    0x21, 0x41, 0x45, 0x4B, 0x31,  // '3'
+    0x18, 0x14, 0x12, 0x7F, 0x10,  // '4'
+    0x27, 0x45, 0x45, 0x45, 0x39,  // '5'
+    0x3C, 0x4A, 0x49, 0x49, 0x30,  // '6'
+    0x01, 0x71, 0x09, 0x05, 0x03,  // '7'
+    0x36, 0x49, 0x49, 0x49, 0x36,  // '8'
+    0x06, 0x49, 0x49, 0x29, 0x1E,  // '9'
+    0x00, 0x36, 0x36, 0x00, 0x00,  // ':'
+    0x00, 0x56, 0x36, 0x00, 0x00,  // ';'
+    0x08, 0x14, 0x22, 0x41, 0x00,  // '<'
+    0x14, 0x14, 0x14, 0x14, 0x14,  // '='
+    0x00, 0x41, 0x22, 0x14, 0x08,  // '>'
+    0x02, 0x01, 0x51, 0x09, 0x06,  // '?'
+    0x32, 0x49, 0x79, 0x41, 0x3E,  // '@'
+    0x7E, 0x09, 0x09, 0x09, 0x7E,  // 'A'
+    0x7F, 0x49, 0x49, 0x49, 0x36,  // 'B'
+    0x3E, 0x41, 0x41, 0x41, 0x22,  // 'C'
+    0x7F, 0x41, 0x41, 0x22, 0x1C,  // 'D'
+    0x7F, 0x49, 0x49, 0x49, 0x41,  // 'E'
+    0x7F, 0x09, 0x09, 0x09, 0x01,  // 'F'
+    0x3E, 0x41, 0x49, 0x49, 0x7A,  // 'G'
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  // 'H'
+    0x00, 0x41, 0x7F, 0x41, 0x00,  // 'I'
+    0x20, 0x40, 0x41, 0x3F, 0x01,  // 'J'
+    0x7F, 0x08, 0x14, 0x22, 0x41,  // 'K'
+    0x7F, 0x40, 0x40, 0x40, 0x40,  // 'L'
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,  // 'M'
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  // 'N'
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  // 'O'
+    0x7F, 0x09, 0x09, 0x09, 0x06,  // 'P'
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  // 'Q'
+    0x7F, 0x09, 0x19, 0x29, 0x46,  // 'R'
+    0x46, 0x49, 0x49, 0x49, 0x31,  // 'S'
+    0x01, 0x01, 0x7F, 0x01, 0x01,  // 'T'
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  // 'U'
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  // 'V'
+    0x3F, 0x40, 0x38, 0x40, 0x3F,  // 'W'
+    0x63, 0x14, 0x08, 0x14, 0x63,  // 'X'
+    0x07, 0x08, 0x70, 0x08, 0x07,  // 'Y'
+    0x61, 0x51, 0x49, 0x45, 0x43,  // 'Z'
+    0x00, 0x7F, 0x41, 0x41, 0x00,  // '['
+    0x02, 0x04, 0x08, 0x10, 0x20,  // '\\'
+    0x00, 0x41, 0x41, 0x7F, 0x00,  // ']'
+    0x04, 0x02, 0x01, 0x02, 0x04,  // '^'
+    0x40, 0x40, 0x40, 0x40, 0x40,  // '_'
+    0x00, 0x01, 0x02, 0x04, 0x00,  // '`'
+    0x20, 0x54, 0x54, 0x54, 0x78,  // 'a'
+    0x7F, 0x48, 0x44, 0x44, 0x38,  // 'b'
+    0x38, 0x44, 0x44, 0x44, 0x20,  // 'c'
+    0x38, 0x44, 0x44, 0x48, 0x7F,  // 'd'
+    0x38, 0x54, 0x54, 0x54, 0x18,  // 'e'
+    0x08, 0x7E, 0x09, 0x01, 0x02,  // 'f'
+    0x18, 0xA4, 0xA4, 0xA4, 0x7C,  // 'g'
+    0x7F, 0x08, 0x04, 0x04, 0x78,  // 'h'
+    0x00, 0x44, 0x7D, 0x40, 0x00,  // 'i'
+    0x40, 0x80, 0x84, 0x7D, 0x00,  // 'j'
+    0x7F, 0x10, 0x28, 0x44, 0x00,  // 'k'
+    0x00, 0x41, 0x7F, 0x40, 0x00,  // 'l'
+    0x7C, 0x04, 0x18, 0x04, 0x78,  // 'm'
+    0x7C, 0x08, 0x04, 0x04, 0x78,  // 'n'
+    0x38, 0x44, 0x44, 0x44, 0x38,  // 'o'
+    0xFC, 0x24, 0x24, 0x24, 0x18,  // 'p'
+    0x18, 0x24, 0x24, 0x24, 0xFC,  // 'q'
+    0x7C, 0x08, 0x04, 0x04, 0x08,  // 'r'
+    0x48, 0x54, 0x54, 0x54, 0x24,  // 's'
+    0x04, 0x3F, 0x44, 0x40, 0x20,  // 't'
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  // 'u'
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  // 'v'
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  // 'w'
+    0x44, 0x28, 0x10, 0x28, 0x44,  // 'x'
+    0x1C, 0xA0, 0xA0, 0xA0, 0x7C,  // 'y'
+    0x44, 0x64, 0x54, 0x4C, 0x44,  // 'z'
+    0x00, 0x08, 0x36, 0x41, 0x00,  // '{'
+    0x00, 0x00, 0x7F, 0x00, 0x00,  // '|'
+    0x00, 0x41, 0x36, 0x08, 0x00,  // '}'
+    0x08, 0x04, 0x08, 0x10, 0x08,  // '~'
+};
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+void Adafruit_GFX::setRotation(uint8_t r)
+{
+    rotation = r & 3;
+    if (rotation & 1)
+    {
+        _width = HEIGHT;
+        _height = WIDTH;
+    }
+    else
+    {
+        _width = WIDTH;
+        _height = HEIGHT;
+    }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    startWrite();
+    for (int16_t i = 0; i < h; i++)
+        writePixel(x, y + i, color);
+    endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    startWrite();
+    for (int16_t i = 0; i < w; i++)
+        writePixel(x + i, y, color);
+    endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    startWrite();
+    for (int16_t i = x; i < x + w; i++)
+        writeFastVLine(i, y, h, color);
+    endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color)
+{
+    fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+    endWrite();
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+    startWrite();
+    writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+    endWrite();
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color)
+{
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+
+    delta++;
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (x < (y + 1))
+        {
+            if (corners & 1)
+                writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+            if (corners & 2)
+                writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+        }
+        if (y != py)
+        {
+            if (corners & 1)
+                writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+            if (corners & 2)
+                writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h)
+{
+    startWrite();
+    for (int16_t j = 0; j < h; j++, y++)
+        for (int16_t i = 0; i < w; i++)
+            writePixel(x + i, y, bitmap[j * w + i]);
+    endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h)
+{
+    drawRGBBitmap(x, y, (const uint16_t *)bitmap, w, h);
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size)
+{
+    if ((x >= _width) || (y >= _height) || ((x + 6 * size - 1) < 0) || ((y + 8 * size - 1) < 0))
+        return;
+
+    const uint8_t *glyph = (c >= 32 && c <= 126) ? &hostFont[(c - 32) * 5] : nullptr;
+
+    startWrite();
+    for (int8_t i = 0; i < 5; i++)
+    {
+        uint8_t line = glyph ? glyph[i] : 0;
+        for (int8_t j = 0; j < 8; j++, line >>= 1)
+        {
+            if (line & 1)
+            {
+                if (size == 1)
+                    writePixel(x + i, y + j, color);
+                else
+                    writeFillRect(x + i * size, y + j * size, size, size, color);
+            }
+            else if (bg != color)
+            {
+                if (size == 1)
+                    writePixel(x + i, y + j, bg);
+                else
+                    writeFillRect(x + i * size, y + j * size, size, size, bg);
+            }
+        }
+    }
+    if (bg != color)
+    {
+        if (size == 1)
+            writeFastVLine(x + 5, y, 8, bg);
+        else
+            writeFillRect(x + 5 * size, y, size, 8 * size, bg);
+    }
+    endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c)
+{
+    if (c == '\n')
+    {
+        cursor_x = 0;
+        cursor_y += textsize * 8;
+    }
+    else if (c != '\r')
+    {
+        if (wrap && ((cursor_x + textsize * 6) > _width))
+        {
+            cursor_x = 0;
+            cursor_y += textsize * 8;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+        cursor_x += textsize * 6;
+    }
+    return 1;
+}
+
+// ---- GFXcanvas16 ----
+
+GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h)
+{
+    buffer = (uint16_t *)calloc((size_t)w * h, sizeof(uint16_t));
+}
+
+GFXcanvas16::~GFXcanvas16()
+{
+    free(buffer);
+}
+
+void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (!buffer || x < 0 || y < 0 || x >= _width || y >= _height)
+        return;
+    buffer[y * WIDTH + x] = color;
+}
+
+void GFXcanvas16::fillScreen(uint16_t color)
+{
+    if (!buffer)
+        return;
+    for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT; i++)
+        buffer[i] = color;
+}
+
+void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    for (int16_t i = 0; i < h; i++)
+        drawPixel(x, y + i, color);
+}
+
+void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    for (int16_t i = 0; i < w; i++)
+        drawPixel(x + i, y, color);
+}
+
+void GFXcanvas16::byteSwap()
+{
+    if (!buffer)
+        return;
+    for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT; i++)
+        buffer[i] = (uint16_t)((buffer[i] << 8) | (buffer[i] >> 8));
+}
+
+uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) const
+{
+    if (!buffer || x < 0 || y < 0 || x >= _width || y >= _height)
+        return 0;
+    return buffer[y * WIDTH + x];
+}
@@ -0,0 +1,195 @@
+#include "Adafruit_ST7789.h"
+
+Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst)
+    : Adafruit_GFX(w, h)
+{
+    (void)cs;
+    (void)dc;
+    (void)rst;
+}
+
+Adafruit_SPITFT::~Adafruit_SPITFT()
+{
+    free(fb);
+}
+
+void Adafruit_SPITFT::allocFramebuffer()
+{
+    free(fb);
+    fb = (uint16_t *)calloc((size_t)WIDTH * HEIGHT, sizeof(uint16_t));
+}
+
+void Adafruit_SPITFT::setRotation(uint8_t r)
+{
+    Adafruit_GFX::setRotation(r);
+}
+
+void Adafruit_SPITFT::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    winX0 = x;
+    winY0 = y;
+    winX1 = x + w - 1;
+    winY1 = y + h - 1;
+    curX = winX0;
+    curY = winY0;
+}
+
+// RAMWR semantics: fill the window row-major and wrap back to its origin
+void Adafruit_SPITFT::pushPixel(uint16_t color)
+{
+    if (fb && curX < _width && curY < _height)
+        fb[curY * _width + curX] = color;
+    if (++curX > winX1)
+    {
+        curX = winX0;
+        if (++curY > winY1)
+            curY = winY0;
+    }
+}
+
+void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block, bool bigEndian)
+{
+    (void)block;
+    while (len--)
+    {
+        uint16_t c = *colors++;
+        pushPixel(bigEndian ? (uint16_t)((c << 8) | (c >> 8)) : c);
+    }
+}
+
+void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len)
+{
+    while (len--)
+        pushPixel(color);
+}
+
+bool Adafruit_SPITFT::clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const
+{
+    if (w < 0)
+    {
+        x += w + 1;
+        w = -w;
+    }
+    if (h < 0)
+    {
+        y += h + 1;
+        h = -h;
+    }
+    int16_t x1 = x + w, y1 = y + h;
+    if (x < 0)
+        x = 0;
+    if (y < 0)
+        y = 0;
+    if (x1 > _width)
+        x1 = _width;
+    if (y1 > _height)
+        y1 = _height;
+    w = x1 - x;
+    h = y1 - y;
+    return w > 0 && h > 0;
+}
+
+void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (x < 0 || y < 0 || x >= _width || y >= _height)
+        return;
+    startWrite();
+    setAddrWindow(x, y, 1, 1);
+    pushPixel(color);
+    endWrite();
+}
+
+void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (x < 0 || y < 0 || x >= _width || y >= _height)
+        return;
+    setAddrWindow(x, y, 1, 1);
+    pushPixel(color);
+}
+
+void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (!clipRect(x, y, w, h))
+        return;
+    setAddrWindow(x, y, w, h);
+    writeColor(color, (uint32_t)w * h);
+}
+
+void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (!clipRect(x, y, w, h))
+        return;
+    startWrite();
+    setAddrWindow(x, y, w, h);
+    writeColor(color, (uint32_t)w * h);
+    endWrite();
+}
+
+void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    fillRect(x, y, 1, h, color);
+}
+
+void Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    writeFillRect(x, y, w, 1, color);
+}
+
+void Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    writeFillRect(x, y, 1, h, color);
+}
+
+void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h)
+{
+    int16_t x2, y2;
+    if ((x >= _width) || (y >= _height) || ((x2 = (x + w - 1)) < 0) || ((y2 = (y + h - 1)) < 0))
+        return;
+
+    int16_t bx1 = 0, by1 = 0, saveW = w;
+    if (x < 0)
+    {
+        w += x;
+        bx1 = -x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        by1 = -y;
+        y = 0;
+    }
+    if (x2 >= _width)
+        w = _width - x;
+    if (y2 >= _height)
+        h = _height - y;
+
+    pcolors += by1 * saveW + bx1;
+    startWrite();
+    setAddrWindow(x, y, w, h);
+    while (h--)
+    {
+        writePixels(pcolors, w);
+        pcolors += saveW;
+    }
+    endWrite();
+}
+
+void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, const uint16_t pcolors[], int16_t w, int16_t h)
+{
+    drawRGBBitmap(x, y, (uint16_t *)pcolors, w, h);
+}
+
+void Adafruit_ST7789::init(uint16_t width, uint16_t height, uint8_t spiMode)
+{
+    (void)spiMode;
+    WIDTH = width;
+    HEIGHT = height;
+    setRotation(0);
+    allocFramebuffer();
+}
@@ -0,0 +1,50 @@
+#pragma once
+// Host-side Adafruit_SPITFT: instead of clocking bytes out of a SPI
+// peripheral, every address window and pixel write lands in an in-memory
+// RGB565 framebuffer in logical (post-rotation) coordinates.
+#include <Arduino.h>
+#include <SPI.h>
+#include "Adafruit_GFX.h"
+
+class Adafruit_SPITFT : public Adafruit_GFX
+{
+public:
+    Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst);
+    ~Adafruit_SPITFT();
+
+    virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+    void startWrite() override {}
+    void endWrite() override {}
+
+    void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false);
+    void writeColor(uint16_t color, uint32_t len);
+    void writeCommand(uint8_t cmd) { (void)cmd; }
+    void spiWrite(uint8_t b) { (void)b; }
+    void dmaWait() {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h);
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t pcolors[], int16_t w, int16_t h);
+
+    void setRotation(uint8_t r) override;
+
+    // Host-only: direct access to the recorded framebuffer
+    const uint16_t *framebuffer() const { return fb; }
+
+protected:
+    void allocFramebuffer();
+    bool clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+    void pushPixel(uint16_t color);
+
+    uint16_t *fb = nullptr;
+    uint16_t winX0 = 0, winY0 = 0, winX1 = 0, winY1 = 0;
+    uint16_t curX = 0, curY = 0;
+};
@@ -0,0 +1,16 @@
+#pragma once
+// Host-side Adafruit_ST7789: panel init only sets the logical geometry;
+// all drawing is handled by the recording Adafruit_SPITFT base.
+#include "Adafruit_SPITFT.h"
+
+#define ST77XX_CASET 0x2A
+#define ST77XX_RASET 0x2B
+#define ST77XX_RAMWR 0x2C
+
+class Adafruit_ST7789 : public Adafruit_SPITFT
+{
+public:
+    Adafruit_ST7789(int8_t cs, int8_t dc, int8_t rst) : Adafruit_SPITFT(240, 320, cs, dc, rst) {}
+
+    void init(uint16_t width = 240, uint16_t height = 320, uint8_t spiMode = SPI_MODE0);
+};
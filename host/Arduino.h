@@ -0,0 +1,122 @@
+#pragma once
+// Host-side Arduino API shim for the [env:native] build.
+// Time is virtual: millis()/micros() only advance through delay(),
+// delayMicroseconds() and GPIO reads, so simulated frames run as fast as
+// the host CPU allows while the firmware still sees a real-time clock.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+#ifndef NATIVE_BUILD
+#define NATIVE_BUILD
+#endif
+
+using std::min;
+using std::max;
+using std::abs;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define DEC 10
+#define HEX 16
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void *const *)(addr))
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L lo, H hi)
+{
+    return (x < (T)lo) ? (T)lo : ((x > (T)hi) ? (T)hi : x);
+}
+
+// ---- Zeit (virtuell) ----
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// ---- GPIO ----
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+// Flanken-Interrupts der geskripteten Tasten: feuern, sobald die virtuelle
+// Zeit über eine Flanke läuft (mode wird ignoriert, immer CHANGE)
+#define digitalPinToInterrupt(p) (p)
+void attachInterrupt(uint8_t interruptNum, void (*isr)(), int mode);
+
+// ---- Zufall (deterministisch, seed via randomSeed) ----
+void randomSeed(unsigned long seed);
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+// ---- Print / Serial ----
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t len);
+
+    size_t print(const char *s);
+    size_t print(char c);
+    size_t print(int n, int base = DEC);
+    size_t print(unsigned int n, int base = DEC);
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println();
+    size_t println(const char *s);
+    size_t println(char c);
+    size_t println(int n, int base = DEC);
+    size_t println(unsigned int n, int base = DEC);
+    size_t println(long n, int base = DEC);
+    size_t println(unsigned long n, int base = DEC);
+    size_t println(double n, int digits = 2);
+
+private:
+    size_t printNumber(unsigned long n, int base);
+};
+
+class HostSerial : public Print
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() {}
+    size_t write(uint8_t c) override;
+    using Print::write;
+    explicit operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
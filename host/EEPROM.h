@@ -0,0 +1,47 @@
+#pragma once
+// Host-side EEPROM shim: 4 KB in RAM, erased to 0xFF like a fresh Teensy.
+#include <Arduino.h>
+
+class EEPROMClass
+{
+public:
+    static constexpr size_t SIZE = 4096;
+
+    EEPROMClass() { memset(data, 0xFF, sizeof(data)); }
+
+    bool begin(size_t size) { (void)size; return true; }
+    bool commit() { return true; }
+    size_t length() const { return SIZE; }
+
+    uint8_t read(int addr) const { return (addr >= 0 && (size_t)addr < SIZE) ? data[addr] : 0xFF; }
+    void write(int addr, uint8_t val)
+    {
+        if (addr >= 0 && (size_t)addr < SIZE)
+            data[addr] = val;
+    }
+
+    template <typename T>
+    T &get(int addr, T &t) const
+    {
+        uint8_t *p = (uint8_t *)&t;
+        for (size_t i = 0; i < sizeof(T); i++)
+            p[i] = read(addr + (int)i);
+        return t;
+    }
+
+    template <typename T>
+    const T &put(int addr, const T &t)
+    {
+        const uint8_t *p = (const uint8_t *)&t;
+        for (size_t i = 0; i < sizeof(T); i++)
+            write(addr + (int)i, p[i]);
+        return t;
+    }
+
+    uint8_t *raw() { return data; }
+
+private:
+    uint8_t data[SIZE];
+};
+
+extern EEPROMClass EEPROM;
@@ -0,0 +1,20 @@
+#pragma once
+// Host-side SPI shim: the display backend records pixels directly, so the
+// bus itself only needs to accept configuration calls.
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPIClass
+{
+public:
+    void begin() {}
+    void end() {}
+    void setFrequency(uint32_t freq) { frequency = freq; }
+    uint32_t frequency = 40000000;
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,152 @@
+#include "bench_blend.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "blend565.h"
+
+static const uint16_t ROW_PIXELS = 320;
+static const int ROWS = 64;
+static const int PASSES = 2000;
+
+// Deterministic data: ~25% transparent sprite pixels, random alpha map
+static uint32_t rng = 0x12345678;
+static uint16_t nextRandom()
+{
+    rng = rng * 1664525u + 1013904223u;
+    return (uint16_t)(rng >> 16);
+}
+
+struct BenchData
+{
+    std::vector<uint16_t> bg, src;
+    std::vector<uint8_t> alpha;
+};
+
+static BenchData makeData()
+{
+    BenchData d;
+    d.bg.resize(ROWS * ROW_PIXELS);
+    d.src.resize(ROWS * ROW_PIXELS);
+    d.alpha.resize(ROWS * ROW_PIXELS);
+    for (size_t i = 0; i < d.bg.size(); i++)
+    {
+        d.bg[i] = nextRandom();
+        d.src[i] = (nextRandom() & 3) == 0 ? TRANSPARENT_KEY : nextRandom();
+        d.alpha[i] = nextRandom() % (BLEND_ALPHA_OPAQUE + 1);
+    }
+    return d;
+}
+
+// ---- Scalar references: one pixel, one channel at a time ----
+
+// Buffers hold the memory format (px565), the reference blends logical RGB565
+static uint16_t refBlend(uint16_t fg, uint16_t bg, uint8_t a)
+{
+    return px565(blend565Scalar(px565(fg), px565(bg), a));
+}
+
+static void refFill(uint16_t *dst, uint16_t color, uint16_t n, uint8_t a)
+{
+    for (uint16_t i = 0; i < n; i++)
+        dst[i] = refBlend(color, dst[i], a);
+}
+
+static void refRow(uint16_t *dst, const uint16_t *src, uint16_t n, uint8_t a)
+{
+    for (uint16_t i = 0; i < n; i++)
+        if (!isTransparent16(src[i]))
+            dst[i] = refBlend(src[i], dst[i], a);
+}
+
+static void refRowMap(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++)
+        if (!isTransparent16(src[i]))
+            dst[i] = refBlend(src[i], dst[i], alpha[i]);
+}
+
+// Kernel: 0 = fill, 1 = row, 2 = row with alpha map; ref selects the reference
+static void runKernel(int kernel, bool ref, const BenchData &d, std::vector<uint16_t> &out,
+                      uint16_t offset, uint16_t n, uint8_t a)
+{
+    for (int r = 0; r < ROWS; r++)
+    {
+        uint16_t *dst = out.data() + r * ROW_PIXELS + offset;
+        const uint16_t *src = d.src.data() + r * ROW_PIXELS + offset;
+        const uint8_t *alpha = d.alpha.data() + r * ROW_PIXELS + offset;
+        uint16_t color = d.src[r * ROW_PIXELS] | 1;
+        switch (kernel)
+        {
+        case 0:
+            ref ? refFill(dst, color, n, a) : blendFill565(dst, color, n, a);
+            break;
+        case 1:
+            ref ? refRow(dst, src, n, a) : blendRow565(dst, src, n, a);
+            break;
+        default:
+            ref ? refRowMap(dst, src, alpha, n) : blendRowMap565(dst, src, alpha, n);
+            break;
+        }
+    }
+}
+
+// kernel < 0: nur das Zurücksetzen der Zeilen (wird von den Messungen abgezogen)
+static double timeKernel(int kernel, bool ref, const BenchData &d, uint8_t a, uint32_t &sink)
+{
+    std::vector<uint16_t> out = d.bg;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int p = 0; p < PASSES; p++)
+    {
+        // Frische Hintergrundzeilen bei jedem Durchlauf, sonst konvergiert alles zur Vordergrundfarbe
+        memcpy(out.data(), d.bg.data(), out.size() * sizeof(uint16_t));
+        if (kernel >= 0)
+            runKernel(kernel, ref, d, out, 0, ROW_PIXELS, a);
+        sink += out[p % out.size()];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)PASSES * ROWS * ROW_PIXELS);
+}
+
+int hostBenchBlend()
+{
+    static const char *names[3] = {"fill (const alpha)", "row (sprite alpha)", "row (alpha map)"};
+    BenchData d = makeData();
+    int failures = 0;
+
+    // Bit-exakt gegen die Referenz: jedes Alpha, ungerade Längen und Offsets
+    for (int kernel = 0; kernel < 3; kernel++)
+    {
+        uint32_t mismatches = 0;
+        for (uint8_t a = 0; a <= BLEND_ALPHA_OPAQUE; a++)
+        {
+            for (uint16_t offset = 0; offset < 3; offset++)
+            {
+                uint16_t n = ROW_PIXELS - 3 - a;
+                std::vector<uint16_t> got = d.bg, want = d.bg;
+                runKernel(kernel, false, d, got, offset, n, a);
+                runKernel(kernel, true, d, want, offset, n, a);
+                for (size_t i = 0; i < got.size(); i++)
+                    mismatches += got[i] != want[i];
+            }
+        }
+        printf("[BENCH] %-20s %s", names[kernel], mismatches ? "MISMATCH" : "exact");
+        if (mismatches)
+            printf(" (%u pixels)", (unsigned)mismatches);
+        printf("\n");
+        failures += mismatches != 0;
+    }
+
+    // Zeit pro Pixel, halbe Deckkraft
+    uint32_t sink = 0;
+    double resetNs = timeKernel(-1, false, d, 0, sink);
+    for (int kernel = 0; kernel < 3; kernel++)
+    {
+        double refNs = timeKernel(kernel, true, d, BLEND_ALPHA_OPAQUE / 2, sink) - resetNs;
+        double swarNs = timeKernel(kernel, false, d, BLEND_ALPHA_OPAQUE / 2, sink) - resetNs;
+        printf("[BENCH] %-20s scalar %6.3f ns/px  swar %6.3f ns/px  x%.2f\n",
+               names[kernel], refNs, swarNs, swarNs > 0 ? refNs / swarNs : 0.0);
+    }
+    printf("[BENCH] (checksum %08x)\n", (unsigned)sink);
+    return failures ? 1 : 0;
+}
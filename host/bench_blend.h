@@ -0,0 +1,9 @@
+#pragma once
+// Host benchmark for the RGB565 blend kernels (src/blend565.h): every
+// kernel is checked bit-exact against a per-channel scalar reference on
+// random rows, then both are timed over 320-pixel rows.
+//
+//   program --bench-blend
+//
+// Returns the process exit code (1 if any kernel disagrees).
+int hostBenchBlend();
@@ -0,0 +1,82 @@
+#include "golden.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// Gleiche Umrechnung wie hostWritePPM(), damit exakt verglichen wird
+static void toRGB888(uint16_t c, uint8_t *rgb)
+{
+    rgb[0] = (uint8_t)(((c >> 11) & 0x1F) * 255 / 31);
+    rgb[1] = (uint8_t)(((c >> 5) & 0x3F) * 255 / 63);
+    rgb[2] = (uint8_t)((c & 0x1F) * 255 / 31);
+}
+
+// Binäres P6 mit maxval 255 (so schreibt es hostWritePPM)
+static bool readPPM(const char *path, int16_t w, int16_t h, std::vector<uint8_t> &rgb)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    int fw = 0, fh = 0, maxval = 0;
+    bool ok = fscanf(f, "P6 %d %d %d", &fw, &fh, &maxval) == 3 &&
+              fw == w && fh == h && maxval == 255 && fgetc(f) != EOF;
+    if (ok)
+    {
+        rgb.resize((size_t)w * h * 3);
+        ok = fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+    }
+    fclose(f);
+    return ok;
+}
+
+GoldenResult hostCompareGolden(const uint16_t *fb, int16_t w, int16_t h,
+                               const char *goldenPath, const char *maskPath)
+{
+    GoldenResult r = {false, 0, w, h, -1, -1};
+    std::vector<uint8_t> golden;
+    if (!readPPM(goldenPath, w, h, golden))
+        return r;
+    r.loaded = true;
+
+    std::vector<uint8_t> mask(golden.size());
+    for (int16_t y = 0; y < h; y++)
+    {
+        for (int16_t x = 0; x < w; x++)
+        {
+            size_t i = ((size_t)y * w + x) * 3;
+            uint8_t rgb[3];
+            toRGB888(fb[(size_t)y * w + x], rgb);
+            if (memcmp(rgb, &golden[i], 3) == 0)
+            {
+                uint8_t grey = (golden[i] + golden[i + 1] + golden[i + 2]) / 12;
+                mask[i] = mask[i + 1] = mask[i + 2] = grey;
+                continue;
+            }
+            mask[i] = 255;
+            mask[i + 1] = 0;
+            mask[i + 2] = 0;
+            r.diffPixels++;
+            if (x < r.x0) r.x0 = x;
+            if (y < r.y0) r.y0 = y;
+            if (x > r.x1) r.x1 = x;
+            if (y > r.y1) r.y1 = y;
+        }
+    }
+
+    if (r.diffPixels && maskPath)
+    {
+        FILE *f = fopen(maskPath, "wb");
+        if (f)
+        {
+            fprintf(f, "P6\n%d %d\n255\n", w, h);
+            fwrite(mask.data(), 1, mask.size(), f);
+            fclose(f);
+        }
+        else
+        {
+            fprintf(stderr, "[GOLDEN] could not write %s\n", maskPath);
+        }
+    }
+    return r;
+}
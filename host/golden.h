@@ -0,0 +1,17 @@
+#pragma once
+// Golden-frame comparison for the host build: framebuffer snapshots are
+// compared against checked-in PPM references, differences are written as
+// a mask (red = differing pixel, grey = dimmed reference).
+#include <stdint.h>
+
+struct GoldenResult
+{
+    bool loaded;        // reference exists and has the right size
+    uint32_t diffPixels;
+    int16_t x0, y0, x1, y1;  // bounding box of the differences (inclusive)
+};
+
+// fb (RGB565) against the PPM at goldenPath. With maskPath != nullptr the
+// diff mask is written there whenever pixels differ.
+GoldenResult hostCompareGolden(const uint16_t *fb, int16_t w, int16_t h,
+                               const char *goldenPath, const char *maskPath);
@@ -0,0 +1,256 @@
+#include <Arduino.h>
+#include <SPI.h>
+#include <EEPROM.h>
+#include <stdio.h>
+#include <atomic>
+#include "host_sim.h"
+
+HostSerial Serial;
+SPIClass SPI;
+EEPROMClass EEPROM;
+
+// ---- Virtueller Takt ----
+// Atomar: mit DUAL_CORE_PIPELINE liest der Simulations-Thread mit
+static std::atomic<uint64_t> gNowUs{0};
+
+// A GPIO read costs ~1 us of virtual time, so polling loops on a pin
+// (while (digitalRead(..) == LOW);) still terminate.
+static constexpr uint64_t GPIO_READ_COST_US = 1;
+
+static void advanceTo(uint64_t targetUs);
+
+uint64_t hostNowMicros() { return gNowUs; }
+void hostAdvanceMicros(uint64_t us) { advanceTo(gNowUs + us); }
+
+unsigned long millis() { return (unsigned long)(gNowUs / 1000); }
+unsigned long micros() { return (unsigned long)gNowUs; }
+void delay(unsigned long ms) { advanceTo(gNowUs + (uint64_t)ms * 1000); }
+void delayMicroseconds(unsigned int us) { advanceTo(gNowUs + us); }
+void yield() {}
+
+// ---- GPIO ----
+constexpr uint8_t HOST_NUM_PINS = 64;
+constexpr uint8_t HOST_MAX_PRESSES = 64;
+
+static int pinLevel[HOST_NUM_PINS];
+static bool pinLevelInit = false;
+
+struct ScheduledPress
+{
+    uint8_t pin;
+    uint64_t startUs;
+    uint64_t endUs;
+};
+static ScheduledPress presses[HOST_MAX_PRESSES];
+static uint8_t pressCount = 0;
+static int analogValue = 0;
+
+static void initPins()
+{
+    if (pinLevelInit)
+        return;
+    for (uint8_t i = 0; i < HOST_NUM_PINS; i++)
+        pinLevel[i] = HIGH;
+    pinLevelInit = true;
+}
+
+void hostSetPinLevel(uint8_t pin, int level)
+{
+    initPins();
+    if (pin < HOST_NUM_PINS)
+        pinLevel[pin] = level;
+}
+
+void hostSchedulePress(uint8_t pin, uint32_t atMs, uint32_t holdMs)
+{
+    if (pressCount >= HOST_MAX_PRESSES)
+        return;
+    presses[pressCount].pin = pin;
+    presses[pressCount].startUs = (uint64_t)atMs * 1000;
+    presses[pressCount].endUs = (uint64_t)(atMs + holdMs) * 1000;
+    pressCount++;
+}
+
+void hostSetAnalogValue(int value) { analogValue = value; }
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    initPins();
+    if (pin < HOST_NUM_PINS && mode == INPUT_PULLUP)
+        pinLevel[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    initPins();
+    if (pin < HOST_NUM_PINS)
+        pinLevel[pin] = val;
+}
+
+// ---- Interrupts ----
+// Nur Flanken geskripteter Tasten; die ISR läuft auf dem Thread, der die
+// Zeit vorstellt (loop()), wie auf der Hardware zwischen zwei Befehlen
+static void (*pinIsr[HOST_NUM_PINS])() = {};
+static bool inIsr = false;
+
+void attachInterrupt(uint8_t interruptNum, void (*isr)(), int mode)
+{
+    (void)mode;
+    if (interruptNum < HOST_NUM_PINS)
+        pinIsr[interruptNum] = isr;
+}
+
+// Zeit bis targetUs vorstellen und unterwegs jede Flanke eines Pins mit ISR
+// zu ihrem Zeitpunkt auslösen (in zeitlicher Reihenfolge)
+static void advanceTo(uint64_t targetUs)
+{
+    while (!inIsr)
+    {
+        uint64_t now = gNowUs;
+        uint64_t next = UINT64_MAX;
+        uint8_t pin = 0;
+        for (uint8_t i = 0; i < pressCount; i++)
+        {
+            const ScheduledPress &p = presses[i];
+            if (p.pin >= HOST_NUM_PINS || !pinIsr[p.pin])
+                continue;
+            if (p.startUs > now && p.startUs <= targetUs && p.startUs < next)
+            {
+                next = p.startUs;
+                pin = p.pin;
+            }
+            if (p.endUs > now && p.endUs <= targetUs && p.endUs < next)
+            {
+                next = p.endUs;
+                pin = p.pin;
+            }
+        }
+        if (next == UINT64_MAX)
+            break;
+        gNowUs = next;
+        inIsr = true;
+        pinIsr[pin]();
+        inIsr = false;
+    }
+    if (targetUs > gNowUs)
+        gNowUs = targetUs;
+}
+
+int digitalRead(uint8_t pin)
+{
+    initPins();
+    advanceTo(gNowUs + GPIO_READ_COST_US);
+    for (uint8_t i = 0; i < pressCount; i++)
+    {
+        if (presses[i].pin == pin && gNowUs >= presses[i].startUs && gNowUs < presses[i].endUs)
+            return LOW;
+    }
+    return (pin < HOST_NUM_PINS) ? pinLevel[pin] : HIGH;
+}
+
+int analogRead(uint8_t pin)
+{
+    (void)pin;
+    return analogValue;
+}
+
+// ---- Zufall: xorshift32, unabhängig von der libc ----
+static uint32_t rngState = 0x2545F491u;
+
+void randomSeed(unsigned long seed)
+{
+    rngState = (uint32_t)seed ^ 0x2545F491u;
+    if (rngState == 0)
+        rngState = 0x2545F491u;
+}
+
+static uint32_t nextRandom()
+{
+    uint32_t x = rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rngState = x;
+    return x;
+}
+
+long random(long howbig)
+{
+    if (howbig <= 0)
+        return 0;
+    return (long)(nextRandom() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig)
+{
+    if (howsmall >= howbig)
+        return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+// ---- Print ----
+size_t Print::write(const uint8_t *buf, size_t len)
+{
+    size_t n = 0;
+    while (len--)
+        n += write(*buf++);
+    return n;
+}
+
+size_t Print::print(const char *s)
+{
+    return write((const uint8_t *)s, strlen(s));
+}
+
+size_t Print::print(char c) { return write((uint8_t)c); }
+
+size_t Print::printNumber(unsigned long n, int base)
+{
+    char buf[8 * sizeof(long) + 1];
+    char *str = &buf[sizeof(buf) - 1];
+    *str = '\0';
+    if (base < 2)
+        base = 10;
+    do
+    {
+        unsigned long m = n;
+        n /= base;
+        char c = (char)(m - base * n);
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return print(str);
+}
+
+size_t Print::print(long n, int base)
+{
+    if (base == DEC && n < 0)
+        return print('-') + printNumber((unsigned long)(-n), DEC);
+    return printNumber((unsigned long)n, base);
+}
+
+size_t Print::print(int n, int base) { return print((long)n, base); }
+size_t Print::print(unsigned int n, int base) { return printNumber(n, base); }
+size_t Print::print(unsigned long n, int base) { return printNumber(n, base); }
+
+size_t Print::print(double n, int digits)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", digits, n);
+    return print(buf);
+}
+
+size_t Print::println() { return write('\r') + write('\n'); }
+size_t Print::println(const char *s) { return print(s) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(int n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned int n, int base) { return print(n, base) + println(); }
+size_t Print::println(long n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned long n, int base) { return print(n, base) + println(); }
+size_t Print::println(double n, int digits) { return print(n, digits) + println(); }
+
+size_t HostSerial::write(uint8_t c)
+{
+    if (c != '\r')
+        fputc(c, stdout);
+    return 1;
+}
@@ -0,0 +1,303 @@
+// Entry point for the [env:native] build: runs the unmodified firmware
+// setup()/loop() against the host shims as fast as the CPU allows.
+//
+//   .pio/build/native/program [--frames N] [--seed S] [--dump out.ppm]
+//
+// Golden-frame mode (see host/golden/scenario.txt):
+//
+//   program --scenario host/golden/scenario.txt --golden host/golden
+//
+// snapshots the framebuffer after the --snap frames, compares them with
+// <golden>/frame_<N>.ppm and writes diff_frame_<N>.ppm masks to --diff-dir.
+// The exit code is 1 if any frame differs. --update-golden rewrites the
+// references instead. With --golden or --scenario the frame governor is
+// pinned to its default rate, so virtual time (and thus every snapshot)
+// does not depend on how many bytes the render flags put on the bus.
+//
+//   program --bench-blend
+//
+// checks and times the RGB565 blend kernels instead of running the game.
+#include <Arduino.h>
+#include <stdio.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "host_sim.h"
+#include "golden.h"
+#include "bench_blend.h"
+#include "config.h"
+#include "gfx.h"
+#include "frame_profiler.h"
+#include "frame_pipeline.h"
+#include "frame_governor.h"
+
+void setup();
+void loop();
+
+const uint16_t *hostFramebuffer()
+{
+    return tft.framebuffer();
+}
+
+bool hostWritePPM(const char *path, const uint16_t *fb, int16_t w, int16_t h)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    for (int32_t i = 0; i < (int32_t)w * h; i++)
+    {
+        uint16_t c = fb[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31)};
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+struct Snapshot
+{
+    long frame;
+    std::vector<uint16_t> pixels;
+};
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--frames N] [--seed S] [--env-seed S] [--dump out.ppm]\n"
+            "          [--press left|ok|right@MS[+HOLD]]... [--snap N]...\n"
+            "          [--golden DIR [--update-golden] [--diff-dir DIR]]\n"
+            "          [--scenario FILE]\n"
+            "       %s --bench-blend\n",
+            prog, prog);
+}
+
+// "ok@9000+1200" -> Pin, Zeitpunkt und Haltedauer (Standard 100 ms)
+static bool parsePress(const char *spec, uint8_t &pin, uint32_t &atMs, uint32_t &holdMs)
+{
+    char name[8];
+    unsigned long at = 0, hold = 100;
+    if (sscanf(spec, "%7[a-z]@%lu+%lu", name, &at, &hold) < 2)
+        return false;
+    if (!strcmp(name, "left"))
+        pin = PIN_BTN_LEFT;
+    else if (!strcmp(name, "ok"))
+        pin = PIN_BTN_OK;
+    else if (!strcmp(name, "right"))
+        pin = PIN_BTN_RIGHT;
+    else
+        return false;
+    atMs = at;
+    holdMs = hold;
+    return true;
+}
+
+// Szenario-Datei: dieselben Optionen wie auf der Kommandozeile,
+// durch Leerraum getrennt, '#' bis Zeilenende ist Kommentar
+static bool readScenario(const char *path, std::vector<std::string> &args)
+{
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return false;
+    char line[256];
+    while (fgets(line, sizeof(line), f))
+    {
+        char *hash = strchr(line, '#');
+        if (hash)
+            *hash = 0;
+        for (char *tok = strtok(line, " \t\r\n"); tok; tok = strtok(nullptr, " \t\r\n"))
+            args.push_back(tok);
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    long frames = 1000;
+    int seed = 0;
+    uint32_t envSeed = 0;
+    std::string dumpPath;
+    std::string goldenDir;
+    std::string diffDir = ".";
+    bool updateGolden = false;
+    std::vector<long> snapFrames;
+    bool customPresses = false;
+    bool scenario = false;
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        const std::string &a = args[i];
+        bool hasValue = i + 1 < args.size();
+        if (a == "--frames" && hasValue)
+            frames = atol(args[++i].c_str());
+        else if (a == "--seed" && hasValue)
+            seed = atoi(args[++i].c_str());
+        else if (a == "--env-seed" && hasValue)
+            envSeed = strtoul(args[++i].c_str(), nullptr, 0);
+        else if (a == "--dump" && hasValue)
+            dumpPath = args[++i];
+        else if (a == "--snap" && hasValue)
+            snapFrames.push_back(atol(args[++i].c_str()));
+        else if (a == "--golden" && hasValue)
+            goldenDir = args[++i];
+        else if (a == "--diff-dir" && hasValue)
+            diffDir = args[++i];
+        else if (a == "--update-golden")
+            updateGolden = true;
+        else if (a == "--bench-blend")
+            return hostBenchBlend();
+        else if (a == "--press" && hasValue)
+        {
+            uint8_t pin;
+            uint32_t atMs, holdMs;
+            if (!parsePress(args[++i].c_str(), pin, atMs, holdMs))
+            {
+                fprintf(stderr, "[HOST] bad --press '%s'\n", args[i].c_str());
+                return 2;
+            }
+            hostSchedulePress(pin, atMs, holdMs);
+            customPresses = true;
+        }
+        else if (a == "--scenario" && hasValue)
+        {
+            std::vector<std::string> extra;
+            if (!readScenario(args[++i].c_str(), extra))
+            {
+                fprintf(stderr, "[HOST] could not read scenario %s\n", args[i].c_str());
+                return 2;
+            }
+            args.insert(args.begin() + i + 1, extra.begin(), extra.end());
+            scenario = true;
+        }
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    hostSetAnalogValue(seed);
+    if (scenario || !goldenDir.empty())
+        governorPin(true);
+    if (envSeed)
+        setEnvironmentSeed(envSeed);
+
+    // Keine periodischen Reports, nur die Zusammenfassung am Ende
+    spiStatsSetAutoReport(false);
+
+    // The start menu is the non-blocking MODE_START state driven from loop();
+    // this first OK press ("Start New" is preselected) is consumed there.
+    // A scenario scripts its own presses, including this one.
+    if (!customPresses)
+        hostSchedulePress(PIN_BTN_OK, 500, 100);
+
+    std::vector<Snapshot> snapshots;
+    auto takeSnapshots = [&](long frame) {
+        for (long s : snapFrames)
+        {
+            if (s != frame)
+                continue;
+            spiFlushFence();
+            const uint16_t *fb = hostFramebuffer();
+            snapshots.push_back({frame, std::vector<uint16_t>(fb, fb + TFT_WIDTH * TFT_HEIGHT)});
+        }
+    };
+
+    auto t0 = std::chrono::steady_clock::now();
+    setup();
+    auto t1 = std::chrono::steady_clock::now();
+    // DUAL_CORE_PIPELINE zeigt Frame N erst nach loop() N+1: Snapshots um
+    // die Pipeline-Verzögerung später nehmen, dann gelten dieselben Referenzen
+    long lag = snapFrames.empty() ? 0 : PIPELINE_LAG_FRAMES;
+    takeSnapshots(-lag);
+    for (long f = 0; f < frames + lag; f++)
+    {
+        loop();
+        takeSnapshots(f + 1 - lag);
+    }
+    pipelineDrain();  // DUAL_CORE_PIPELINE: Simulations-Thread ruhig vor der Auswertung
+    auto t2 = std::chrono::steady_clock::now();
+
+    double setupMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    double loopMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    fprintf(stderr, "[HOST] setup: %.2f ms, %ld frames in %.2f ms (%.1f us/frame, %.0f frames/s), virtual time %.2f s\n",
+            setupMs, frames, loopMs, frames ? loopMs * 1000.0 / frames : 0.0,
+            loopMs > 0 ? frames * 1000.0 / loopMs : 0.0, hostNowMicros() / 1e6);
+    spiStatsPrintSummary();
+    profilerPrintReport();
+
+    SpiFlushStats fs = spiFlushStats();
+    fprintf(stderr, "[HOST] flush: %u transfers, bus %.2f ms, CPU stalled %u times for %.2f ms\n",
+            (unsigned)fs.transfers, fs.busUs / 1000.0, (unsigned)fs.stalls, fs.stallUs / 1000.0);
+
+    // Laufende Transfers landen erst beim Abschluss im Framebuffer
+    spiFlushFence();
+
+    if (!dumpPath.empty())
+    {
+        if (!hostWritePPM(dumpPath.c_str(), hostFramebuffer(), TFT_WIDTH, TFT_HEIGHT))
+        {
+            fprintf(stderr, "[HOST] could not write %s\n", dumpPath.c_str());
+            return 1;
+        }
+        fprintf(stderr, "[HOST] framebuffer written to %s\n", dumpPath.c_str());
+    }
+
+    if (goldenDir.empty())
+        return 0;
+
+    // Vergleich erst nach der Zeitmessung, damit er die Frame-Zeiten nicht verfälscht
+    int failed = 0;
+    for (const Snapshot &snap : snapshots)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "frame_%05ld.ppm", snap.frame);
+        std::string golden = goldenDir + "/" + name;
+        if (updateGolden)
+        {
+            if (!hostWritePPM(golden.c_str(), snap.pixels.data(), TFT_WIDTH, TFT_HEIGHT))
+            {
+                fprintf(stderr, "[GOLDEN] could not write %s\n", golden.c_str());
+                return 1;
+            }
+            fprintf(stderr, "[GOLDEN] frame %5ld: updated %s\n", snap.frame, golden.c_str());
+            continue;
+        }
+
+        std::string mask = diffDir + "/diff_" + name;
+        GoldenResult r = hostCompareGolden(snap.pixels.data(), TFT_WIDTH, TFT_HEIGHT,
+                                           golden.c_str(), mask.c_str());
+        if (!r.loaded)
+        {
+            fprintf(stderr, "[GOLDEN] frame %5ld: MISSING %s\n", snap.frame, golden.c_str());
+            failed++;
+        }
+        else if (r.diffPixels)
+        {
+            fprintf(stderr, "[GOLDEN] frame %5ld: FAIL %u px differ in (%d,%d)-(%d,%d), mask %s\n",
+                    snap.frame, (unsigned)r.diffPixels, r.x0, r.y0, r.x1, r.y1, mask.c_str());
+            failed++;
+        }
+        else
+        {
+            fprintf(stderr, "[GOLDEN] frame %5ld: ok\n", snap.frame);
+        }
+    }
+    if (updateGolden)
+        return 0;
+
+    fprintf(stderr, "[GOLDEN] %u/%u frames match\n",
+            (unsigned)(snapshots.size() - failed), (unsigned)snapshots.size());
+    if (snapshots.size() < snapFrames.size())
+    {
+        fprintf(stderr, "[GOLDEN] %u --snap frames lie beyond --frames\n",
+                (unsigned)(snapFrames.size() - snapshots.size()));
+        failed++;
+    }
+    return failed ? 1 : 0;
+}
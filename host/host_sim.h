@@ -0,0 +1,19 @@
+#pragma once
+// Control surface of the host simulation (virtual clock, button script,
+// framebuffer access). Only host_main.cpp and host tools include this.
+#include <Arduino.h>
+
+// Virtual clock
+uint64_t hostNowMicros();
+void hostAdvanceMicros(uint64_t us);
+
+// GPIO: buttons are pull-ups, so LOW = pressed
+void hostSetPinLevel(uint8_t pin, int level);
+void hostSchedulePress(uint8_t pin, uint32_t atMs, uint32_t holdMs);
+
+// Analog input returned by analogRead() (feeds randomSeed in setup())
+void hostSetAnalogValue(int value);
+
+// Framebuffer of the recorded display (TFT_WIDTH x TFT_HEIGHT, RGB565)
+const uint16_t *hostFramebuffer();
+bool hostWritePPM(const char *path, const uint16_t *fb, int16_t w, int16_t h);
@@ -1,64 +1,147 @@
-#include "buttons.h"
+#include "Buttons.h"
 #include "config.h"
+#include "frame_governor.h"
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
 
 ButtonManager Buttons;
 
+static const uint8_t BTN_PINS[3] = {PIN_BTN_LEFT, PIN_BTN_OK, PIN_BTN_RIGHT};
+
+static void IRAM_ATTR isrLeft() { Buttons.onEdgeIsr(0); }
+static void IRAM_ATTR isrOk() { Buttons.onEdgeIsr(1); }
+static void IRAM_ATTR isrRight() { Buttons.onEdgeIsr(2); }
+
 void ButtonManager::begin()
 {
     pinMode(PIN_BTN_LEFT, INPUT_PULLUP);
     pinMode(PIN_BTN_OK, INPUT_PULLUP);
     pinMode(PIN_BTN_RIGHT, INPUT_PULLUP);
+
+    // Alle drei Pins teilen sich einen GPIO-Interrupt gleicher Priorität
+    // (ESP32 und Teensy), die ISRs unterbrechen sich also nicht gegenseitig
+    // und bleiben ein einzelner Schreiber für gpioEvents
+    attachInterrupt(digitalPinToInterrupt(PIN_BTN_LEFT), isrLeft, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(PIN_BTN_OK), isrOk, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(PIN_BTN_RIGHT), isrRight, CHANGE);
 }
 
-void ButtonManager::poll()
+void IRAM_ATTR ButtonManager::onEdgeIsr(uint8_t index)
 {
-    unsigned long now = millis();
-    if (now - lastPollMs < DEBOUNCE_MS)
+    uint32_t now = micros();
+    // Prellen: Flanken kurz nach der letzten ignorieren, den Endzustand
+    // holt poll() notfalls über den Pegel nach
+    if (now - isrEdgeUs[index] < DEBOUNCE_US)
         return;
-    lastPollMs = now;
-
-    int sLeft = digitalRead(PIN_BTN_LEFT);
-    int sOk = digitalRead(PIN_BTN_OK);
-    int sRight = digitalRead(PIN_BTN_RIGHT);
-
-    if (lastBtnLeftState == HIGH && sLeft == LOW)
-        btnLeftPressed = true;
-    if (lastBtnOkState == HIGH && sOk == LOW)
-        btnOkPressed = true;
-    if (lastBtnRightState == HIGH && sRight == LOW)
-        btnRightPressed = true;
-
-    lastBtnLeftState = sLeft;
-    lastBtnOkState = sOk;
-    lastBtnRightState = sRight;
-
-    if (bleMask & 0x01)
-        btnLeftPressed = true;
-    if (bleMask & 0x02)
-        btnOkPressed = true;
-    if (bleMask & 0x04)
-        btnRightPressed = true;
+    isrEdgeUs[index] = now;
+
+    bool down = digitalRead(BTN_PINS[index]) == LOW;
+    InputEvent ev = {now, down ? INPUT_PRESS : INPUT_RELEASE, (uint8_t)(1 << index)};
+    gpioEvents.push(ev);
+    if (down)
+        governorNotifyInput();
 }
 
-void ButtonManager::getAndClearPressed(bool &left, bool &ok, bool &right)
+void ButtonManager::postBleMask(uint8_t mask)
 {
-    left = btnLeftPressed;
-    ok = btnOkPressed;
-    right = btnRightPressed;
-
-    btnLeftPressed = false;
-    btnOkPressed = false;
-    btnRightPressed = false;
+    mask &= BTN_LEFT | BTN_OK | BTN_RIGHT;
+    if (mask == 0)
+        return;
+    InputEvent ev = {(uint32_t)micros(), INPUT_BLE_COMMAND, mask};
+    bool queued = bleEvents.push(ev);
+#ifdef DEBUG_BUTTONS
+    Serial.print(queued ? "[BLE] Button command queued: 0x" : "[BLE] Queue full, dropped: 0x");
+    Serial.println(mask, HEX);
+#else
+    (void)queued;
+#endif
 }
 
-void ButtonManager::setBleMask(uint8_t mask)
+void ButtonManager::apply(const InputEvent &ev)
 {
-    bleMask = mask;
-#ifdef DEBUG_BUTTONS
-    if (mask != 0)
+    if (ev.type == INPUT_BLE_COMMAND)
     {
-        Serial.print("[BLE] Button mask updated: 0x");
-        Serial.println(mask, HEX);
+        pressedMask |= ev.buttons;
+        return;
     }
+
+    uint8_t index = ev.buttons == BTN_LEFT ? 0 : (ev.buttons == BTN_OK ? 1 : 2);
+    lastEventUs[index] = ev.timeUs;
+    if (ev.type == INPUT_PRESS)
+    {
+        if (heldMask & ev.buttons)
+            return;  // schon unten (z.B. vom Pegelabgleich nachgetragen)
+        heldMask |= ev.buttons;
+        pressedMask |= ev.buttons;
+        if (ev.buttons == BTN_OK)
+        {
+            okDownUs = ev.timeUs;
+            longPressArmed = true;
+        }
+#ifdef DEBUG_BUTTONS
+        Serial.print("[BTN] Press 0x");
+        Serial.print(ev.buttons, HEX);
+        Serial.print(" latency us: ");
+        Serial.println((uint32_t)(micros() - ev.timeUs));
 #endif
+    }
+    else
+    {
+        heldMask &= ~ev.buttons;
+        if (ev.buttons == BTN_OK)
+            longPressArmed = false;
+    }
+}
+
+void ButtonManager::poll()
+{
+    InputEvent ev;
+    while (gpioEvents.pop(ev))
+        apply(ev);
+    while (bleEvents.pop(ev))
+        apply(ev);
+
+    // Pegelabgleich: eine im Prellfenster verworfene letzte Flanke (oder ein
+    // voller Ring) würde den Zustand sonst bis zum nächsten Druck verfälschen
+    uint32_t now = micros();
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        uint8_t bit = 1 << i;
+        bool down = digitalRead(BTN_PINS[i]) == LOW;
+        if (down != ((heldMask & bit) != 0) && now - lastEventUs[i] >= DEBOUNCE_US)
+        {
+            InputEvent fix = {now, down ? INPUT_PRESS : INPUT_RELEASE, bit};
+            apply(fix);
+        }
+    }
+
+    if (longPressArmed && now - okDownUs >= LONG_PRESS_MS * 1000)
+    {
+        longPressArmed = false;
+        longPressPending = true;
+    }
+}
+
+void ButtonManager::getAndClearPressed(bool &left, bool &ok, bool &right)
+{
+    left = pressedMask & BTN_LEFT;
+    ok = pressedMask & BTN_OK;
+    right = pressedMask & BTN_RIGHT;
+    pressedMask = 0;
+}
+
+bool ButtonManager::takeLongPress()
+{
+    bool fired = longPressPending;
+    longPressPending = false;
+    return fired;
+}
+
+void ButtonManager::consumeHeld()
+{
+    pressedMask = 0;
+    longPressArmed = false;
+    longPressPending = false;
 }
@@ -2,28 +2,70 @@
 #define BUTTONS_H
 
 #include <Arduino.h>
+#include "spsc_ring.h"
 
+// Button-Bits, gleiche Belegung wie die BLE-Maske
+constexpr uint8_t BTN_LEFT = 0x01;
+constexpr uint8_t BTN_OK = 0x02;
+constexpr uint8_t BTN_RIGHT = 0x04;
+
+enum InputEventType : uint8_t
+{
+    INPUT_PRESS,        // GPIO-Flanke auf LOW
+    INPUT_RELEASE,      // GPIO-Flanke auf HIGH
+    INPUT_BLE_COMMAND   // BLE-Write, ein Druck pro gesetztem Bit
+};
+
+struct InputEvent
+{
+    uint32_t timeUs;    // micros() beim Eintreffen
+    InputEventType type;
+    uint8_t buttons;    // BTN_*-Bits
+};
+
+// Eingaben kommen als Events mit Zeitstempel: die Flanken-Interrupts der
+// drei Tasten und der NimBLE-Callback schreiben je in einen eigenen
+// lock-freien Ring, poll() leert beide einmal pro Frame. Gedrückt wird im
+// Moment der Flanke, nicht erst beim nächsten Abfragen; langer OK-Druck
+// ergibt sich aus dem Zeitstempel des Drucks.
 class ButtonManager
 {
 private:
-    int lastBtnLeftState = HIGH;
-    int lastBtnOkState = HIGH;
-    int lastBtnRightState = HIGH;
+    static constexpr uint8_t QUEUE_SIZE = 16;
+    SpscRing<InputEvent, QUEUE_SIZE> gpioEvents;   // Schreiber: Flanken-ISRs
+    SpscRing<InputEvent, QUEUE_SIZE> bleEvents;    // Schreiber: NimBLE-Host-Task
 
-    bool btnLeftPressed = false;
-    bool btnOkPressed = false;
-    bool btnRightPressed = false;
+    uint32_t isrEdgeUs[3] = {};     // letzte angenommene Flanke (nur ISR)
 
-    unsigned long lastPollMs = 0;
-    static constexpr unsigned long DEBOUNCE_MS = 40;
+    uint8_t heldMask = 0;           // entprellter GPIO-Zustand
+    uint8_t pressedMask = 0;        // Drücke seit getAndClearPressed()
+    uint32_t lastEventUs[3] = {};
+    uint32_t okDownUs = 0;
+    bool longPressArmed = false;
+    bool longPressPending = false;
 
-    uint8_t bleMask = 0;
+    void apply(const InputEvent &ev);
 
 public:
+    static constexpr uint32_t DEBOUNCE_US = 20000;
+    static constexpr uint32_t LONG_PRESS_MS = 1000;
+
     void begin();
     void poll();
     void getAndClearPressed(bool &left, bool &ok, bool &right);
-    void setBleMask(uint8_t mask);
+
+    // true einmal pro OK-Druck, der LONG_PRESS_MS gehalten wurde
+    bool takeLongPress();
+
+    // Aktuell gehaltene Tasten und offene Drücke verwerfen (z.B. beim
+    // Verlassen eines Menüs, damit der Druck dort nicht weiterwirkt)
+    void consumeHeld();
+
+    // Aus dem BLE-Callback: Maske als Befehl einreihen (0 = nichts)
+    void postBleMask(uint8_t mask);
+
+    // Aus den Flanken-Interrupts (index 0..2 = LEFT, OK, RIGHT)
+    void onEdgeIsr(uint8_t index);
 };
 
 extern ButtonManager Buttons;
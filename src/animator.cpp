@@ -96,7 +96,7 @@ void requestTransition(AnimState newState, float duration) {
   gAnimator.transitionProgress = 0.0f;
 }
 
-const uint16_t* getCurrentFrame() {
+const SpriteSpanTable* getCurrentFrame() {
   const AnimationClip* clip = gAnimator.currentClip ? gAnimator.currentClip : &CLIP_IDLE;
   
   // Validate clip
@@ -120,7 +120,7 @@ const uint16_t* getCurrentFrame() {
   }
   
   // Get frame pointer
-  const uint16_t* frame = clip->frames[gAnimator.currentFrame];
+  const SpriteSpanTable* frame = clip->frames[gAnimator.currentFrame];
   
   // Validate frame pointer
   if (!frame) {
@@ -1,5 +1,6 @@
 #pragma once
 #include <Arduino.h>
+#include "sprite_common.h"
 
 enum AnimState {
   ANIM_IDLE = 0,
@@ -11,7 +12,7 @@ enum AnimState {
 };
 
 struct AnimationClip {
-  const uint16_t* const* frames;
+  const SpriteSpanTable* const* frames;  // Span-Tabellen (Pixel ggf. palette-indiziert)
   uint8_t frameCount;
   float fps;
   bool loop;
@@ -37,5 +38,5 @@ extern Animator gAnimator;
 void initAnimator();
 void updateAnimator(float deltaTime);
 void requestTransition(AnimState newState, float duration);
-const uint16_t* getCurrentFrame();
+const SpriteSpanTable* getCurrentFrame();
 bool isFlipped();
@@ -0,0 +1,299 @@
+#include "bg_tiles.h"
+#include <stdlib.h>
+#include <new>
+
+enum BgTileKind : uint8_t {
+  TILE_SOLID = 0,  // 1 Farbe
+  TILE_PAL4,       // Palette (<= 16) + 2 Pixel pro Byte, High-Nibble zuerst
+  TILE_PAL8,       // Palette (<= 256) + 1 Byte pro Pixel
+  TILE_RAW         // RGB565
+};
+
+struct BgTile {
+  uint8_t kind;
+  uint8_t colors;   // Palettengröße - 1
+  uint16_t offset;  // Byte-Offset im Pool (gerade)
+};
+
+constexpr uint16_t BG_TILE_COUNT = BG_TILES_X * BG_TILES_Y;
+
+static BgTile tiles[BG_TILE_COUNT];        // eindeutige Kacheln
+static uint8_t tileMap[BG_TILE_COUNT];     // Bildschirm-Kachel -> eindeutige Kachel
+static uint8_t* pool = nullptr;
+static uint32_t poolUsed = 0;
+static uint16_t uniqueCount = 0;
+
+static_assert(BG_TILE_COUNT <= 256, "tileMap is 8 bit");
+static_assert(BG_TILE_POOL_BYTES <= 65536, "tile offsets are 16 bit");
+
+// Band-Canvas: verschiebt alle Zeichenaufrufe um originY nach oben, alles
+// außerhalb der BG_TILE_SIZE Zeilen wird verworfen. Schreibt direkt in den
+// Puffer, damit keine Basismethode ein zweites Mal verschiebt.
+class BandCanvas16 : public GFXcanvas16 {
+public:
+  BandCanvas16() : GFXcanvas16(TFT_WIDTH, BG_TILE_SIZE) {}
+  int16_t originY = 0;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    y -= originY;
+    if (x < 0 || y < 0 || x >= TFT_WIDTH || y >= BG_TILE_SIZE) return;
+    getBuffer()[y * TFT_WIDTH + x] = color;
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    y -= originY;
+    if (y < 0 || y >= BG_TILE_SIZE) return;
+    int16_t x0 = max(x, (int16_t)0);
+    int16_t x1 = min((int16_t)(x + w), TFT_WIDTH);
+    uint16_t* row = getBuffer() + y * TFT_WIDTH;
+    for (int16_t i = x0; i < x1; ++i) row[i] = color;
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    for (int16_t i = 0; i < h; ++i) drawPixel(x, y + i, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+    for (int16_t i = 0; i < h; ++i) drawFastHLine(x, y + i, w, color);
+  }
+};
+
+static uint8_t tileWidth(uint8_t tx) {
+  return min((int16_t)BG_TILE_SIZE, (int16_t)(TFT_WIDTH - tx * BG_TILE_SIZE));
+}
+
+static uint8_t tileHeight(uint8_t ty) {
+  return min((int16_t)BG_TILE_SIZE, (int16_t)(TFT_HEIGHT - ty * BG_TILE_SIZE));
+}
+
+static uint16_t paletteIndex(const uint16_t* pal, uint16_t n, uint16_t c) {
+  uint16_t lo = 0, hi = n;
+  while (hi - lo > 1) {
+    uint16_t mid = (lo + hi) / 2;
+    if (pal[mid] <= c) lo = mid; else hi = mid;
+  }
+  return lo;
+}
+
+static int compareColor(const void* a, const void* b) {
+  return (int)*(const uint16_t*)a - (int)*(const uint16_t*)b;
+}
+
+// Dekodiert n Pixel ab Pixelindex i einer Kachel
+static void decodeRun(const BgTile& t, uint16_t i, uint16_t n, uint16_t* dst) {
+  const uint8_t* data = pool + t.offset;
+  const uint16_t* pal = (const uint16_t*)data;
+  const uint8_t* idx = data + 2 * (t.colors + 1);
+
+  switch (t.kind) {
+    case TILE_SOLID:
+      for (uint16_t k = 0; k < n; ++k) dst[k] = pal[0];
+      break;
+    case TILE_PAL4:
+      for (uint16_t k = 0; k < n; ++k, ++i) {
+        uint8_t b = idx[i >> 1];
+        dst[k] = pal[(i & 1) ? (b & 0x0F) : (b >> 4)];
+      }
+      break;
+    case TILE_PAL8:
+      for (uint16_t k = 0; k < n; ++k) dst[k] = pal[idx[i + k]];
+      break;
+    default:
+      memcpy(dst, pal + i, n * sizeof(uint16_t));
+      break;
+  }
+}
+
+// Kachel kodieren und anhängen; false = Pool voll
+static bool appendTile(const uint16_t* px, uint16_t count, BgTile& t) {
+  uint16_t pal[BG_TILE_SIZE * BG_TILE_SIZE];
+  memcpy(pal, px, count * sizeof(uint16_t));
+  qsort(pal, count, sizeof(uint16_t), compareColor);
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < count; ++i) {
+    if (n == 0 || pal[n - 1] != pal[i]) pal[n++] = pal[i];
+  }
+
+  uint32_t sizeRaw = 2u * count;
+  uint32_t sizePal4 = 2u * n + (count + 1) / 2;
+  uint32_t sizePal8 = 2u * n + count;
+  uint32_t size;
+  if (n == 1) {
+    t.kind = TILE_SOLID;
+    size = 2;
+  } else if (n <= 16 && sizePal4 < sizeRaw) {
+    t.kind = TILE_PAL4;
+    size = sizePal4;
+  } else if (n <= 256 && sizePal8 < sizeRaw) {
+    t.kind = TILE_PAL8;
+    size = sizePal8;
+  } else {
+    t.kind = TILE_RAW;
+    size = sizeRaw;
+  }
+  size = (size + 1) & ~1u;
+  if (poolUsed + size > BG_TILE_POOL_BYTES) return false;
+
+  t.colors = (t.kind == TILE_RAW) ? 0 : n - 1;
+  t.offset = poolUsed;
+  uint8_t* data = pool + poolUsed;
+  poolUsed += size;
+
+  if (t.kind == TILE_RAW) {
+    memcpy(data, px, sizeRaw);
+    return true;
+  }
+  memcpy(data, pal, 2u * n);
+  uint8_t* idx = data + 2u * n;
+  if (t.kind == TILE_PAL4) {
+    memset(idx, 0, (count + 1) / 2);
+    for (uint16_t i = 0; i < count; ++i) {
+      uint8_t v = paletteIndex(pal, n, px[i]);
+      idx[i >> 1] |= (i & 1) ? v : (v << 4);
+    }
+  } else if (t.kind == TILE_PAL8) {
+    for (uint16_t i = 0; i < count; ++i) {
+      idx[i] = paletteIndex(pal, n, px[i]);
+    }
+  }
+  return true;
+}
+
+static uint32_t hashTile(const uint16_t* px, uint16_t count) {
+  uint32_t h = 2166136261u;  // FNV-1a
+  for (uint16_t i = 0; i < count; ++i) {
+    h = (h ^ px[i]) * 16777619u;
+  }
+  return h;
+}
+
+bool bgTilesBuild(BgRenderFn render) {
+  bgTilesFree();
+  pool = (uint8_t*)malloc(BG_TILE_POOL_BYTES);
+  BandCanvas16* band = new (std::nothrow) BandCanvas16();
+  if (!pool || !band || !band->getBuffer()) {
+    Serial.println("[BGTILES] ERROR: out of memory");
+    delete band;
+    bgTilesFree();
+    return false;
+  }
+
+  // Nur während des Aufbaus: Hash + Größe je eindeutiger Kachel
+  static uint32_t uniqueHash[BG_TILE_COUNT];
+  static uint8_t uniqueW[BG_TILE_COUNT], uniqueH[BG_TILE_COUNT];
+  uint16_t px[BG_TILE_SIZE * BG_TILE_SIZE];
+  uint16_t cmp[BG_TILE_SIZE];
+  bool ok = true;
+
+  for (uint8_t ty = 0; ty < BG_TILES_Y && ok; ++ty) {
+    band->originY = ty * BG_TILE_SIZE;
+    render(band, band->originY);
+    const uint16_t* buf = band->getBuffer();
+    uint8_t th = tileHeight(ty);
+
+    for (uint8_t tx = 0; tx < BG_TILES_X && ok; ++tx) {
+      uint8_t tw = tileWidth(tx);
+      uint16_t count = tw * th;
+      for (uint8_t r = 0; r < th; ++r) {
+        memcpy(px + r * tw, buf + r * TFT_WIDTH + tx * BG_TILE_SIZE, tw * sizeof(uint16_t));
+      }
+
+      // Gleiche Kachel schon gespeichert?
+      uint32_t h = hashTile(px, count);
+      int16_t found = -1;
+      for (uint16_t u = 0; u < uniqueCount && found < 0; ++u) {
+        if (uniqueHash[u] != h || uniqueW[u] != tw || uniqueH[u] != th) continue;
+        bool same = true;
+        for (uint8_t r = 0; r < th && same; ++r) {
+          decodeRun(tiles[u], r * tw, tw, cmp);
+          same = memcmp(cmp, px + r * tw, tw * sizeof(uint16_t)) == 0;
+        }
+        if (same) found = u;
+      }
+
+      if (found < 0) {
+        if (!appendTile(px, count, tiles[uniqueCount])) {
+          ok = false;
+          break;
+        }
+        uniqueHash[uniqueCount] = h;
+        uniqueW[uniqueCount] = tw;
+        uniqueH[uniqueCount] = th;
+        found = uniqueCount++;
+      }
+      tileMap[ty * BG_TILES_X + tx] = found;
+    }
+#ifdef ESP32
+    yield();
+#endif
+  }
+  delete band;
+
+  if (!ok) {
+    Serial.println("[BGTILES] ERROR: tile pool full (raise BG_TILE_POOL_BYTES)");
+    bgTilesFree();
+    return false;
+  }
+
+  // Pool auf die belegte Größe verkleinern
+  uint8_t* shrunk = (uint8_t*)realloc(pool, poolUsed);
+  if (shrunk) pool = shrunk;
+
+#ifdef DEBUG_GRAPHICS
+  BgTileStats s = bgTilesStats();
+  Serial.print("[BGTILES] ");
+  Serial.print(s.unique);
+  Serial.print("/");
+  Serial.print(BG_TILE_COUNT);
+  Serial.print(" unique tiles (solid ");
+  Serial.print(s.solid);
+  Serial.print(", pal4 ");
+  Serial.print(s.pal4);
+  Serial.print(", pal8 ");
+  Serial.print(s.pal8);
+  Serial.print(", raw ");
+  Serial.print(s.raw);
+  Serial.print("), ");
+  Serial.print(s.bytes);
+  Serial.println(" B");
+#endif
+  return true;
+}
+
+void bgTilesFree() {
+  free(pool);
+  pool = nullptr;
+  poolUsed = 0;
+  uniqueCount = 0;
+}
+
+bool bgTilesReady() {
+  return pool != nullptr;
+}
+
+void bgTilesReadRow(int16_t x, int16_t y, int16_t w, uint16_t* dst) {
+  uint8_t ty = y / BG_TILE_SIZE;
+  uint8_t ry = y % BG_TILE_SIZE;
+  const uint8_t* mapRow = tileMap + ty * BG_TILES_X;
+
+  while (w > 0) {
+    uint8_t tx = x / BG_TILE_SIZE;
+    uint8_t cx = x % BG_TILE_SIZE;
+    uint8_t tw = tileWidth(tx);
+    int16_t n = min(w, (int16_t)(tw - cx));
+    decodeRun(tiles[mapRow[tx]], ry * tw + cx, n, dst);
+    dst += n;
+    x += n;
+    w -= n;
+  }
+}
+
+BgTileStats bgTilesStats() {
+  BgTileStats s = {uniqueCount, 0, 0, 0, 0, poolUsed};
+  for (uint16_t u = 0; u < uniqueCount; ++u) {
+    switch (tiles[u].kind) {
+      case TILE_SOLID: s.solid++; break;
+      case TILE_PAL4: s.pal4++; break;
+      case TILE_PAL8: s.pal8++; break;
+      default: s.raw++; break;
+    }
+  }
+  return s;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "config.h"
+
+// ---- Gekachelter Hintergrund (ESP32 ohne PSRAM) ----
+// Statt des 108-KB-Canvas wird der Hintergrund in 16x16-Kacheln zerlegt.
+// Identische Kacheln (Wasserverlauf) werden nur einmal gespeichert, jede
+// Kachel in der kleinsten Form: Vollfarbe, 4-/8-Bit-Palette oder RGB565.
+// Restore und Compose dekodieren zeilenweise nur die Kacheln, die ein
+// Dirty-Rect berührt.
+
+constexpr uint8_t BG_TILE_SIZE = 16;
+constexpr uint8_t BG_TILES_X = (TFT_WIDTH + BG_TILE_SIZE - 1) / BG_TILE_SIZE;   // 20
+constexpr uint8_t BG_TILES_Y = (TFT_HEIGHT + BG_TILE_SIZE - 1) / BG_TILE_SIZE;  // 11
+
+// Füllt das Band ab Bildschirmzeile originY: entweder die komplette Szene
+// in absoluten Koordinaten zeichnen (das Band behält nur seine
+// BG_TILE_SIZE Zeilen) oder direkt in band->getBuffer() kopieren
+typedef void (*BgRenderFn)(GFXcanvas16* band, int16_t originY);
+
+// Hintergrund bandweise rendern und kacheln. render wird einmal pro
+// Kachelzeile aufgerufen und muss jedes Mal dasselbe Bild liefern.
+// Temporär: ein 320x16-Band (10 KB) + Pool mit BG_TILE_POOL_BYTES,
+// danach wird der Pool auf die belegte Größe verkleinert.
+bool bgTilesBuild(BgRenderFn render);
+void bgTilesFree();
+bool bgTilesReady();
+
+// w Pixel ab (x, y) dekodieren (muss im Bildschirm liegen)
+void bgTilesReadRow(int16_t x, int16_t y, int16_t w, uint16_t* dst);
+
+struct BgTileStats {
+  uint16_t unique;                  // gespeicherte Kacheln (nach Deduplizierung)
+  uint16_t solid, pal4, pal8, raw;  // davon je Format
+  uint32_t bytes;                   // Pool-Größe
+};
+
+BgTileStats bgTilesStats();
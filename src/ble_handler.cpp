@@ -5,6 +5,8 @@
 #include <NimBLEDevice.h>
 #include "Buttons.h"
 #include "config.h"
+#include "frame_governor.h"
+#include "frame_profiler.h"
 
 #define SERVICE_UUID "8B3D0001-57B4-4DFE-8A3E-2F0D5A5B8C01"
 #define CHARACTERISTIC_UUID "8B3D0002-57B4-4DFE-8A3E-2F0D5A5B8C01"
@@ -26,9 +28,8 @@ class ServerCallbacks : public NimBLEServerCallbacks
     void onDisconnect(NimBLEServer *pServer)
     {
         deviceConnected = false;
-        Buttons.setBleMask(0);
 #ifdef DEBUG_BUTTONS
-        Serial.println("[BLE] Client disconnected - cleared button mask");
+        Serial.println("[BLE] Client disconnected");
 #endif
         NimBLEDevice::startAdvertising();
 #ifdef DEBUG_BUTTONS
@@ -46,6 +47,12 @@ class CharacteristicCallbacks : public NimBLECharacteristicCallbacks
         {
             uint8_t buttonMask = 0;
             char firstChar = value[0];
+
+            // 'p' = Profiler-Report per Notify, 'P' = Report + Reset
+            if (firstChar == 'p' || firstChar == 'P') {
+                profilerRequestReport(firstChar == 'P');
+                return;
+            }
             
             // Support ASCII commands: 'l', 'o', 'r' or bitmask
             if (firstChar == 'l' || firstChar == 'L') {
@@ -58,7 +65,9 @@ class CharacteristicCallbacks : public NimBLECharacteristicCallbacks
                 buttonMask = (uint8_t)firstChar; // Raw bitmask
             }
             
-            Buttons.setBleMask(buttonMask);
+            // Läuft im NimBLE-Host-Task: nur einreihen, loop() wertet aus
+            Buttons.postBleMask(buttonMask);
+            governorNotifyInput();
 #ifdef DEBUG_BUTTONS
             Serial.print("[BLE] Received: '");
             if (firstChar >= 32 && firstChar < 127) {
@@ -81,6 +90,17 @@ class CharacteristicCallbacks : public NimBLECharacteristicCallbacks
     }
 };
 
+#ifdef DEBUG_FRAME_PROFILER
+// Report-Zeilen des Profilers als Notify an den verbundenen Client
+static void notifyProfilerLine(const char *line)
+{
+    if (!deviceConnected || !pCharacteristic)
+        return;
+    pCharacteristic->setValue((const uint8_t *)line, strlen(line));
+    pCharacteristic->notify();
+}
+#endif
+
 void initBLE()
 {
 #ifdef DEBUG_BUTTONS
@@ -99,6 +119,9 @@ void initBLE()
         NIMBLE_PROPERTY::WRITE_NR | NIMBLE_PROPERTY::NOTIFY);
 
     pCharacteristic->setCallbacks(new CharacteristicCallbacks());
+#ifdef DEBUG_FRAME_PROFILER
+    profilerSetReportSink(notifyProfilerLine);
+#endif
 
     pService->start();
 
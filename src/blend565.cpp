@@ -0,0 +1,88 @@
+#include "blend565.h"
+#include <string.h>
+
+// Zwei benachbarte Pixel als ein 32-Bit-Zugriff (Ausrichtung egal)
+static inline uint32_t loadPair(const uint16_t* p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline void storePair(uint16_t* p, uint32_t v) {
+  memcpy(p, &v, sizeof(v));
+}
+
+// px565() für beide Pixel eines Paars (ein rev16 auf ARM)
+static inline uint32_t px565Pair(uint32_t v) {
+#ifdef WIRE_ORDER_PIXELS
+  return ((v & 0x00FF00FFu) << 8) | ((v >> 8) & 0x00FF00FFu);
+#else
+  return v;
+#endif
+}
+
+void blendFill565(uint16_t* dst, uint16_t color, uint16_t n, uint8_t a) {
+  if (a == 0) return;
+
+  // Vordergrundanteil ist für alle Pixel gleich: (f*a + b*(32-a)) >> 5,
+  // ohne Vorzeichen, daher ohne Überträge zwischen den Kanälen
+  uint32_t fa = blendSpread565(px565(color)) * a;
+  uint8_t ia = BLEND_ALPHA_OPAQUE - a;
+  uint16_t i = 0;
+  for (; i + 1 < n; i += 2) {
+    uint32_t d = px565Pair(loadPair(dst + i));
+    uint32_t b0 = blendSpread565((uint16_t)d);
+    uint32_t b1 = blendSpread565((uint16_t)(d >> 16));
+    uint16_t o0 = blendFold565(((fa + b0 * ia) >> 5) & BLEND_SPREAD_MASK);
+    uint16_t o1 = blendFold565(((fa + b1 * ia) >> 5) & BLEND_SPREAD_MASK);
+    storePair(dst + i, px565Pair(o0 | ((uint32_t)o1 << 16)));
+  }
+  if (i < n) {
+    uint32_t b = blendSpread565(px565(dst[i]));
+    dst[i] = px565(blendFold565(((fa + b * ia) >> 5) & BLEND_SPREAD_MASK));
+  }
+}
+
+void blendRow565(uint16_t* dst, const uint16_t* src, uint16_t n, uint8_t a) {
+  if (a == 0) return;
+
+  uint16_t i = 0;
+  for (; i + 1 < n; i += 2) {
+    uint32_t s = loadPair(src + i);
+    bool skip0 = isTransparent16((uint16_t)s);
+    bool skip1 = isTransparent16((uint16_t)(s >> 16));
+    if (skip0 && skip1) continue;
+
+    s = px565Pair(s);
+    uint32_t d = px565Pair(loadPair(dst + i));
+    uint16_t d0 = (uint16_t)d;
+    uint16_t d1 = (uint16_t)(d >> 16);
+    if (!skip0) d0 = blend565((uint16_t)s, d0, a);
+    if (!skip1) d1 = blend565((uint16_t)(s >> 16), d1, a);
+    storePair(dst + i, px565Pair(d0 | ((uint32_t)d1 << 16)));
+  }
+  if (i < n && !isTransparent16(src[i])) {
+    dst[i] = blendStored565(src[i], dst[i], a);
+  }
+}
+
+void blendRowMap565(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, uint16_t n) {
+  uint16_t i = 0;
+  for (; i + 1 < n; i += 2) {
+    uint32_t s = loadPair(src + i);
+    bool skip0 = alpha[i] == 0 || isTransparent16((uint16_t)s);
+    bool skip1 = alpha[i + 1] == 0 || isTransparent16((uint16_t)(s >> 16));
+    if (skip0 && skip1) continue;
+
+    s = px565Pair(s);
+    uint32_t d = px565Pair(loadPair(dst + i));
+    uint16_t d0 = (uint16_t)d;
+    uint16_t d1 = (uint16_t)(d >> 16);
+    if (!skip0) d0 = blend565((uint16_t)s, d0, alpha[i]);
+    if (!skip1) d1 = blend565((uint16_t)(s >> 16), d1, alpha[i + 1]);
+    storePair(dst + i, px565Pair(d0 | ((uint32_t)d1 << 16)));
+  }
+  if (i < n && alpha[i] && !isTransparent16(src[i])) {
+    dst[i] = blendStored565(src[i], dst[i], alpha[i]);
+  }
+}
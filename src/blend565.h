@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+#include "sprite_common.h"
+
+// ---- RGB565-Alpha-Blending (SWAR) ----
+// Alpha hat 5 Bit Auflösung: 0 = nur Hintergrund, BLEND_ALPHA_OPAQUE = nur
+// Vordergrund. Ein Pixel wird auf 0x07E0F81F gespreizt (G in Bit 21..26,
+// R in 11..15, B in 0..4), zwischen den Kanälen bleiben 5 bzw. 6 Bit Luft.
+// So geht das Blenden aller drei Kanäle mit einer Multiplikation:
+//   out = bg + ((fg - bg) * a >> 5)   pro Kanal, Überträge heben sich auf.
+// Die Zeilen-Kernel lesen und schreiben zwei Pixel pro 32-Bit-Zugriff und
+// überspringen Paare, die ganz transparent sind. Puffer, Sprites und Farben
+// der Kernel sind im Speicherformat (px565), blend565() rechnet logisch.
+//
+// Ergebnis pro Kanal identisch zu blend565Scalar(), d.h.
+//   (fg * a + bg * (32 - a)) >> 5
+// Host: program --bench-blend vergleicht und misst beide.
+
+constexpr uint8_t BLEND_ALPHA_OPAQUE = 32;
+constexpr uint32_t BLEND_SPREAD_MASK = 0x07E0F81F;
+
+// 0..1 -> 0..32
+inline uint8_t blendAlpha5(float alpha) {
+  if (alpha <= 0.0f) return 0;
+  if (alpha >= 1.0f) return BLEND_ALPHA_OPAQUE;
+  return (uint8_t)(alpha * BLEND_ALPHA_OPAQUE + 0.5f);
+}
+
+inline uint32_t blendSpread565(uint16_t c) {
+  return (c | ((uint32_t)c << 16)) & BLEND_SPREAD_MASK;
+}
+
+inline uint16_t blendFold565(uint32_t x) {
+  return (uint16_t)(x | (x >> 16));
+}
+
+// Ein Pixel, eine Multiplikation
+inline uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t a) {
+  uint32_t b = blendSpread565(bg);
+  uint32_t f = blendSpread565(fg);
+  return blendFold565((b + (((f - b) * a) >> 5)) & BLEND_SPREAD_MASK);
+}
+
+// Ein Pixel im Speicherformat (Sprite-Daten, Canvas, Staging-Puffer)
+inline uint16_t blendStored565(uint16_t fg, uint16_t bg, uint8_t a) {
+  return px565(blend565(px565(fg), px565(bg), a));
+}
+
+// Referenz: Kanal für Kanal
+inline uint16_t blend565Scalar(uint16_t fg, uint16_t bg, uint8_t a) {
+  uint16_t r = (((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * (32 - a)) >> 5;
+  uint16_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (32 - a)) >> 5;
+  uint16_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (32 - a)) >> 5;
+  return (r << 11) | (g << 5) | b;
+}
+
+// Konstante Farbe mit Alpha a über n Pixel (Tönung, Fade einer Fläche)
+void blendFill565(uint16_t* dst, uint16_t color, uint16_t n, uint8_t a);
+
+// Sprite-Zeile mit einem Alpha für das ganze Sprite, Transparent-Key bleibt liegen
+void blendRow565(uint16_t* dst, const uint16_t* src, uint16_t n, uint8_t a);
+
+// Sprite-Zeile mit Alpha pro Pixel (alpha[i] 0..32), Transparent-Key bleibt liegen
+void blendRowMap565(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, uint16_t n);
@@ -1,32 +1,22 @@
 #include "bubbles.h"
 #include "gfx.h"
-#include "sprites/small_bubble.h"
-#include "sprites/medium_bubble.h"
-
-// Access to background canvas for restore
-extern GFXcanvas16* bgCanvas;
-extern bool gNoCanvas;
-
-static inline void restorePlayAreaRegion(int16_t x, int16_t y, uint16_t w, uint16_t h) {
-  int16_t rx = max<int16_t>(x, PLAY_AREA_X);
-  int16_t ry = max<int16_t>(y, PLAY_AREA_Y);
-  int16_t rmaxx = min<int16_t>(x + w, PLAY_AREA_X + PLAY_AREA_W);
-  int16_t rmaxy = min<int16_t>(y + h, PLAY_AREA_Y + PLAY_AREA_H);
-  if (rmaxx > rx && rmaxy > ry) restoreRegion(rx, ry, rmaxx - rx, rmaxy - ry);
-}
+#include "render_list.h"
+#include "sim_clock.h"
+#include "sprites/small_bubble_spans.h"
+#include "sprites/medium_bubble_spans.h"
 
 struct Bubble {
   int16_t x;
   float   y;
+  float   prevY;   // y vor dem letzten Simulationsschritt
   float   speed;
   bool    big;
-  float   prevX;
-  float   prevY;
   bool    active;
 };
 
 constexpr uint8_t NUM_BUBBLES = 10;
 static Bubble bubbles[NUM_BUBBLES];
+static_assert(NUM_BUBBLES <= RID_PARTICLE - RID_BUBBLE, "bubble ids overlap particle ids");
 
 // Two independent timers
 static float fishTimerSec = 0.0f;
@@ -58,10 +48,9 @@ static void spawnBubbleAt(int16_t x, int16_t y, bool big) {
   
   b->x = x;
   b->y = y;
+  b->prevY = y;
   b->speed = 30.0f + random(0, 31);
   b->big = big;
-  b->prevX = -1;
-  b->prevY = -1;
   b->active = true;
 }
 
@@ -79,112 +68,70 @@ void initBubbles() {
   floorTimerSec = nextSpawnIntervalSec();
 }
 
-void restoreBubblesRegion() {
-  // No longer needed - full play-area redraw handles this
-}
-
-void updateAndDrawBubbles(float dtSec) {
-  FramePhase phase = getFramePhase();
+void updateBubbles(float dtSec) {
+  // Fish timer (spawn 1-2 small bubbles at fish position every 30-60s)
+  if (fishOriginX >= 0 && dtSec > 0) {
+    fishTimerSec -= dtSec;
+    if (fishTimerSec <= 0.0f) {
+      int count = 1 + random(0, 2);
+      for (int i = 0; i < count; ++i) {
+        int16_t xOffset = random(-8, 9);
+        spawnBubbleAt(fishOriginX + xOffset, fishOriginY, false);
+      }
+      fishTimerSec = nextSpawnIntervalSec();
+    }
+  }
   
-  // COLLECT phase: Update physics and register dirty rects
-  if (phase == PHASE_COLLECT) {
-    // Fish timer (spawn 1-2 small bubbles at fish position every 30-60s)
-    if (fishOriginX >= 0 && dtSec > 0) {
-      fishTimerSec -= dtSec;
-      if (fishTimerSec <= 0.0f) {
-        int count = 1 + random(0, 2);
-        for (int i = 0; i < count; ++i) {
-          int16_t xOffset = random(-8, 9);
-          spawnBubbleAt(fishOriginX + xOffset, fishOriginY, false);
-        }
-        fishTimerSec = nextSpawnIntervalSec();
+  // Floor timer
+  if (dtSec > 0) {
+    floorTimerSec -= dtSec;
+    if (floorTimerSec <= 0.0f) {
+      int16_t floorY = PLAY_AREA_Y + PLAY_AREA_H + 10;
+      for (int i = 0; i < 2; ++i) {
+        int16_t x = PLAY_AREA_X + random(0, PLAY_AREA_W - SMALL_BUBBLE_WIDTH);
+        spawnBubbleAt(x, floorY, false);
+      }
+      int mediumCount = 1 + random(0, 2);
+      for (int i = 0; i < mediumCount; ++i) {
+        int16_t x = PLAY_AREA_X + random(0, PLAY_AREA_W - MEDIUM_BUBBLE_WIDTH);
+        spawnBubbleAt(x, floorY, true);
       }
+      floorTimerSec = nextSpawnIntervalSec();
     }
+  }
+  
+  // Update positions
+  for (uint8_t i = 0; i < NUM_BUBBLES; ++i) {
+    Bubble &b = bubbles[i];
+    if (!b.active) continue;
     
-    // Floor timer
+    uint16_t h = b.big ? MEDIUM_BUBBLE_HEIGHT : SMALL_BUBBLE_HEIGHT;
+    
+    b.prevY = b.y;
     if (dtSec > 0) {
-      floorTimerSec -= dtSec;
-      if (floorTimerSec <= 0.0f) {
-        int16_t floorY = PLAY_AREA_Y + PLAY_AREA_H + 10;
-        for (int i = 0; i < 2; ++i) {
-          int16_t x = PLAY_AREA_X + random(0, PLAY_AREA_W - SMALL_BUBBLE_WIDTH);
-          spawnBubbleAt(x, floorY, false);
-        }
-        int mediumCount = 1 + random(0, 2);
-        for (int i = 0; i < mediumCount; ++i) {
-          int16_t x = PLAY_AREA_X + random(0, PLAY_AREA_W - MEDIUM_BUBBLE_WIDTH);
-          spawnBubbleAt(x, floorY, true);
-        }
-        floorTimerSec = nextSpawnIntervalSec();
-      }
+      b.y -= b.speed * dtSec;
     }
-    
-    // Update positions and collect dirty rects
-    for (uint8_t i = 0; i < NUM_BUBBLES; ++i) {
-      Bubble &b = bubbles[i];
-      if (!b.active) continue;
-      
-      uint16_t w = b.big ? MEDIUM_BUBBLE_WIDTH : SMALL_BUBBLE_WIDTH;
-      uint16_t h = b.big ? MEDIUM_BUBBLE_HEIGHT : SMALL_BUBBLE_HEIGHT;
-      
-      if (dtSec > 0) {
-        b.y -= b.speed * dtSec;
-      }
 
-      int16_t drawY = (int16_t)b.y;
-      
-      // Deactivate when bubble moves above play area
-      if (drawY < PLAY_AREA_Y - h) {
-        // Register both current and previous positions to fully erase
-        if (b.prevX >= 0 && b.prevY >= 0) {
-          addDirtyRect(b.prevX, b.prevY, w, h);
-        }
-        addDirtyRect(b.x, drawY, w, h);  // Current position too
-        b.active = false;
-        b.prevX = -1;
-        b.prevY = -1;
-        continue;
-      }
-      
-      // Register dirty rect for visible bubbles
-      if (drawY >= PLAY_AREA_Y && drawY <= PLAY_AREA_Y + PLAY_AREA_H - h) {
-        addDirtyRectPair(b.x, drawY, w, h, b.prevX, b.prevY);
-      } else {
-        // Moving outside visible area but not deactivated yet
-        if (b.prevX >= 0 && b.prevY >= 0) {
-          addDirtyRect(b.prevX, b.prevY, w, h);
-        }
-        b.prevX = -1;
-        b.prevY = -1;
-      }
+    // Deactivate when bubble moves above play area
+    if ((int16_t)b.y < PLAY_AREA_Y - h) {
+      b.active = false;
     }
   }
-  // DRAW phase: Draw bubbles and commit positions
-  else if (phase == PHASE_DRAW) {
-    for (uint8_t i = 0; i < NUM_BUBBLES; ++i) {
-      Bubble &b = bubbles[i];
-      if (!b.active) continue;
-      
-      uint16_t w = b.big ? MEDIUM_BUBBLE_WIDTH : SMALL_BUBBLE_WIDTH;
-      uint16_t h = b.big ? MEDIUM_BUBBLE_HEIGHT : SMALL_BUBBLE_HEIGHT;
-      int16_t drawY = (int16_t)b.y;
-      int16_t minY = PLAY_AREA_Y;
-      int16_t maxY = PLAY_AREA_Y + PLAY_AREA_H - h;
-      
-      if (drawY >= minY && drawY <= maxY) {
-        // Draw bubble
-        if (b.big) {
-          drawSpriteBasic(medium_bubbleBitmap, MEDIUM_BUBBLE_WIDTH, MEDIUM_BUBBLE_HEIGHT,
-                          b.x, drawY);
-        } else {
-          drawSpriteBasic(small_bubbleBitmap, SMALL_BUBBLE_WIDTH, SMALL_BUBBLE_HEIGHT,
-                          b.x, drawY);
-        }
-        
-        // Commit current position for next frame
-        b.prevX = b.x;
-        b.prevY = drawY;
-      }
+}
+
+void drawBubbles(float alpha) {
+  // Submit visible bubbles (erasing the old position is up to the render list)
+  for (uint8_t i = 0; i < NUM_BUBBLES; ++i) {
+    Bubble &b = bubbles[i];
+    if (!b.active) continue;
+
+    uint16_t h = b.big ? MEDIUM_BUBBLE_HEIGHT : SMALL_BUBBLE_HEIGHT;
+    int16_t drawY = (int16_t)simLerp(b.prevY, b.y, alpha);
+
+    if (drawY >= PLAY_AREA_Y && drawY <= PLAY_AREA_Y + PLAY_AREA_H - h) {
+      renderSubmitSpans(RID_BUBBLE + i, LAYER_BUBBLES,
+                        b.big ? medium_bubbleBitmapSpans : small_bubbleBitmapSpans,
+                        b.x, drawY, false);
     }
   }
 }
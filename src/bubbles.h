@@ -4,11 +4,12 @@
 // Initialize bubbles
 void initBubbles();
 
-// Restore bubble regions (call during RESTORE phase)
-void restoreBubblesRegion();
+// Advance spawn timers and positions by one simulation step
+void updateBubbles(float dtSec);
 
-// Update and draw all bubbles (call during DRAW phase)
-void updateAndDrawBubbles(float dtSec);
+// Submit visible bubbles to the render list, interpolated between the last
+// two simulation steps (call during COLLECT phase)
+void drawBubbles(float alpha);
 
 // Update fish origin used for fish bubble spawns (-1 disables fish spawns)
 void bubblesSetFishOrigin(int16_t x, int16_t y);
@@ -39,6 +39,9 @@ constexpr uint8_t PIN_BTN_OK = 3;
 constexpr uint8_t PIN_BTN_RIGHT = 4;
 #endif
 
+// SPI-Takt des Displays (auch Basis für die Busbelegung in DEBUG_SPI_STATS)
+constexpr uint32_t SPI_CLOCK_HZ = 40000000;
+
 // Farben (kannst du später anpassen)
 const uint16_t COLOR_BG = 0x0000;         // Schwarz
 const uint16_t COLOR_WATER = 0x0010;      // dunkles Blau
@@ -60,6 +63,85 @@ constexpr float DT_EMA_ALPHA = 0.2f;  // EMA smoothing weight
 //#define DEBUG_GRAPHICS     // Comment out to disable graphics debug output
 //#define DEBUG_SPRITES      // Comment out to disable sprite debug output
 //#define DEBUG_GAME_LOGIC   // Comment out to disable game logic debug output
+//#define DEBUG_SPI_STATS    // SPI-Byte-/Window-/Transaktionszähler pro Frame
+//#define DEBUG_FRAME_GOVERNOR // Ratenwechsel des Frame-Governors ausgeben
+//#define DEBUG_FRAME_PROFILER // Stufenzeiten pro Frame, Report mit 'p' über Serial/BLE
 
 // A/B Test toggles
 //#define DISABLE_BUBBLES  // Uncomment to test without bubbles
+
+// Render-Modus: Dirty-Rects im RAM zusammensetzen (Hintergrund + Sprites)
+// und jedes Rect mit einem einzigen Address-Window senden. Auskommentieren
+// für den alten Restore-then-Draw-Pfad direkt aufs Display.
+#define COMPOSE_DIRTY_RECTS
+constexpr uint8_t COMPOSE_STRIP_ROWS = 8;   // Zeilen pro Staging-Strip (8 x 320 x 2 = 5 KB)
+
+// Kostenmodell für mergeDirtyRects(), in Pixeln: ein zusätzliches Window
+// kostet CASET/RASET/RAMWR (11 Byte), das Umschalten von DC und das
+// Leerlaufen der Staging-Pipeline in spiFlushWindow() (~13 us bei 40 MHz).
+// Zwei Rects werden vereinigt, wenn die Zusatzpixel unter diesem Wert liegen.
+constexpr uint16_t DIRTY_WINDOW_COST_PX = 32;
+// Erreichen die Rect-Kosten diesen Anteil (%) der Kosten der ganzen
+// Play-Area, wird stattdessen die ganze Fläche in einem Window gesendet
+constexpr uint8_t DIRTY_FULL_AREA_PERCENT = 85;
+
+// Alternative Schadensverfolgung: Bitset über DIRTY_TILE_SIZE x DIRTY_TILE_SIZE
+// Kacheln der Play-Area statt Rect-Liste. addDirtyRect() setzt Bits,
+// mergeDirtyRects() erzeugt daraus Kachel-Läufe. Aufwand unabhängig von der
+// Anzahl der Sprites/Partikel, dafür bis zu einer Kachel Verschnitt pro Rand.
+//#define DIRTY_TILE_BITMAP
+constexpr uint8_t DIRTY_TILE_SIZE = 8;  // >= 5 (max. 64 Kacheln pro Zeile)
+
+// Hintergrund als Kachelspeicher statt 108-KB-Canvas (bg_tiles.h). Auf ESP32
+// automatisch, wenn der Canvas nicht alloziert werden kann; mit dem Schalter
+// immer (z.B. zum Testen auf Teensy/Host).
+//#define BACKGROUND_TILES
+constexpr uint32_t BG_TILE_POOL_BYTES = 28672;  // Aufbau-Puffer, danach auf die belegte Größe (~24 KB) gekürzt
+
+// Seed für Sandtextur/Schaumkante. 0 = beim ersten Aufbau zufällig wählen;
+// fester Wert = bei jedem Start derselbe Boden (z.B. für Referenzbilder).
+constexpr uint32_t ENVIRONMENT_SEED = 0;
+
+// Teensy 4.1: Staging-Strips per LPSPI-DMA senden (Ping-Pong, 2 x 5 KB).
+// Ohne den Schalter (und immer auf ESP32) wird synchron gesendet.
+//#define SPI_FLUSH_DMA
+
+// Pixel im Speicher in ST7789-Reihenfolge (High-Byte zuerst): Sprite-Daten,
+// bgCanvas, Hintergrundkacheln und Staging-Puffer gehen ohne Tausch pro
+// Pixel auf den Bus (writePixels(..., bigEndian), DMA ohne Swap-Schleife).
+// Farbkonstanten bleiben logisches RGB565, px565() in sprite_common.h wandelt.
+//#define WIRE_ORDER_PIXELS
+
+// Frame-Governor: Bildrate aus der Bewegung in der Render-Liste und der
+// letzten Eingabe statt fest 30 FPS. Gewählt wird die langsamste Rate, bei
+// der sich pro Frame höchstens FRAME_GOV_PX_PER_FRAME Pixel bewegen; eine
+// Taste oder ein BLE-Write schaltet sofort auf die schnellste Rate.
+// Auskommentieren für feste FRAME_GOV_RATES_HZ[FRAME_GOV_DEFAULT_LEVEL].
+#define FRAME_GOVERNOR
+constexpr uint8_t FRAME_GOV_NUM_RATES = 4;
+constexpr uint8_t FRAME_GOV_RATES_HZ[FRAME_GOV_NUM_RATES] = {60, 30, 15, 5};  // schnell -> langsam
+constexpr uint8_t FRAME_GOV_DEFAULT_LEVEL = 1;       // 30 Hz
+constexpr float FRAME_GOV_PX_PER_FRAME = 4.0f;     // 30 Hz bis 120 px/s (schwimmender Fisch)
+constexpr uint8_t FRAME_GOV_CHANGE_PX = 2;           // Frame-/Flip-Wechsel, Auf-/Abtauchen zählt wie 2 px Weg
+constexpr uint32_t FRAME_GOV_WINDOW_MS = 250;        // Mittelungsfenster für die Bewegung
+constexpr uint32_t FRAME_GOV_INPUT_HOLD_MS = 2000;   // so lange nach einer Eingabe volle Rate
+constexpr uint32_t FRAME_GOV_DOWNSHIFT_MS = 1000;    // so lange ruhig, bevor eine Stufe langsamer
+constexpr uint32_t FRAME_GOV_SLICE_US = 10000;       // Warten in Scheiben, Eingabe bricht ab
+
+// Feste Simulationsrate: Fisch, Shrimp, Blasen, Partikel, Schmutz und die
+// Animationsphase rechnen in SIM_DT-Schritten aus einem Akkumulator, das
+// Zeichnen interpoliert zwischen den letzten beiden Schritten. Die Bewegung
+// hängt so nicht mehr von der Bildrate des Governors ab. Auskommentieren für
+// einen Schritt pro Frame mit der geglätteten Frame-Zeit.
+#define FIXED_TIMESTEP
+constexpr uint8_t SIM_HZ = 50;
+constexpr float SIM_DT = 1.0f / SIM_HZ;
+constexpr uint8_t SIM_MAX_STEPS = 12;   // Aufholen bis 240 ms pro Frame (5 FPS + Luft), Rest verfällt
+
+// ESP32: Simulation als eigener Task auf Kern 0, Rendern und SPI in loop()
+// auf Kern 1 (frame_pipeline.h). Der Host nimmt dafür einen std::thread,
+// Teensy rechnet weiter alles nacheinander. Das Bild liegt einen Frame
+// hinter der Simulation.
+//#define DUAL_CORE_PIPELINE
+constexpr uint32_t PIPELINE_TASK_STACK = 8192;   // Bytes (ESP-IDF zählt in Bytes)
+constexpr uint8_t PIPELINE_TASK_PRIORITY = 1;    // wie der Arduino-loop()-Task
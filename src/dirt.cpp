@@ -4,7 +4,9 @@
 #include "sprites/dirt_spots.h"
 #include "particles.h"
 #include "environment.h"
+#include "blend565.h"
 #include <math.h>
+#include <string.h>
 
 extern GFXcanvas16* bgCanvas;
 extern bool gNoCanvas;
@@ -16,53 +18,120 @@ constexpr float MIN_SPAWN_INTERVAL = 45.0f;
 constexpr float MAX_SPAWN_INTERVAL = 90.0f;
 static float nextSpawnTime = 60.0f;
 
-static uint8_t getStippleLevel(uint8_t strength) {
-  if (strength > 75) return 4;  // 100%
-  if (strength > 50) return 3;  // 75%
-  if (strength > 25) return 2;  // 50%
-  return 1;  // 25%
+// Deckkraft aus der Stärke: frische Spots (15) schon gut sichtbar,
+// ab 75 voll deckend
+static uint8_t dirtAlpha(uint8_t strength) {
+  return (uint8_t)min((int)BLEND_ALPHA_OPAQUE, (strength + 25) * BLEND_ALPHA_OPAQUE / 100);
 }
 
-static bool shouldDrawDirtPixel(int16_t x, int16_t y, uint8_t level) {
-  uint8_t pat = (x ^ y) & 3;
-  if (level == 4) return true;
-  if (level == 3) return pat != 3;
-  if (level == 2) return pat < 2;
-  return pat == 0;
+// Spot-Zeile y im Bereich [x0, x1) auf dst (= Pixel x0) blenden
+static void blendDirtRow(const DirtSpot& spot, int16_t x0, int16_t x1, int16_t y, uint16_t* dst) {
+  const uint16_t* sprite = getDirtSprite(spot.kind);
+  blendRow565(dst, sprite + (y - spot.y) * DIRT_SPOT_SIZE + (x0 - spot.x), x1 - x0,
+              dirtAlpha(spot.strength));
 }
 
-static void drawDirtToCanvas(uint8_t spotIndex) {
-  if (!bgCanvas || gNoCanvas) return;
-  if (!gDirtSpots[spotIndex].active) return;
-  
-  const uint16_t* sprite = getDirtSprite(gDirtSpots[spotIndex].kind);
-  int16_t x = gDirtSpots[spotIndex].x;
-  int16_t y = gDirtSpots[spotIndex].y;
-  uint8_t stippleLevel = getStippleLevel(gDirtSpots[spotIndex].strength);
-  
-  for (int16_t dy = 0; dy < DIRT_SPOT_SIZE; dy++) {
-    for (int16_t dx = 0; dx < DIRT_SPOT_SIZE; dx++) {
-      int16_t px = x + dx;
-      int16_t py = y + dy;
-      
-      if (px < 0 || px >= TFT_WIDTH || py < 0 || py >= TFT_HEIGHT) continue;
-      
-      uint16_t color = pgm_read_word(&sprite[dy * DIRT_SPOT_SIZE + dx]);
-      
-      if (isTransparent16(color)) continue;
-      
-      if (shouldDrawDirtPixel(px, py, stippleLevel)) {
-        bgCanvas->drawPixel(px, py, color);
+// ---- Hintergrund-Schichten ----
+// Environment (unverschmutzt) + Dirt-Overlay. Mit Canvas wird das Overlay
+// ins Canvas gezeichnet und beim Entfernen nur die 8x8-Box aus der
+// unverschmutzten Schicht zurückkopiert; im Kachelmodus legt
+// drawDirtOverlayRow() es beim Dekodieren darüber.
+//
+// Die Simulation ändert nur gDirtSpots, der FrameSnapshot trägt eine Kopie
+// (dirtSnapshot()). Canvas und Overlay gehören dem Render-Teil: er gleicht
+// in dirtApplySnapshot() die gezeigte Tabelle mit dem Snapshot ab.
+static DirtSpot shownSpots[MAX_DIRT_SPOTS];
+
+// Sieht der Spot anders aus als gezeigt? (timeAlive zählt nicht)
+static bool sameLook(const DirtSpot& a, const DirtSpot& b) {
+  if (a.active != b.active) return false;
+  if (!a.active) return true;
+  return a.x == b.x && a.y == b.y && a.kind == b.kind && a.strength == b.strength;
+}
+
+// Einen Spot ins Canvas blenden, auf die Box [bx0, bx1) x [by0, by1) geclippt
+static void paintDirtSpot(const DirtSpot& spot, int16_t bx0, int16_t by0, int16_t bx1, int16_t by1) {
+  int16_t x0 = max(max(bx0, spot.x), (int16_t)0);
+  int16_t x1 = min(min(bx1, (int16_t)(spot.x + DIRT_SPOT_SIZE)), TFT_WIDTH);
+  int16_t y0 = max(max(by0, spot.y), (int16_t)0);
+  int16_t y1 = min(min(by1, (int16_t)(spot.y + DIRT_SPOT_SIZE)), TFT_HEIGHT);
+  for (int16_t py = y0; py < y1 && x0 < x1; py++) {
+    blendDirtRow(spot, x0, x1, py, bgCanvas->getBuffer() + py * TFT_WIDTH + x0);
+  }
+}
+
+// Box bei (x, y) neu aufbauen und zum Senden vormerken: unverschmutzte
+// Schicht, dann alle gezeigten Spots in Index-Reihenfolge darüber. Geblendet
+// wird immer auf den sauberen Hintergrund, sonst würde ein wachsender Spot
+// bei jedem Neuzeichnen dunkler.
+// false = keine unverschmutzte Schicht, der Aufrufer muss selbst sorgen.
+static bool refreshDirtBox(int16_t x, int16_t y) {
+  addDirtyRect(x, y, DIRT_SPOT_SIZE, DIRT_SPOT_SIZE);
+  if (!bgCanvas || gNoCanvas) return true;
+
+  if (!restoreBackgroundPristine(x, y, DIRT_SPOT_SIZE, DIRT_SPOT_SIZE)) return false;
+  for (uint8_t j = 0; j < MAX_DIRT_SPOTS; j++) {
+    if (shownSpots[j].active) {
+      paintDirtSpot(shownSpots[j], x, y, x + DIRT_SPOT_SIZE, y + DIRT_SPOT_SIZE);
+    }
+  }
+  return true;
+}
+
+void dirtSnapshot(DirtSpot* out) {
+  memcpy(out, gDirtSpots, sizeof(gDirtSpots));
+}
+
+void dirtApplySnapshot(const DirtSpot* spots) {
+  bool pristineOk = true;
+  for (uint8_t i = 0; i < MAX_DIRT_SPOTS; i++) {
+    if (sameLook(shownSpots[i], spots[i])) continue;
+
+    DirtSpot old = shownSpots[i];
+    shownSpots[i] = spots[i];
+    const DirtSpot& spot = shownSpots[i];
+
+    // Entfernt oder Slot neu belegt: alte Box ohne den Spot
+    if (old.active && (!spot.active || old.x != spot.x || old.y != spot.y)) {
+      pristineOk &= refreshDirtBox(old.x, old.y);
+    }
+    if (spot.active && !refreshDirtBox(spot.x, spot.y)) {
+      // Ohne unverschmutzte Schicht nur drüberblenden (ein wachsender Spot
+      // wird dabei etwas kräftiger als vorgesehen)
+      paintDirtSpot(spot, spot.x, spot.y, spot.x + DIRT_SPOT_SIZE, spot.y + DIRT_SPOT_SIZE);
+    }
+  }
+
+  // Fallback ohne unverschmutzte Schicht: Canvas komplett neu rendern,
+  // die verbliebenen Spots wieder darüber
+  if (!pristineOk) {
+    rebuildBackground();
+    for (uint8_t i = 0; i < MAX_DIRT_SPOTS; i++) {
+      const DirtSpot& spot = shownSpots[i];
+      if (spot.active && bgCanvas) {
+        paintDirtSpot(spot, spot.x, spot.y, spot.x + DIRT_SPOT_SIZE, spot.y + DIRT_SPOT_SIZE);
       }
     }
   }
 }
 
+void drawDirtOverlayRow(int16_t x, int16_t y, int16_t w, uint16_t* dst) {
+  for (uint8_t i = 0; i < MAX_DIRT_SPOTS; i++) {
+    const DirtSpot& spot = shownSpots[i];
+    if (!spot.active || y < spot.y || y >= spot.y + (int16_t)DIRT_SPOT_SIZE) continue;
+
+    int16_t x0 = max(x, spot.x);
+    int16_t x1 = min((int16_t)(x + w), (int16_t)(spot.x + DIRT_SPOT_SIZE));
+    if (x0 < x1) blendDirtRow(spot, x0, x1, y, dst + (x0 - x));
+  }
+}
+
 void initDirt() {
   for (uint8_t i = 0; i < MAX_DIRT_SPOTS; i++) {
     gDirtSpots[i].active = false;
     gDirtSpots[i].timeAlive = 0.0f;
     gDirtSpots[i].strength = 0;
+    shownSpots[i] = gDirtSpots[i];
   }
   spawnAccumulator = 0.0f;
   nextSpawnTime = random(MIN_SPAWN_INTERVAL * 10, MAX_SPAWN_INTERVAL * 10) / 10.0f;
@@ -77,14 +146,8 @@ void updateDirt(float deltaTime) {
     
     // Gradually increase strength over time (max 100)
     if (gDirtSpots[i].strength < 100) {
-      uint8_t oldStrength = gDirtSpots[i].strength;
       float growthRate = 2.0f; // units per second
       gDirtSpots[i].strength = min(100, gDirtSpots[i].strength + (uint8_t)(growthRate * deltaTime));
-      
-      // Redraw to canvas when strength changes
-      if (gDirtSpots[i].strength != oldStrength) {
-        drawDirtToCanvas(i);
-      }
     }
   }
   
@@ -107,9 +170,6 @@ void updateDirt(float deltaTime) {
         int16_t margin = 20;
         gDirtSpots[i].x = PLAY_AREA_X + margin + random(0, max(10, PLAY_AREA_W - margin * 2));
         gDirtSpots[i].y = PLAY_AREA_Y + margin + random(0, max(10, PLAY_AREA_H - 50 - margin));
-        
-        // Draw to canvas immediately
-        drawDirtToCanvas(i);
         break;
       }
     }
@@ -117,7 +177,7 @@ void updateDirt(float deltaTime) {
 }
 
 void drawDirt() {
-  // Dirt is now drawn directly to bgCanvas when spawned/updated
+  // Dirt is drawn into bgCanvas by dirtApplySnapshot()
   // This function is kept for compatibility but does nothing
 }
 
@@ -125,18 +185,12 @@ void cleanDirt() {
   for (uint8_t i = 0; i < MAX_DIRT_SPOTS; i++) {
     if (!gDirtSpots[i].active) continue;
     
-    // Remove all dirt spots completely
+    // Remove all dirt spots completely (der Render-Teil setzt nur die 8x8-Box zurück)
     gDirtSpots[i].active = false;
     spawnDirtPuff(gDirtSpots[i].x + DIRT_SPOT_SIZE / 2, 
                   gDirtSpots[i].y + DIRT_SPOT_SIZE / 2, 
                   6);
   }
-  
-  // Redraw background canvas to remove dirt
-  if (bgCanvas && !gNoCanvas) {
-    bgCanvas->fillScreen(COLOR_BG);
-    drawEnvironmentToCanvas(bgCanvas);
-  }
 }
 
 void spawnPoopSpot(int16_t x) {
@@ -165,9 +219,6 @@ void spawnPoopSpot(int16_t x) {
       gDirtSpots[i].y = constrain(poopY,
                                   (int16_t)(groundY - DIRT_SPOT_SIZE - 10),
                                   (int16_t)(groundY - DIRT_SPOT_SIZE));
-      
-      // Draw to canvas immediately
-      drawDirtToCanvas(i);
       break;
     }
   }
@@ -17,3 +17,13 @@ void drawDirt();
 void cleanDirt();  // Remove all spots when cleaning action triggered
 void spawnPoopSpot(int16_t x);  // Spawn poop spot after feeding
 uint8_t getTotalDirtLevel();  // Sum of all strengths (for status)
+
+// Simulation: aktuelle Spot-Tabelle in den Frame-Snapshot kopieren
+void dirtSnapshot(DirtSpot* out);
+
+// Render-Teil (COLLECT): Spots des Snapshots übernehmen, Boxen geänderter
+// Spots im Canvas neu aufbauen und als Dirty-Rect vormerken
+void dirtApplySnapshot(const DirtSpot* spots);
+
+// Dirt-Overlay über eine Hintergrundzeile legen (Kachelmodus ohne Canvas)
+void drawDirtOverlayRow(int16_t x, int16_t y, int16_t w, uint16_t* dst);
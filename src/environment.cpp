@@ -2,9 +2,9 @@
 #include "sprite_common.h"
 
 // Sprite-Header
-#include "sprites/stone.h"
-#include "sprites/kelp.h"
-#include "sprites/corals.h"
+#include "sprites/stone_indexed.h"
+#include "sprites/kelp_indexed.h"
+#include "sprites/corals_indexed.h"
 #include "sprites/anemone_green.h"
 
 // Seepferdchen-Basisposition wird in main festgelegt
@@ -27,25 +27,41 @@ static uint16_t interpolateColor(uint16_t color1, uint16_t color2, float t) {
   return (r << 11) | (g << 5) | b;
 }
 
-static void drawSandTexture(GFXcanvas16* canvas, int16_t x, int16_t y, int16_t w, int16_t h) {
+// Eigener Zufallsgenerator (xorshift32) für die Umgebung: gleicher Seed =
+// gleicher Sand, unabhängig davon, was sonst random() verbraucht
+struct EnvRandom {
+  uint32_t state;
+  explicit EnvRandom(uint32_t seed) : state(seed ? seed : 0x9E3779B9u) {}
+
+  // wie random(lo, hi): lo <= r < hi
+  int32_t range(int32_t lo, int32_t hi) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return lo + (int32_t)(state % (uint32_t)(hi - lo));
+  }
+};
+
+static void drawSandTexture(GFXcanvas16* canvas, EnvRandom& rng, int16_t x, int16_t y, int16_t w, int16_t h) {
   for (int i = 0; i < (w * h) / 8; i++) {
-    int16_t px = x + random(0, w);
-    int16_t py = y + random(0, h);
+    int16_t px = x + rng.range(0, w);
+    int16_t py = y + rng.range(0, h);
     if (px >= 0 && px < TFT_WIDTH && py >= 0 && py < TFT_HEIGHT) {
-      uint16_t color = (random(0, 100) < 70) ? COLOR_SAND_DARK : 0xDDB5;
+      uint16_t color = (rng.range(0, 100) < 70) ? COLOR_SAND_DARK : 0xDDB5;
       canvas->drawPixel(px, py, color);
     }
   }
   
   for (int i = 0; i < 8; i++) {
-    int16_t px = x + random(5, w - 5);
-    int16_t py = y + random(2, h - 2);
+    int16_t px = x + rng.range(5, w - 5);
+    int16_t py = y + rng.range(2, h - 2);
     uint16_t pebbleColor = 0xC618;
     canvas->fillCircle(px, py, 1, pebbleColor);
   }
 }
 
-// Helper: Sprite ins Canvas zeichnen
+// Helper: Sprite ins Canvas zeichnen (gezeichnet wird logisch, siehe Ende
+// von drawEnvironmentToCanvas)
 static void drawSpriteToCanvas(GFXcanvas16* canvas, const uint16_t *bitmap, uint16_t w, uint16_t h, int16_t x, int16_t y) {
   for (uint16_t py = 0; py < h; ++py) {
     for (uint16_t px = 0; px < w; ++px) {
@@ -56,12 +72,33 @@ static void drawSpriteToCanvas(GFXcanvas16* canvas, const uint16_t *bitmap, uint
       int16_t sy = y + py;
       if (sx < 0 || sy < 0 || sx >= TFT_WIDTH || sy >= TFT_HEIGHT) continue;
       
-      canvas->drawPixel(sx, sy, color);
+      canvas->drawPixel(sx, sy, px565(color));
+    }
+  }
+}
+
+// Helper: palette-indiziertes Sprite ins Canvas zeichnen
+static void drawSpriteToCanvas(GFXcanvas16* canvas, const IndexedSprite& sprite, int16_t x, int16_t y) {
+  x += sprite.ox;
+  y += sprite.oy;
+  for (uint16_t py = 0; py < sprite.h; ++py) {
+    int16_t sy = y + py;
+    if (sy < 0 || sy >= TFT_HEIGHT) continue;
+
+    for (uint16_t px = 0; px < sprite.w; ++px) {
+      uint8_t index = indexedIndex(sprite, py * sprite.w + px);
+      if (index == 0) continue;
+
+      int16_t sx = x + px;
+      if (sx < 0 || sx >= TFT_WIDTH) continue;
+
+      canvas->drawPixel(sx, sy, px565(indexedColor(sprite, index)));
     }
   }
 }
 
-void drawEnvironmentToCanvas(GFXcanvas16* canvas) {
+void drawEnvironmentToCanvas(GFXcanvas16* canvas, uint32_t seed) {
+  EnvRandom rng(seed);
 #ifdef DEBUG_GRAPHICS
   Serial.println("[ENV] Drawing environment to canvas...");
 #endif
@@ -90,12 +127,12 @@ void drawEnvironmentToCanvas(GFXcanvas16* canvas) {
     canvas->drawFastHLine(PLAY_AREA_X, groundY + y, PLAY_AREA_W, color);
   }
 
-  drawSandTexture(canvas, PLAY_AREA_X, groundY, PLAY_AREA_W, groundH);
+  drawSandTexture(canvas, rng, PLAY_AREA_X, groundY, PLAY_AREA_W, groundH);
 
   for (int x = PLAY_AREA_X; x < PLAY_AREA_X + PLAY_AREA_W; x += 4) {
-    int offset = random(0, 3);
+    int offset = rng.range(0, 3);
     canvas->drawPixel(x + offset, groundY - 1, COLOR_SAND_LIGHT);
-    if (random(0, 100) < 40) {
+    if (rng.range(0, 100) < 40) {
       canvas->drawPixel(x + offset, groundY - 2, 0xFFFF);
     }
   }
@@ -106,75 +143,75 @@ void drawEnvironmentToCanvas(GFXcanvas16* canvas) {
 #endif
   
   // Multiple kelp plants (5-7) distributed across bottom
-  drawSpriteToCanvas(canvas, kelp2Bitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 1, groundY - KELP_HEIGHT + 4);
-  drawSpriteToCanvas(canvas, kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 10, groundY - KELP_HEIGHT + 6);
-  drawSpriteToCanvas(canvas, kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 140, groundY - KELP_HEIGHT + 5);
-  drawSpriteToCanvas(canvas, kelp2Bitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 150, groundY - KELP_HEIGHT + 7);
-  drawSpriteToCanvas(canvas, kelp2Bitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 160, groundY - KELP_HEIGHT + 4);
-  drawSpriteToCanvas(canvas, kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 170, groundY - KELP_HEIGHT + 4);
-  drawSpriteToCanvas(canvas, kelp2Bitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 180, groundY - KELP_HEIGHT + 6);
-  drawSpriteToCanvas(canvas, kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 190, groundY - KELP_HEIGHT + 5);
+  drawSpriteToCanvas(canvas, kelp2BitmapIdx, PLAY_AREA_X + 1, groundY - KELP_HEIGHT + 4);
+  drawSpriteToCanvas(canvas, kelpBitmapIdx, PLAY_AREA_X + 10, groundY - KELP_HEIGHT + 6);
+  drawSpriteToCanvas(canvas, kelpBitmapIdx, PLAY_AREA_X + 140, groundY - KELP_HEIGHT + 5);
+  drawSpriteToCanvas(canvas, kelp2BitmapIdx, PLAY_AREA_X + 150, groundY - KELP_HEIGHT + 7);
+  drawSpriteToCanvas(canvas, kelp2BitmapIdx, PLAY_AREA_X + 160, groundY - KELP_HEIGHT + 4);
+  drawSpriteToCanvas(canvas, kelpBitmapIdx, PLAY_AREA_X + 170, groundY - KELP_HEIGHT + 4);
+  drawSpriteToCanvas(canvas, kelp2BitmapIdx, PLAY_AREA_X + 180, groundY - KELP_HEIGHT + 6);
+  drawSpriteToCanvas(canvas, kelpBitmapIdx, PLAY_AREA_X + 190, groundY - KELP_HEIGHT + 5);
 #ifdef DEBUG_SPRITES
   Serial.println("[ENV] Kelp sprites drawn");
 #endif
 
   // Seaweed plants (5 instances) clustered together
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 20, groundY - SEAWEED_HEIGHT + 8);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 32, groundY - SEAWEED_HEIGHT + 10);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 44, groundY - SEAWEED_HEIGHT + 7);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 56, groundY - SEAWEED_HEIGHT + 9);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 68, groundY - SEAWEED_HEIGHT + 11);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 80, groundY - SEAWEED_HEIGHT + 7);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 92, groundY - SEAWEED_HEIGHT + 6);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 104, groundY - SEAWEED_HEIGHT + 7);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 116, groundY - SEAWEED_HEIGHT + 5);
-  drawSpriteToCanvas(canvas, seaweedBitmap, SEAWEED_WIDTH, SEAWEED_HEIGHT, PLAY_AREA_X + 128, groundY - SEAWEED_HEIGHT + 13);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 20, groundY - SEAWEED_HEIGHT + 8);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 32, groundY - SEAWEED_HEIGHT + 10);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 44, groundY - SEAWEED_HEIGHT + 7);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 56, groundY - SEAWEED_HEIGHT + 9);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 68, groundY - SEAWEED_HEIGHT + 11);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 80, groundY - SEAWEED_HEIGHT + 7);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 92, groundY - SEAWEED_HEIGHT + 6);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 104, groundY - SEAWEED_HEIGHT + 7);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 116, groundY - SEAWEED_HEIGHT + 5);
+  drawSpriteToCanvas(canvas, seaweedBitmapIdx, PLAY_AREA_X + 128, groundY - SEAWEED_HEIGHT + 13);
 #ifdef DEBUG_SPRITES
   Serial.println("[ENV] Seaweed sprites drawn");
 #endif
 
   // Multiple rocks at varying heights (3-5 rocks)
-  drawSpriteToCanvas(canvas, stone2Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 25, groundY + 10);
-  drawSpriteToCanvas(canvas, stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 65, groundY + 20);
-  drawSpriteToCanvas(canvas, stone3Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 85, groundY + 8);
-  drawSpriteToCanvas(canvas, stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 105, groundY + 8);
-  drawSpriteToCanvas(canvas, stone3Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 125, groundY );
-  drawSpriteToCanvas(canvas, stone2Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 135, groundY );
-  drawSpriteToCanvas(canvas, stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 155, groundY + 20);
-  drawSpriteToCanvas(canvas, stone3Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 165, groundY + 20);
-  drawSpriteToCanvas(canvas, stone2Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 175, groundY + 16);
-  drawSpriteToCanvas(canvas, stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 195, groundY +16);
-  drawSpriteToCanvas(canvas, stone3Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 205, groundY + 8);
-  drawSpriteToCanvas(canvas, stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 215, groundY + 8);
-  drawSpriteToCanvas(canvas, stone3Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 225, groundY + 6);
-  drawSpriteToCanvas(canvas, stone2Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 235, groundY );
-  drawSpriteToCanvas(canvas, stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 255, groundY + 20);
-  drawSpriteToCanvas(canvas, stone3Bitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 245, groundY + 2);
-
-  drawSpriteToCanvas(canvas, tube_coralBitmap, TUBE_CORAL_WIDTH, TUBE_CORAL_HEIGHT, PLAY_AREA_X + 200, groundY - TUBE_CORAL_HEIGHT+20);
-  drawSpriteToCanvas(canvas, brain_coralBitmap, BRAIN_CORAL_WIDTH, BRAIN_CORAL_HEIGHT, PLAY_AREA_X + 210, groundY - BRAIN_CORAL_HEIGHT + 15);
-  drawSpriteToCanvas(canvas, staghorn_coralBitmap, STAGHORN_CORAL_WIDTH, STAGHORN_CORAL_HEIGHT, PLAY_AREA_X + 220, groundY - STAGHORN_CORAL_HEIGHT + 7);
-  drawSpriteToCanvas(canvas, fan_coralBitmap, FAN_CORAL_WIDTH, FAN_CORAL_HEIGHT, PLAY_AREA_X + 230, groundY - FAN_CORAL_HEIGHT + 4);
-  drawSpriteToCanvas(canvas, tube_coralBitmap, TUBE_CORAL_WIDTH, TUBE_CORAL_HEIGHT, PLAY_AREA_X + 240, groundY - TUBE_CORAL_HEIGHT + 11);
+  drawSpriteToCanvas(canvas, stone2BitmapIdx, PLAY_AREA_X + 25, groundY + 10);
+  drawSpriteToCanvas(canvas, stoneBitmapIdx, PLAY_AREA_X + 65, groundY + 20);
+  drawSpriteToCanvas(canvas, stone3BitmapIdx, PLAY_AREA_X + 85, groundY + 8);
+  drawSpriteToCanvas(canvas, stoneBitmapIdx, PLAY_AREA_X + 105, groundY + 8);
+  drawSpriteToCanvas(canvas, stone3BitmapIdx, PLAY_AREA_X + 125, groundY );
+  drawSpriteToCanvas(canvas, stone2BitmapIdx, PLAY_AREA_X + 135, groundY );
+  drawSpriteToCanvas(canvas, stoneBitmapIdx, PLAY_AREA_X + 155, groundY + 20);
+  drawSpriteToCanvas(canvas, stone3BitmapIdx, PLAY_AREA_X + 165, groundY + 20);
+  drawSpriteToCanvas(canvas, stone2BitmapIdx, PLAY_AREA_X + 175, groundY + 16);
+  drawSpriteToCanvas(canvas, stoneBitmapIdx, PLAY_AREA_X + 195, groundY +16);
+  drawSpriteToCanvas(canvas, stone3BitmapIdx, PLAY_AREA_X + 205, groundY + 8);
+  drawSpriteToCanvas(canvas, stoneBitmapIdx, PLAY_AREA_X + 215, groundY + 8);
+  drawSpriteToCanvas(canvas, stone3BitmapIdx, PLAY_AREA_X + 225, groundY + 6);
+  drawSpriteToCanvas(canvas, stone2BitmapIdx, PLAY_AREA_X + 235, groundY );
+  drawSpriteToCanvas(canvas, stoneBitmapIdx, PLAY_AREA_X + 255, groundY + 20);
+  drawSpriteToCanvas(canvas, stone3BitmapIdx, PLAY_AREA_X + 245, groundY + 2);
+
+  drawSpriteToCanvas(canvas, tube_coralBitmapIdx, PLAY_AREA_X + 200, groundY - TUBE_CORAL_HEIGHT+20);
+  drawSpriteToCanvas(canvas, brain_coralBitmapIdx, PLAY_AREA_X + 210, groundY - BRAIN_CORAL_HEIGHT + 15);
+  drawSpriteToCanvas(canvas, staghorn_coralBitmapIdx, PLAY_AREA_X + 220, groundY - STAGHORN_CORAL_HEIGHT + 7);
+  drawSpriteToCanvas(canvas, fan_coralBitmapIdx, PLAY_AREA_X + 230, groundY - FAN_CORAL_HEIGHT + 4);
+  drawSpriteToCanvas(canvas, tube_coralBitmapIdx, PLAY_AREA_X + 240, groundY - TUBE_CORAL_HEIGHT + 11);
 
   // Distributed corals with proper spacing based on sprite widths
   const int16_t CORAL_GAP = 15;
 
   int16_t brainX = PLAY_AREA_X + 35;
   int16_t brainY = groundY - BRAIN_CORAL_HEIGHT + 4;
-  drawSpriteToCanvas(canvas, brain_coralBitmap, BRAIN_CORAL_WIDTH, BRAIN_CORAL_HEIGHT, brainX, brainY);
+  drawSpriteToCanvas(canvas, brain_coralBitmapIdx, brainX, brainY);
 
   int16_t fanX = brainX + BRAIN_CORAL_WIDTH + CORAL_GAP;
   int16_t fanY = groundY - FAN_CORAL_HEIGHT + 6;
-  drawSpriteToCanvas(canvas, fan_coralBitmap, FAN_CORAL_WIDTH, FAN_CORAL_HEIGHT, fanX, fanY);
+  drawSpriteToCanvas(canvas, fan_coralBitmapIdx, fanX, fanY);
 
   int16_t stagX = fanX + FAN_CORAL_WIDTH + CORAL_GAP;
   int16_t stagY = groundY - STAGHORN_CORAL_HEIGHT + 6;
-  drawSpriteToCanvas(canvas, staghorn_coralBitmap, STAGHORN_CORAL_WIDTH, STAGHORN_CORAL_HEIGHT, stagX, stagY);
+  drawSpriteToCanvas(canvas, staghorn_coralBitmapIdx, stagX, stagY);
 
   int16_t tubeX = stagX + STAGHORN_CORAL_WIDTH + CORAL_GAP;
   int16_t tubeY = groundY - TUBE_CORAL_HEIGHT + 20;
-  drawSpriteToCanvas(canvas, tube_coralBitmap, TUBE_CORAL_WIDTH, TUBE_CORAL_HEIGHT, tubeX, tubeY);
+  drawSpriteToCanvas(canvas, tube_coralBitmapIdx, tubeX, tubeY);
 
   int16_t anemoneX = PLAY_AREA_X + PLAY_AREA_W - ANEMONE_GREEN_WIDTH ;
   int16_t anemoneY = groundY - ANEMONE_GREEN_HEIGHT+25;
@@ -183,6 +220,12 @@ void drawEnvironmentToCanvas(GFXcanvas16* canvas) {
   Serial.println("[ENV] Corals and anemone sprite drawn");
   Serial.println("[ENV] All environment sprites loaded successfully!");
 #endif
+
+#ifdef WIRE_ORDER_PIXELS
+  // GFX-Primitive und Verläufe arbeiten logisch: einmal am Ende in
+  // Bus-Reihenfolge bringen (samt der vorher gefüllten Hintergrundfarbe)
+  canvas->byteSwap();
+#endif
 }
 
 void drawEnvironment() {
@@ -209,36 +252,36 @@ void drawEnvironment() {
 
   // --- Deko: Korallen, Kelp, Steine ---
   // Multiple kelp plants (5-7) distributed across bottom
-  drawSpriteBasic(kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 4, groundY - KELP_HEIGHT + 4);
-  drawSpriteBasic(kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 50, groundY - KELP_HEIGHT + 6);
-  drawSpriteBasic(kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 110, groundY - KELP_HEIGHT + 5);
-  drawSpriteBasic(kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 165, groundY - KELP_HEIGHT + 7);
-  drawSpriteBasic(kelpBitmap, KELP_WIDTH, KELP_HEIGHT, PLAY_AREA_X + 200, groundY - KELP_HEIGHT + 4);
+  drawSpriteIndexed(kelpBitmapIdx, PLAY_AREA_X + 4, groundY - KELP_HEIGHT + 4);
+  drawSpriteIndexed(kelpBitmapIdx, PLAY_AREA_X + 50, groundY - KELP_HEIGHT + 6);
+  drawSpriteIndexed(kelpBitmapIdx, PLAY_AREA_X + 110, groundY - KELP_HEIGHT + 5);
+  drawSpriteIndexed(kelpBitmapIdx, PLAY_AREA_X + 165, groundY - KELP_HEIGHT + 7);
+  drawSpriteIndexed(kelpBitmapIdx, PLAY_AREA_X + 200, groundY - KELP_HEIGHT + 4);
 
   // Multiple rocks at varying heights (3-5 rocks)
-  drawSpriteBasic(stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 25, groundY + 10);
-  drawSpriteBasic(stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 95, groundY + 6);
-  drawSpriteBasic(stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 145, groundY + 8);
-  drawSpriteBasic(stoneBitmap, STONE_WIDTH, STONE_HEIGHT, PLAY_AREA_X + 190, groundY + 12);
+  drawSpriteIndexed(stoneBitmapIdx, PLAY_AREA_X + 25, groundY + 10);
+  drawSpriteIndexed(stoneBitmapIdx, PLAY_AREA_X + 95, groundY + 6);
+  drawSpriteIndexed(stoneBitmapIdx, PLAY_AREA_X + 145, groundY + 8);
+  drawSpriteIndexed(stoneBitmapIdx, PLAY_AREA_X + 190, groundY + 12);
 
   // Distributed corals with proper spacing based on sprite widths
   const int16_t CORAL_GAP = 15;
 
   int16_t brainX = PLAY_AREA_X + 35;
   int16_t brainY = groundY - BRAIN_CORAL_HEIGHT + 4;
-  drawSpriteBasic(brain_coralBitmap, BRAIN_CORAL_WIDTH, BRAIN_CORAL_HEIGHT, brainX, brainY);
+  drawSpriteIndexed(brain_coralBitmapIdx, brainX, brainY);
 
   int16_t fanX = brainX + BRAIN_CORAL_WIDTH + CORAL_GAP;
   int16_t fanY = groundY - FAN_CORAL_HEIGHT + 6;
-  drawSpriteBasic(fan_coralBitmap, FAN_CORAL_WIDTH, FAN_CORAL_HEIGHT, fanX, fanY);
+  drawSpriteIndexed(fan_coralBitmapIdx, fanX, fanY);
 
   int16_t stagX = fanX + FAN_CORAL_WIDTH + CORAL_GAP;
   int16_t stagY = groundY - STAGHORN_CORAL_HEIGHT + 6;
-  drawSpriteBasic(staghorn_coralBitmap, STAGHORN_CORAL_WIDTH, STAGHORN_CORAL_HEIGHT, stagX, stagY);
+  drawSpriteIndexed(staghorn_coralBitmapIdx, stagX, stagY);
 
   int16_t tubeX = stagX + STAGHORN_CORAL_WIDTH + CORAL_GAP;
   int16_t tubeY = groundY - TUBE_CORAL_HEIGHT + 10;
-  drawSpriteBasic(tube_coralBitmap, TUBE_CORAL_WIDTH, TUBE_CORAL_HEIGHT, tubeX, tubeY);
+  drawSpriteIndexed(tube_coralBitmapIdx, tubeX, tubeY);
 
   int16_t anemoneX = PLAY_AREA_X + PLAY_AREA_W - ANEMONE_GREEN_WIDTH - 5;
   int16_t anemoneY = groundY - ANEMONE_GREEN_HEIGHT + 10;
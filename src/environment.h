@@ -4,8 +4,10 @@
 // Zeichnet Wasser, Sandboden und Korallen/Steine aufs TFT
 void drawEnvironment();
 
-// Zeichnet Wasser, Sandboden und Korallen/Steine ins Canvas
-void drawEnvironmentToCanvas(GFXcanvas16* canvas);
+// Zeichnet Wasser, Sandboden und Korallen/Steine ins Canvas.
+// Sandtextur und Schaumkante hängen nur von seed ab (kein random()).
+// Der ganze Canvas steht danach im Speicherformat (px565, sprite_common.h).
+void drawEnvironmentToCanvas(GFXcanvas16* canvas, uint32_t seed);
 
 // Get anemone position for sleeping fish
 void getAnemonePosition(int16_t& x, int16_t& y);
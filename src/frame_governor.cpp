@@ -0,0 +1,98 @@
+#include "frame_governor.h"
+#include "config.h"
+
+static uint8_t level = FRAME_GOV_DEFAULT_LEVEL;
+static bool pinnedRate = false;
+
+#ifdef FRAME_GOVERNOR
+static volatile bool inputPending = false;
+static bool inputSeen = false;
+static uint32_t lastInputMs = 0;
+static uint32_t levelSinceMs = 0;     // seit wann die gewünschte Stufe nicht langsamer ist
+// Bewegung über ein Fenster gemittelt: einzelne Frames springen wegen
+// Rundung auf ganze Pixel und Sprite-Wechseln stark
+static uint32_t windowPx = 0;
+static float windowSec = 0.0f;
+static float motionPxPerSec = 0.0f;
+#endif
+
+void governorNotifyInput() {
+#ifdef FRAME_GOVERNOR
+  inputPending = true;
+#endif
+}
+
+bool governorInputPending() {
+#ifdef FRAME_GOVERNOR
+  return inputPending && !pinnedRate;
+#else
+  return false;
+#endif
+}
+
+void governorUpdate(uint16_t motionPx, float dtSec) {
+#ifdef FRAME_GOVERNOR
+  uint32_t nowMs = millis();
+  if (inputPending) {
+    inputPending = false;
+    inputSeen = true;
+    lastInputMs = nowMs;
+  }
+
+  windowPx += motionPx;
+  windowSec += dtSec;
+  if (windowSec * 1000.0f >= FRAME_GOV_WINDOW_MS) {
+    motionPxPerSec = windowPx / windowSec;
+    windowPx = 0;
+    windowSec = 0.0f;
+  }
+
+  // Langsamste Rate, bei der die Bewegung pro Frame klein genug bleibt
+  uint8_t want = FRAME_GOV_NUM_RATES - 1;
+  while (want > 0 && motionPxPerSec > FRAME_GOV_PX_PER_FRAME * FRAME_GOV_RATES_HZ[want]) {
+    want--;
+  }
+  if (inputSeen && nowMs - lastInputMs < FRAME_GOV_INPUT_HOLD_MS) {
+    want = 0;
+  }
+
+  uint8_t prevLevel = level;
+  if (pinnedRate) {
+    level = FRAME_GOV_DEFAULT_LEVEL;
+  } else if (want < level) {
+    level = want;
+    levelSinceMs = nowMs;
+  } else if (want == level) {
+    levelSinceMs = nowMs;
+  } else if (nowMs - levelSinceMs >= FRAME_GOV_DOWNSHIFT_MS) {
+    level++;
+    levelSinceMs = nowMs;
+  }
+
+#ifdef DEBUG_FRAME_GOVERNOR
+  if (level != prevLevel) {
+    Serial.print("[GOV] ");
+    Serial.print(FRAME_GOV_RATES_HZ[prevLevel]);
+    Serial.print(" -> ");
+    Serial.print(FRAME_GOV_RATES_HZ[level]);
+    Serial.print(" Hz (motion ");
+    Serial.print(motionPxPerSec, 1);
+    Serial.println(" px/s)");
+  }
+#else
+  (void)prevLevel;
+#endif
+#else
+  (void)motionPx;
+  (void)dtSec;
+#endif
+}
+
+uint32_t governorFrameUs() {
+  return 1000000ul / FRAME_GOV_RATES_HZ[level];
+}
+
+void governorPin(bool pinned) {
+  pinnedRate = pinned;
+  if (pinned) level = FRAME_GOV_DEFAULT_LEVEL;
+}
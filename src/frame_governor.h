@@ -0,0 +1,28 @@
+#pragma once
+#include <Arduino.h>
+
+// ---- Frame-Governor ----
+// Wählt pro Frame die Bildrate (FRAME_GOV_RATES_HZ) aus der Bewegung in der
+// Render-Liste: die langsamste Rate, bei der sich pro Frame höchstens
+// FRAME_GOV_PX_PER_FRAME Pixel bewegen. Hochschalten sofort, Runterschalten
+// eine Stufe pro FRAME_GOV_DOWNSHIFT_MS. Nach einer Eingabe volle Rate für
+// FRAME_GOV_INPUT_HOLD_MS. Ohne FRAME_GOVERNOR fest die Default-Stufe.
+
+// Taste oder BLE-Write: nächster Frame sofort und mit voller Rate.
+// Darf aus dem BLE-Task aufgerufen werden.
+void governorNotifyInput();
+
+// true = seit dem letzten governorUpdate() kam eine Eingabe (Warten abbrechen)
+bool governorInputPending();
+
+// Einmal pro Frame nach dem Zeichnen: Bewegung dieses Frames (0 außerhalb
+// von MODE_ALIVE) und die Frame-Zeit in Sekunden
+void governorUpdate(uint16_t motionPx, float dtSec);
+
+// Periode des nächsten Frames in Mikrosekunden
+uint32_t governorFrameUs();
+
+// Fest auf FRAME_GOV_DEFAULT_LEVEL, Eingaben brechen das Warten nicht ab.
+// Host-Golden-Modus: die virtuelle Zeit hängt dann nicht mehr von den
+// SPI-Kosten ab, die Referenzbilder gelten für alle Render-Schalter.
+void governorPin(bool pinned);
@@ -0,0 +1,142 @@
+#include "frame_pipeline.h"
+#include "triple_buffer.h"
+
+static TripleBuffer<FrameSnapshot> snapshots;
+static FrameProducer produce = nullptr;
+
+// Simulation eines Frames auf der Schreiberseite des Dreifachpuffers
+static void produceFrame(float dtSec) {
+  FrameSnapshot& snap = snapshots.writeBuffer();
+  produce(snap, dtSec);
+  snapshots.publish();
+}
+
+#if defined(PIPELINE_THREADED) && defined(ESP32)
+
+// ---- ESP32: Simulations-Task auf Kern 0 (loop() läuft auf Kern 1) ----
+static TaskHandle_t simTask = nullptr;
+static SemaphoreHandle_t simDone = nullptr;
+static float simDt = 0.0f;          // vor dem Wecken gesetzt, danach nur vom Task gelesen
+static bool simBusy = false;        // nur Render-Seite
+
+static void simTaskMain(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    produceFrame(simDt);
+    xSemaphoreGive(simDone);
+  }
+}
+
+void pipelineBegin(FrameProducer producer) {
+  produce = producer;
+  // Erster Frame synchron: pipelineLatest() ist nie leer
+  produceFrame(0.0f);
+  snapshots.update();
+  simDone = xSemaphoreCreateBinary();
+  xTaskCreatePinnedToCore(simTaskMain, "sim", PIPELINE_TASK_STACK, nullptr,
+                          PIPELINE_TASK_PRIORITY, &simTask, 0);
+}
+
+void pipelineKick(float dtSec) {
+  pipelineDrain();
+  simDt = dtSec;
+  simBusy = true;
+  xTaskNotifyGive(simTask);
+}
+
+void pipelineDrain() {
+  if (!simBusy) return;
+  xSemaphoreTake(simDone, portMAX_DELAY);
+  simBusy = false;
+  snapshots.update();
+}
+
+#elif defined(PIPELINE_THREADED)
+
+// ---- Host: derselbe Handshake mit std::thread ----
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Bewusst nie zerstört: der Thread wartet beim Programmende noch darauf
+struct SimSync {
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+  bool requested = false;
+  bool busy = false;
+  float dt = 0.0f;
+};
+static SimSync* simSync = nullptr;
+static bool simKicked = false;      // nur Render-Seite
+
+static void simThreadMain() {
+  for (;;) {
+    float dt;
+    {
+      std::unique_lock<std::mutex> lock(simSync->mutex);
+      simSync->wake.wait(lock, [] { return simSync->requested; });
+      simSync->requested = false;
+      dt = simSync->dt;
+    }
+    produceFrame(dt);
+    {
+      std::lock_guard<std::mutex> lock(simSync->mutex);
+      simSync->busy = false;
+    }
+    simSync->done.notify_one();
+  }
+}
+
+void pipelineBegin(FrameProducer producer) {
+  produce = producer;
+  produceFrame(0.0f);
+  snapshots.update();
+  simSync = new SimSync();
+  std::thread(simThreadMain).detach();
+}
+
+void pipelineKick(float dtSec) {
+  pipelineDrain();
+  {
+    std::lock_guard<std::mutex> lock(simSync->mutex);
+    simSync->dt = dtSec;
+    simSync->requested = true;
+    simSync->busy = true;
+  }
+  simKicked = true;
+  simSync->wake.notify_one();
+}
+
+void pipelineDrain() {
+  if (!simKicked) return;
+  {
+    std::unique_lock<std::mutex> lock(simSync->mutex);
+    simSync->done.wait(lock, [] { return !simSync->busy; });
+  }
+  simKicked = false;
+  snapshots.update();
+}
+
+#else
+
+// ---- Ein Kern: Simulation direkt im Aufrufer ----
+void pipelineBegin(FrameProducer producer) {
+  produce = producer;
+}
+
+void pipelineKick(float dtSec) {
+  produceFrame(dtSec);
+  snapshots.update();
+}
+
+void pipelineDrain() {}
+
+#endif
+
+// Abgeholt wird nur in pipelineDrain() bzw. direkt nach der Simulation:
+// mit eigenem Task immer genau der Frame vor dem gerade angestoßenen,
+// egal wie schnell der Task ist
+const FrameSnapshot& pipelineLatest() {
+  return snapshots.readBuffer();
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+#include "render_list.h"
+#include "dirt.h"
+
+// ---- Frame-Pipeline: Simulation -> Snapshot -> Rendern ----
+// Die Simulation eines Frames (Schritte + Einreichen) schreibt einen
+// FrameSnapshot, der Render-Teil liest nur diesen. Übergabe über einen
+// lock-freien Dreifachpuffer (triple_buffer.h).
+//
+// Ohne DUAL_CORE_PIPELINE läuft die Simulation in pipelineKick() direkt
+// im Aufrufer, pipelineLatest() liefert denselben Frame. Mit dem Schalter
+// (ESP32: FreeRTOS-Task auf Kern 0, Host: std::thread) läuft sie parallel
+// zum Rendern: während Frame N gerendert und gesendet wird, entsteht
+// Frame N+1. Das Bild liegt dafür einen Frame hinter der Simulation.
+//
+// Ablauf pro loop():
+//   pipelineDrain();            // vorige Simulation fertig, Zustand ruhig
+//   ... Eingaben, Menü-/Pet-Logik (nur hier Zugriff auf den Modulzustand)
+//   pipelineKick(dtSec);        // nächste Simulation starten
+//   renderListCollectDirty(pipelineLatest().render); ...
+//
+// Parallel zum Rendern schreibt die Simulation nur eigenen Zustand und den
+// Snapshot.
+
+#if defined(DUAL_CORE_PIPELINE) && (defined(ESP32) || defined(NATIVE_BUILD))
+#define PIPELINE_THREADED
+constexpr uint8_t PIPELINE_LAG_FRAMES = 1;   // loop()-Durchläufe vom Simulieren bis zum Bild
+#else
+constexpr uint8_t PIPELINE_LAG_FRAMES = 0;
+#endif
+
+// Unveränderliches Ergebnis eines Simulationsframes
+struct FrameSnapshot {
+  RenderSnapshot render;      // Sprites
+  DirtSpot dirt[MAX_DIRT_SPOTS];  // Dirt-Tabelle, Canvas/Overlay patcht der Render-Teil
+  int hunger, fun, energy;    // Status-Bar
+  uint32_t simCycles;         // Dauer der Simulation (profilerCycles()), PROF_SIM bucht loop()
+};
+
+// Simuliert einen Frame um dtSec und reicht ihn in snap ein
+typedef void (*FrameProducer)(FrameSnapshot& snap, float dtSec);
+
+// Einmal in setup(): Producer setzen, ggf. Simulations-Task starten
+void pipelineBegin(FrameProducer producer);
+
+// Simulation des nächsten Frames anstoßen (wartet vorher auf die laufende)
+void pipelineKick(float dtSec);
+
+// Wartet, bis die angestoßene Simulation fertig ist. Danach darf der
+// Aufrufer Modulzustand lesen und schreiben (Menü, Pause, Speichern).
+void pipelineDrain();
+
+// Zuletzt fertig gewordener Snapshot: ohne DUAL_CORE_PIPELINE der aus dem
+// letzten pipelineKick(), sonst der aus dem Kick davor (gültig bis zum
+// nächsten pipelineDrain()/pipelineKick())
+const FrameSnapshot& pipelineLatest();
@@ -0,0 +1,207 @@
+#include "frame_profiler.h"
+
+#ifdef DEBUG_FRAME_PROFILER
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef NATIVE_BUILD
+#include <chrono>
+#endif
+
+static const char* const stageNames[PROF_STAGE_COUNT] = {
+  "buttons", "menuLogic", "petStats", "sim", "collect", "merge", "restore", "draw", "ui", "frame"
+};
+
+struct StageStats {
+  uint32_t frames;     // Frames, in denen die Stufe lief
+  uint64_t sumUs;
+  uint32_t maxUs;
+  uint32_t hist[PROF_BUCKETS];
+};
+
+static StageStats stats[PROF_STAGE_COUNT];
+// Nur loop() schreibt hier; PROF_SIM misst simulateFrame() selbst und
+// kommt über den Snapshot (mit DUAL_CORE_PIPELINE ein Frame später)
+static uint32_t frameCycles[PROF_STAGE_COUNT];
+static bool frameRan[PROF_STAGE_COUNT];
+static uint32_t frameStart = 0;
+static bool frameStarted = false;
+
+// Langsamster Frame seit dem letzten Reset, mit allen Stufen
+static uint32_t worstFrameUs = 0;
+static uint32_t worstStageUs[PROF_STAGE_COUNT];
+
+static volatile bool reportRequested = false;
+static volatile bool resetRequested = false;
+static void (*reportSink)(const char* line) = nullptr;
+
+// ---- Zyklenzähler ----
+static inline uint32_t cycleCount() {
+#if defined(NATIVE_BUILD)
+  // Host: Nanosekunden der echten Uhr (die virtuelle steht während der Arbeit)
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+#elif defined(ESP32)
+  return ESP.getCycleCount();       // CCOUNT
+#else
+  return ARM_DWT_CYCCNT;            // Teensy 4.x, vom Core beim Start aktiviert
+#endif
+}
+
+static inline uint32_t cyclesPerUs() {
+#if defined(NATIVE_BUILD)
+  return 1000;
+#elif defined(ESP32)
+  return getCpuFrequencyMhz();
+#else
+  return F_CPU_ACTUAL / 1000000;
+#endif
+}
+
+// ---- Log-Buckets: 0..3 us exakt, danach 4 Buckets pro Zweierpotenz ----
+static uint8_t bucketOf(uint32_t us) {
+  if (us < 4) return us;
+  uint8_t octave = 31 - __builtin_clz(us);
+  uint8_t sub = (us >> (octave - 2)) & 3;
+  uint16_t idx = 4 + (octave - 2) * 4 + sub;
+  return idx < PROF_BUCKETS ? idx : PROF_BUCKETS - 1;
+}
+
+// Größter Wert, der noch in den Bucket fällt
+static uint32_t bucketUpperUs(uint8_t idx) {
+  if (idx < 4) return idx;
+  uint8_t octave = (idx - 4) / 4 + 2;
+  uint8_t sub = (idx - 4) % 4;
+  return ((uint32_t)(5 + sub) << (octave - 2)) - 1;
+}
+
+static uint32_t percentileUs(const StageStats& s, uint8_t pct) {
+  if (s.frames == 0) return 0;
+  uint32_t rank = (uint32_t)(((uint64_t)s.frames * pct + 99) / 100);
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < PROF_BUCKETS; ++i) {
+    seen += s.hist[i];
+    if (seen >= rank) return min(bucketUpperUs(i), s.maxUs);
+  }
+  return s.maxUs;
+}
+
+static void resetStats() {
+  memset(stats, 0, sizeof(stats));
+  worstFrameUs = 0;
+  memset(worstStageUs, 0, sizeof(worstStageUs));
+}
+
+static void record(ProfStage stage, uint32_t us) {
+  StageStats& s = stats[stage];
+  s.frames++;
+  s.sumUs += us;
+  if (us > s.maxUs) s.maxUs = us;
+  s.hist[bucketOf(us)]++;
+}
+
+ProfileScope::ProfileScope(ProfStage stage) : stage(stage), start(cycleCount()) {
+  if (!frameStarted) {
+    frameStart = start;
+    frameStarted = true;
+  }
+}
+
+ProfileScope::~ProfileScope() {
+  frameCycles[stage] += cycleCount() - start;
+  frameRan[stage] = true;
+}
+
+uint32_t profilerCycles() {
+  return cycleCount();
+}
+
+void profilerAddCycles(ProfStage stage, uint32_t cycles) {
+  frameCycles[stage] += cycles;
+  frameRan[stage] = true;
+}
+
+static void emit(const char* line) {
+  Serial.println(line);
+  if (reportSink) reportSink(line);
+}
+
+static void report() {
+  char line[96];
+  emit("[PROF] stage        frames    avg    p50    p95    p99    max (us)");
+  for (uint8_t i = 0; i < PROF_STAGE_COUNT; ++i) {
+    const StageStats& s = stats[i];
+    if (s.frames == 0) continue;
+    snprintf(line, sizeof(line), "[PROF] %-10s %8lu %6lu %6lu %6lu %6lu %6lu",
+             stageNames[i], (unsigned long)s.frames, (unsigned long)(s.sumUs / s.frames),
+             (unsigned long)percentileUs(s, 50), (unsigned long)percentileUs(s, 95),
+             (unsigned long)percentileUs(s, 99), (unsigned long)s.maxUs);
+    emit(line);
+  }
+
+  // Rest = Zeit außerhalb der gemessenen Stufen (Mode-Wechsel, Heap-Log, ...)
+  uint32_t other = worstFrameUs;
+  int n = snprintf(line, sizeof(line), "[PROF] worst frame %lu us:", (unsigned long)worstFrameUs);
+  for (uint8_t i = 0; i < PROF_FRAME && n < (int)sizeof(line); ++i) {
+    if (worstStageUs[i] == 0) continue;
+    other -= min(other, worstStageUs[i]);
+    n += snprintf(line + n, sizeof(line) - n, " %s %lu", stageNames[i], (unsigned long)worstStageUs[i]);
+  }
+  if (n < (int)sizeof(line)) snprintf(line + n, sizeof(line) - n, " other %lu", (unsigned long)other);
+  emit(line);
+}
+
+void profilerEndFrame() {
+  uint32_t now = cycleCount();
+  uint32_t perUs = cyclesPerUs();
+  // Nur Spiel-Frames: Start-/Pause-Menü blockieren loop() beliebig lange
+  if (frameStarted && frameRan[PROF_COLLECT]) {
+    frameCycles[PROF_FRAME] = now - frameStart;
+    frameRan[PROF_FRAME] = true;
+  }
+
+  uint32_t stageUs[PROF_STAGE_COUNT];
+  for (uint8_t i = 0; i < PROF_STAGE_COUNT; ++i) {
+    stageUs[i] = frameCycles[i] / perUs;
+    if (frameRan[i]) record((ProfStage)i, stageUs[i]);
+    frameCycles[i] = 0;
+    frameRan[i] = false;
+  }
+  if (stageUs[PROF_FRAME] > worstFrameUs) {
+    worstFrameUs = stageUs[PROF_FRAME];
+    memcpy(worstStageUs, stageUs, sizeof(worstStageUs));
+  }
+  frameStarted = false;
+
+  if (reportRequested) {
+    reportRequested = false;
+    report();
+    if (resetRequested) {
+      resetRequested = false;
+      resetStats();
+    }
+  }
+}
+
+void profilerPollSerial() {
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    if (c == 'p' || c == 'P') profilerRequestReport(c == 'P');
+  }
+}
+
+void profilerRequestReport(bool reset) {
+  if (reset) resetRequested = true;
+  reportRequested = true;
+}
+
+void profilerSetReportSink(void (*sink)(const char* line)) {
+  reportSink = sink;
+}
+
+void profilerPrintReport() {
+  report();
+}
+
+#endif // DEBUG_FRAME_PROFILER
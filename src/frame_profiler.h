@@ -0,0 +1,78 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// ---- Frame-Profiler ----
+// Misst pro Frame die Zeit jeder Stufe von loop() über den Zyklenzähler
+// (ESP32 CCOUNT, Teensy 4.1 DWT CYCCNT, Host steady_clock) und sammelt sie
+// in log-skalierten Histogrammen (4 Buckets pro Zweierpotenz, ~19 %
+// Auflösung). Report mit Mittelwert, P50/P95/P99 und dem langsamsten
+// Frame auf Anfrage: 'p' über Serial oder BLE, 'P' setzt zurück.
+// Aktiv nur mit -DDEBUG_FRAME_PROFILER, sonst kompilieren alle Hooks zu nichts.
+
+enum ProfStage : uint8_t {
+  PROF_BUTTONS = 0,   // Buttons.poll()
+  PROF_MENU_LOGIC,    // updateMenuLogic()
+  PROF_PET_STATS,     // updatePetStats()
+  PROF_SIM,           // simulateFrame() (mit DUAL_CORE_PIPELINE auf Kern 0, über den Snapshot)
+  PROF_COLLECT,       // PHASE_COLLECT: renderListCollectDirty()
+  PROF_MERGE,         // mergeDirtyRects()
+  PROF_RESTORE,       // PHASE_RESTORE (processDirtyRects)
+  PROF_DRAW,          // PHASE_DRAW inkl. composeDirtyRects()
+  PROF_UI,            // Bottom-Menü + Status-Bar
+  PROF_FRAME,         // ganzer Spiel-Frame ohne das Warten aufs Pacing
+  PROF_STAGE_COUNT
+};
+
+constexpr uint8_t PROF_BUCKETS = 72;   // 0..3 us exakt, dann bis ~0,5 s
+
+#ifdef DEBUG_FRAME_PROFILER
+
+// Zählt die Zeit bis zum Scope-Ende auf die Stufe (mehrfach pro Frame erlaubt)
+class ProfileScope {
+public:
+  explicit ProfileScope(ProfStage stage);
+  ~ProfileScope();
+private:
+  ProfStage stage;
+  uint32_t start;
+};
+
+// Zyklenzähler lesen, ohne Profiler-Zustand: auch aus dem Simulations-Task
+uint32_t profilerCycles();
+
+// Anderswo gemessene Zyklen auf die Stufe zählen (nur loop(), z.B. PROF_SIM
+// aus FrameSnapshot::simCycles)
+void profilerAddCycles(ProfStage stage, uint32_t cycles);
+
+// Frame abschließen (einmal pro loop(), vor dem Pacing)
+void profilerEndFrame();
+
+// Serial-Kommandos ('p' Report, 'P' Reset) einmal pro loop() abfragen
+void profilerPollSerial();
+
+// Report anfordern, z.B. aus dem BLE-Task; erscheint beim nächsten
+// profilerEndFrame() auf Serial und, falls gesetzt, beim BLE-Sink
+void profilerRequestReport(bool reset);
+
+// Zusätzliche Ausgabe pro Report-Zeile (BLE-Notify), nullptr = keine
+void profilerSetReportSink(void (*sink)(const char* line));
+
+// Report sofort über Serial ausgeben (Host am Ende des Laufs)
+void profilerPrintReport();
+
+#else
+
+struct ProfileScope {
+  explicit ProfileScope(ProfStage) {}
+};
+
+inline uint32_t profilerCycles() { return 0; }
+inline void profilerAddCycles(ProfStage, uint32_t) {}
+inline void profilerEndFrame() {}
+inline void profilerPollSerial() {}
+inline void profilerRequestReport(bool) {}
+inline void profilerSetReportSink(void (*)(const char*)) {}
+inline void profilerPrintReport() {}
+
+#endif
@@ -1,5 +1,9 @@
 #include "gfx.h"
 #include "sprite_common.h"
+#include "bg_tiles.h"
+#include "environment.h"
+#include "dirt.h"
+#include "blend565.h"
 #include "sprites/clownfish.h"
 
 // Frame phase tracking for debugging
@@ -18,7 +22,7 @@ void setFramePhase(FramePhase phase) {
 }
 
 // Globale Display-Instanz
-Adafruit_ST7789 tft = Adafruit_ST7789(PIN_TFT_CS, PIN_TFT_DC, PIN_TFT_RST);
+DisplayDriver tft(PIN_TFT_CS, PIN_TFT_DC, PIN_TFT_RST);
 
 // Play-Area
 int16_t PLAY_AREA_X = 0;
@@ -30,6 +34,107 @@ int16_t PLAY_AREA_H = 0;
 GFXcanvas16 *bgCanvas = nullptr;
 bool gNoCanvas = false;
 
+// Kachelspeicher statt Canvas (BACKGROUND_TILES oder Canvas-Allokation fehlgeschlagen)
+static bool useBgTiles = false;
+
+bool hasBackground()
+{
+    return bgCanvas || bgTilesReady();
+}
+
+// Eine Hintergrundzeile nach dst holen (SpiRowSource für spiFlushRect).
+// Der Canvas enthält die Dirt-Spots bereits, die Kacheln sind unverschmutzt
+// und bekommen das Overlay hier beim Dekodieren.
+static void readBackgroundRow(int16_t x, int16_t y, int16_t w, uint16_t* dst)
+{
+    if (bgCanvas)
+    {
+        memcpy(dst, bgCanvas->getBuffer() + y * TFT_WIDTH + x, w * sizeof(uint16_t));
+        return;
+    }
+    bgTilesReadRow(x, y, w, dst);
+    drawDirtOverlayRow(x, y, w, dst);
+}
+
+// ---- Compose-Liste (COMPOSE_DIRTY_RECTS) ----
+// Sprites der DRAW-Phase werden hier in Aufrufreihenfolge (= Z-Order)
+// vorgemerkt und erst in composeDirtyRects() in die Dirty-Rects geblendet.
+struct ComposeItem {
+  const uint16_t* bitmap;
+  int16_t x, y;
+  uint16_t w, h;
+  bool flipX;
+  uint8_t alpha;  // BLEND_ALPHA_OPAQUE = deckend, sonst geblendet wie drawSpriteBlended()
+  const SpriteSpanTable* spans;  // gesetzt = Span-Blit statt Pixel-Scan
+};
+
+// Fisch + Garnele + 2 Seepferdchen + 10 Blasen + 30 Partikel = 44
+constexpr uint8_t MAX_COMPOSE_ITEMS = 48;
+static ComposeItem composeItems[MAX_COMPOSE_ITEMS];
+static uint8_t composeCount = 0;
+static bool composeOpen = false;
+
+// true = Sprite wurde vorgemerkt, nicht direkt zeichnen
+static bool queueCompose(const uint16_t* bitmap, uint16_t w, uint16_t h, int16_t x, int16_t y,
+                         bool flipX, uint8_t alpha, const SpriteSpanTable* spans = nullptr)
+{
+    if (!composeOpen)
+        return false;
+    if (composeCount >= MAX_COMPOSE_ITEMS)
+    {
+#ifdef DEBUG_GRAPHICS
+        Serial.println("[COMPOSE] Warning: compose list full, sprite dropped");
+#endif
+        return true;
+    }
+    ComposeItem& it = composeItems[composeCount++];
+    it.bitmap = bitmap;
+    it.x = x;
+    it.y = y;
+    it.w = w;
+    it.h = h;
+    it.flipX = flipX;
+    it.alpha = alpha;
+    it.spans = spans;
+    return true;
+}
+
+// n Pixel eines Laufs ab Position skip (in Bildschirmrichtung) nach dst holen.
+// Gespiegelte Läufe werden rückwärts gelesen, indizierte Sprites über die
+// Palette expandiert.
+static inline void fetchSpanPixels(const SpriteSpanTable& t, const SpriteSpan& s, bool flipX,
+                                   uint16_t skip, uint16_t n, uint16_t* dst)
+{
+    if (t.indexed)
+    {
+        const IndexedSprite& ix = *t.indexed;
+        if (flipX)
+        {
+            uint16_t i = s.offset + s.len - 1 - skip;
+            for (uint16_t k = 0; k < n; ++k)
+                dst[k] = indexedColor(ix, indexedIndex(ix, i - k));
+        }
+        else
+        {
+            uint16_t i = s.offset + skip;
+            for (uint16_t k = 0; k < n; ++k)
+                dst[k] = indexedColor(ix, indexedIndex(ix, i + k));
+        }
+        return;
+    }
+
+    const uint16_t* src = t.bitmap + s.offset;
+    if (flipX)
+    {
+        for (uint16_t k = 0; k < n; ++k)
+            dst[k] = pgm_read_word(&src[s.len - 1 - skip - k]);
+    }
+    else
+    {
+        memcpy(dst, src + skip, n * sizeof(uint16_t));
+    }
+}
+
 // Displayinitialisierung
 void initDisplay()
 {
@@ -40,7 +145,7 @@ void initDisplay()
 #ifdef ESP32
     // Initialize SPI with stable speed for ST7789V2
     SPI.begin();
-    SPI.setFrequency(40000000); // 20 MHz - stable for most ESP32
+    SPI.setFrequency(SPI_CLOCK_HZ);
 #endif
 
     // Initialize display - ST7789V2 specific for 170x320 panel
@@ -61,6 +166,7 @@ void initDisplay()
     tft.spiWrite((TFT_WIDTH - 1) & 0xFF); // End row low byte (319)
     tft.endWrite();
     
+    spiFlushInit();
     tft.fillScreen(COLOR_BG);
     tft.setTextWrap(false);
     
@@ -87,13 +193,22 @@ void initBackgroundCanvas()
     Serial.println(" bytes)...");
 #endif
 
-#ifdef ESP32
+#ifdef BACKGROUND_TILES
+    useBgTiles = true;
+    Serial.println("[GFX] Using tiled background store (BACKGROUND_TILES)");
+#elif defined(ESP32)
     // ESP32: Try allocation, handle failure gracefully
     bgCanvas = new (std::nothrow) GFXcanvas16(TFT_WIDTH, TFT_HEIGHT);
+    if (bgCanvas && !bgCanvas->getBuffer())
+    {
+        // GFXcanvas16 alloziert den Puffer selbst, new allein sagt nichts
+        delete bgCanvas;
+        bgCanvas = nullptr;
+    }
     if (!bgCanvas)
     {
-        Serial.println("[GFX] WARNING: Canvas allocation failed (low heap). Running without background cache.");
-        gNoCanvas = true;
+        Serial.println("[GFX] WARNING: Canvas allocation failed (low heap). Using tiled background store.");
+        useBgTiles = true;
         return;
     }
 #ifdef DEBUG_GRAPHICS
@@ -117,6 +232,125 @@ void initBackgroundCanvas()
 #endif
 }
 
+// Seed der Umgebung und Seed, aus dem die unverschmutzte Schicht stammt
+static uint32_t envSeed = ENVIRONMENT_SEED;
+static uint32_t pristineSeed = 0;
+
+void setEnvironmentSeed(uint32_t seed)
+{
+    envSeed = seed;
+}
+
+uint32_t getEnvironmentSeed()
+{
+    return envSeed;
+}
+
+// Band-Renderer für den Kachelspeicher: der Seed sorgt dafür, dass jedes
+// Band dieselbe Szene sieht
+static void renderBackgroundBand(GFXcanvas16* band, int16_t)
+{
+    band->fillScreen(COLOR_BG);
+    drawEnvironmentToCanvas(band, envSeed);
+}
+
+// Mit Canvas: frisch gerenderten Canvas als unverschmutzte Schicht kacheln
+static void copyCanvasBand(GFXcanvas16* band, int16_t originY)
+{
+    int16_t rows = min((int16_t)BG_TILE_SIZE, (int16_t)(TFT_HEIGHT - originY));
+    memcpy(band->getBuffer(), bgCanvas->getBuffer() + originY * TFT_WIDTH,
+           rows * TFT_WIDTH * sizeof(uint16_t));
+}
+
+void rebuildBackground()
+{
+    if (gNoCanvas)
+        return;
+
+    if (envSeed == 0)
+        envSeed = random(1, 0x7FFFFFFF);
+
+    // Schicht passt zum Seed: dekodieren statt neu rendern (Kachelmodus:
+    // nichts zu tun, die Kacheln sind der Hintergrund)
+    if (bgTilesReady() && pristineSeed == envSeed)
+    {
+        if (bgCanvas)
+            restoreBackgroundPristine(0, 0, TFT_WIDTH, TFT_HEIGHT);
+#ifdef DEBUG_GRAPHICS
+        Serial.println("[GFX] Background restored from pristine layer");
+#endif
+        return;
+    }
+
+    if (!useBgTiles)
+    {
+        bgCanvas->fillScreen(COLOR_BG);
+        drawEnvironmentToCanvas(bgCanvas, envSeed);
+
+        // Unverschmutzte Kopie für restoreBackgroundPristine() (~24 KB)
+        if (bgTilesBuild(copyCanvasBand))
+            pristineSeed = envSeed;
+        else
+            Serial.println("[GFX] WARNING: No pristine background layer, cleaning re-renders the scene.");
+        return;
+    }
+
+    if (!bgTilesBuild(renderBackgroundBand))
+    {
+        Serial.println("[GFX] WARNING: Tiled background failed. Running without background cache.");
+        gNoCanvas = true;
+        return;
+    }
+    pristineSeed = envSeed;
+#ifdef DEBUG_GRAPHICS
+    Serial.print("[GFX] Tiled background: ");
+    Serial.print(bgTilesStats().bytes);
+    Serial.println(" bytes");
+#endif
+}
+
+bool restoreBackgroundPristine(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (!bgTilesReady())
+        return false;
+    if (!bgCanvas)
+        return true;  // Kacheln sind die unverschmutzte Schicht, Overlay kommt beim Lesen
+
+    int16_t x0 = max(x, (int16_t)0);
+    int16_t y0 = max(y, (int16_t)0);
+    int16_t x1 = min((int16_t)(x + w), TFT_WIDTH);
+    int16_t y1 = min((int16_t)(y + h), TFT_HEIGHT);
+    for (int16_t row = y0; row < y1 && x0 < x1; ++row)
+        bgTilesReadRow(x0, row, x1 - x0, bgCanvas->getBuffer() + row * TFT_WIDTH + x0);
+    return true;
+}
+
+static uint32_t backgroundBlitCount = 0;
+
+uint32_t getBackgroundBlitCount()
+{
+    return backgroundBlitCount;
+}
+
+void blitBackground()
+{
+    backgroundBlitCount++;
+#ifndef WIRE_ORDER_PIXELS
+    // drawRGBBitmap() erwartet logische Pixel, in Bus-Reihenfolge geht der
+    // Canvas unten zeilenweise über die Staging-Puffer
+    if (bgCanvas)
+    {
+        tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
+        return;
+    }
+#endif
+    if (!hasBackground())
+        return;
+
+    SpiCallerScope spiScope(SPI_CALLER_DIRTY_RECTS);
+    spiFlushRect(readBackgroundRow, 0, 0, TFT_WIDTH, TFT_HEIGHT);
+}
+
 void restoreRegion(int16_t x, int16_t y, int16_t w, int16_t h)
 {
 #ifdef DEBUG_GRAPHICS
@@ -153,7 +387,7 @@ void restoreRegion(int16_t x, int16_t y, int16_t w, int16_t h)
     }
 #endif
 
-    if (gNoCanvas || !bgCanvas)
+    if (!hasBackground())
         return;
 
     // Hard-clip to screen bounds to prevent OOB access
@@ -166,19 +400,17 @@ void restoreRegion(int16_t x, int16_t y, int16_t w, int16_t h)
     if (x0 >= x1 || y0 >= y1)
         return;
 
-    uint16_t *buf = bgCanvas->getBuffer();
-    tft.startWrite();
-    for (int16_t r = y0; r < y1; r++)
-    {
-        tft.setAddrWindow(x0, r, x1 - x0, 1);
-        tft.writePixels(buf + r * TFT_WIDTH + x0, x1 - x0);
-    }
-    tft.endWrite();
+    SpiCallerScope spiScope(SPI_CALLER_RESTORE_REGION);
+    spiFlushRect(readBackgroundRow, x0, y0, x1 - x0, y1 - y0);
 }
 
 // Einfache Sprite-Zeichenfunktion mit Transparenzfarbe
 void drawSpriteBasic(const uint16_t *bitmap, uint16_t w, uint16_t h, int16_t x, int16_t y)
 {
+    if (queueCompose(bitmap, w, h, x, y, false, BLEND_ALPHA_OPAQUE))
+        return;
+
+    SpiCallerScope spiScope(SPI_CALLER_SPRITE_BASIC);
     for (uint16_t py = 0; py < h; ++py)
     {
         for (uint16_t px = 0; px < w; ++px)
@@ -192,13 +424,17 @@ void drawSpriteBasic(const uint16_t *bitmap, uint16_t w, uint16_t h, int16_t x,
             if (sx < 0 || sy < 0 || sx >= TFT_WIDTH || sy >= TFT_HEIGHT)
                 continue;
 
-            tft.drawPixel(sx, sy, color);
+            tft.drawPixel(sx, sy, px565(color));
         }
     }
 }
 
 void drawSpriteOptimized(const uint16_t *bmp, uint16_t w, uint16_t h, int16_t x, int16_t y, bool flipX)
 {
+    if (queueCompose(bmp, w, h, x, y, flipX, BLEND_ALPHA_OPAQUE))
+        return;
+
+    SpiCallerScope spiScope(SPI_CALLER_SPRITE_OPTIMIZED);
     static uint16_t buf[96];
     tft.startWrite();
 
@@ -265,7 +501,7 @@ void drawSpriteOptimized(const uint16_t *bmp, uint16_t w, uint16_t h, int16_t x,
                     buf[i] = pgm_read_word(&bmp[py * w + srcX]);
                 }
                 tft.setAddrWindow(clipStart + offset, sy, chunk, 1);
-                tft.writePixels(buf, chunk);
+                tft.writePixels(buf, chunk, true, PIXELS_BIG_ENDIAN);
                 remaining -= chunk;
                 offset += chunk;
             }
@@ -274,28 +510,163 @@ void drawSpriteOptimized(const uint16_t *bmp, uint16_t w, uint16_t h, int16_t x,
     tft.endWrite();
 }
 
+void drawSpriteSpans(const SpriteSpanTable& t, int16_t x, int16_t y, bool flipX)
+{
+    // Zugeschnittene Sprites: nur den deckenden Ausschnitt platzieren
+    x = spanOriginX(t, x, flipX);
+    y += t.oy;
+    if (queueCompose(t.bitmap, t.w, t.h, x, y, flipX, BLEND_ALPHA_OPAQUE, &t))
+        return;
+
+    SpiCallerScope spiScope(SPI_CALLER_SPRITE_OPTIMIZED);
+    static uint16_t buf[256];
+    const SpriteSpan* spans = flipX ? t.spansFlip : t.spans;
+    tft.startWrite();
+
+    for (uint16_t py = 0; py < t.h; ++py)
+    {
+        int16_t sy = y + py;
+        if (sy < 0 || sy >= TFT_HEIGHT)
+            continue;
+
+        for (uint16_t i = t.rows[py]; i < t.rows[py + 1]; ++i)
+        {
+            const SpriteSpan& s = spans[i];
+            int16_t x0 = x + s.x;
+            int16_t x1 = x0 + s.len;
+            int16_t cx0 = (x0 > 0) ? x0 : 0;
+            int16_t cx1 = (x1 < TFT_WIDTH) ? x1 : TFT_WIDTH;
+            if (cx0 >= cx1)
+                continue;
+
+            uint16_t n = cx1 - cx0;
+            fetchSpanPixels(t, s, flipX, cx0 - x0, n, buf);
+            tft.setAddrWindow(cx0, sy, n, 1);
+            tft.writePixels(buf, n, true, PIXELS_BIG_ENDIAN);
+        }
+    }
+    tft.endWrite();
+}
+
+void drawSpriteIndexed(const IndexedSprite& s, int16_t x, int16_t y)
+{
+    x += s.ox;
+    y += s.oy;
+    SpiCallerScope spiScope(SPI_CALLER_SPRITE_BASIC);
+    static uint16_t buf[96];
+    tft.startWrite();
+
+    for (uint16_t py = 0; py < s.h; ++py)
+    {
+        int16_t sy = y + py;
+        if (sy < 0 || sy >= TFT_HEIGHT)
+            continue;
+
+        uint16_t row = py * s.w;
+        uint16_t px = 0;
+        while (px < s.w)
+        {
+            // Index 0 = transparent
+            while (px < s.w && indexedIndex(s, row + px) == 0)
+                ++px;
+            uint16_t start = px;
+            while (px < s.w && indexedIndex(s, row + px) != 0)
+                ++px;
+
+            int16_t cx0 = max((int16_t)(x + start), (int16_t)0);
+            int16_t cx1 = min((int16_t)(x + px), (int16_t)TFT_WIDTH);
+            for (int16_t cx = cx0; cx < cx1; cx += 96)
+            {
+                uint16_t n = min((int16_t)(cx1 - cx), (int16_t)96);
+                for (uint16_t k = 0; k < n; ++k)
+                    buf[k] = indexedColor(s, indexedIndex(s, row + (cx - x) + k));
+                tft.setAddrWindow(cx, sy, n, 1);
+                tft.writePixels(buf, n, true, PIXELS_BIG_ENDIAN);
+            }
+        }
+    }
+    tft.endWrite();
+}
+
+void drawSpriteBlended(const uint16_t *bitmap, uint16_t w, uint16_t h, int16_t x, int16_t y, uint8_t alpha)
+{
+    if (alpha == 0)
+        return;
+    if (queueCompose(bitmap, w, h, x, y, false, alpha))
+        return;
+
+    // Ohne Compose: gegen den Hintergrund blenden (was sonst darunter liegt,
+    // ist vom Display nicht lesbar), ein Window pro deckendem Run
+    int16_t x0 = max(x, PLAY_AREA_X);
+    int16_t x1 = min((int16_t)(x + w), (int16_t)(PLAY_AREA_X + PLAY_AREA_W));
+    if (x0 >= x1)
+        return;
+
+    SpiCallerScope spiScope(SPI_CALLER_PARTICLES);
+    static uint16_t row[64];
+    tft.startWrite();
+    for (uint16_t py = 0; py < h; ++py)
+    {
+        int16_t sy = y + py;
+        if (sy < PLAY_AREA_Y || sy >= PLAY_AREA_Y + PLAY_AREA_H)
+            continue;
+        const uint16_t *src = bitmap + py * w;
+        for (int16_t cx = x0; cx < x1; cx += 64)
+        {
+            uint16_t n = min((int16_t)64, (int16_t)(x1 - cx));
+            if (hasBackground())
+            {
+                readBackgroundRow(cx, sy, n, row);
+                blendRow565(row, src + (cx - x), n, alpha);
+                // Nur die deckenden Runs senden, der Rest gehört anderen Sprites
+                for (uint16_t i = 0; i < n;)
+                {
+                    if (isTransparent16(pgm_read_word(&src[cx - x + i])))
+                    {
+                        ++i;
+                        continue;
+                    }
+                    uint16_t run = i;
+                    while (run < n && !isTransparent16(pgm_read_word(&src[cx - x + run])))
+                        ++run;
+                    tft.setAddrWindow(cx + i, sy, run - i, 1);
+                    tft.writePixels(row + i, run - i, true, PIXELS_BIG_ENDIAN);
+                    i = run;
+                }
+                continue;
+            }
+            // Ohne Hintergrund-Cache: ab halber Deckkraft deckend
+            if (alpha < BLEND_ALPHA_OPAQUE / 2)
+                continue;
+            for (uint16_t i = 0; i < n; ++i)
+            {
+                uint16_t color = pgm_read_word(&src[cx - x + i]);
+                if (!isTransparent16(color))
+                    tft.writePixel(cx + i, sy, px565(color));
+            }
+        }
+    }
+    tft.endWrite();
+}
+
 void blitPlayAreaFromCanvas() {
-  if (gNoCanvas || !bgCanvas) return;
+  if (!hasBackground()) return;
   
   const int16_t x = PLAY_AREA_X;
   const int16_t y = PLAY_AREA_Y;
   const int16_t w = PLAY_AREA_W;
   const int16_t h = PLAY_AREA_H;
   
-  uint16_t* buf = bgCanvas->getBuffer();
-  
-  tft.startWrite();
-  tft.setAddrWindow(x, y, w, h);
-  for (int16_t row = 0; row < h; ++row) {
-    tft.writePixels(buf + (y + row) * TFT_WIDTH + x, w);
-  }
-  tft.endWrite();
+  backgroundBlitCount++;
+  SpiCallerScope spiScope(SPI_CALLER_DIRTY_RECTS);
+  spiFlushRect(readBackgroundRow, x, y, w, h);
 }
 
 void drawDeathScreen()
 {
     int16_t centerX = TFT_WIDTH / 2;
     int16_t centerY = TFT_HEIGHT / 2;
+    SpiCallerScope spiScope(SPI_CALLER_UI);
 
     tft.fillRect(0, 20, TFT_WIDTH, TFT_HEIGHT - 40, 0x0841);
 
@@ -309,7 +680,7 @@ void drawDeathScreen()
     // Draw dead fish sprite (30x25)
     int16_t fishX = centerX - 15; // Center the 30px wide sprite
     int16_t fishY = centerY - 12; // Center the 25px tall sprite
-    drawSpriteOptimized(nemodeadBitmap, 30, 25, fishX, fishY, false);
+    drawSpriteSpans(nemodeadBitmapSpans, fishX, fishY, false);
 
     tft.setTextSize(1);
     const char *hint = "Press OK to restart";
@@ -327,39 +698,63 @@ void setBacklight(bool on) {
 }
 
 // ---- Dirty Rectangle System Implementation ----
-constexpr uint8_t MAX_DIRTY_RECTS = 32;
+constexpr uint8_t MAX_DIRTY_RECTS = 128;
 static DirtyRect dirtyRects[MAX_DIRTY_RECTS];
 static uint8_t dirtyRectCount = 0;
 
+#ifdef DIRTY_TILE_BITMAP
+// Schadensverfolgung als Bitset über DIRTY_TILE_SIZE-Kacheln der Play-Area:
+// ein Bit pro Kachel, eine Zeile pro uint64_t. Kosten pro addDirtyRect()
+// und beim Auswerten hängen nur von der Fläche ab, nicht von der Anzahl
+// der Sprites.
+constexpr uint8_t DIRTY_TILE_COLS = (TFT_WIDTH + DIRTY_TILE_SIZE - 1) / DIRTY_TILE_SIZE;
+constexpr uint8_t DIRTY_TILE_ROWS = (TFT_HEIGHT + DIRTY_TILE_SIZE - 1) / DIRTY_TILE_SIZE;
+static_assert(DIRTY_TILE_COLS <= 64, "one uint64_t per tile row");
+static uint64_t dirtyTiles[DIRTY_TILE_ROWS];
+#endif
+
 void initDirtyRects() {
   dirtyRectCount = 0;
   for (uint8_t i = 0; i < MAX_DIRTY_RECTS; ++i) {
     dirtyRects[i].valid = false;
   }
+#ifdef DIRTY_TILE_BITMAP
+  memset(dirtyTiles, 0, sizeof(dirtyTiles));
+#endif
 }
 
+// Overlay (setDirtyOccluder): verdeckter Bereich und der zuletzt
+// freigegebene, der beim nächsten clearDirtyRects() dirty wird
+static DirtyRect occluder = {0, 0, 0, 0, false};
+static DirtyRect uncovered = {0, 0, 0, 0, false};
+
 void clearDirtyRects() {
   dirtyRectCount = 0;
+#ifdef DIRTY_TILE_BITMAP
+  memset(dirtyTiles, 0, sizeof(dirtyTiles));
+#endif
+  if (uncovered.valid) {
+    uncovered.valid = false;
+    addDirtyRect(uncovered.x, uncovered.y, uncovered.w, uncovered.h);
+  }
 }
 
-void addDirtyRect(int16_t x, int16_t y, uint16_t w, uint16_t h) {
-  if (dirtyRectCount >= MAX_DIRTY_RECTS) {
-#ifdef DEBUG_GRAPHICS
-    Serial.println("[DIRTY] Warning: Max dirty rects reached, falling back to full play area");
+// Kostenmodell: Pixel + ein Window-Aufschlag pro Rect (DIRTY_WINDOW_COST_PX)
+static uint32_t rectArea(const DirtyRect& r) {
+  return (uint32_t)r.w * r.h;
+}
+
+#ifndef DIRTY_TILE_BITMAP
+static DirtyRect rectUnion(const DirtyRect& a, const DirtyRect& b) {
+  int16_t x0 = min(a.x, b.x);
+  int16_t y0 = min(a.y, b.y);
+  int16_t x1 = max((int16_t)(a.x + a.w), (int16_t)(b.x + b.w));
+  int16_t y1 = max((int16_t)(a.y + a.h), (int16_t)(b.y + b.h));
+  return {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0), true};
+}
 #endif
-    // Fallback: add full play area rect if we overflow
-    if (dirtyRectCount == MAX_DIRTY_RECTS) {
-      clearDirtyRects();
-      dirtyRects[0].x = PLAY_AREA_X;
-      dirtyRects[0].y = PLAY_AREA_Y;
-      dirtyRects[0].w = PLAY_AREA_W;
-      dirtyRects[0].h = PLAY_AREA_H;
-      dirtyRects[0].valid = true;
-      dirtyRectCount = 1;
-    }
-    return;
-  }
-  
+
+void addDirtyRect(int16_t x, int16_t y, uint16_t w, uint16_t h) {
   // Clip to play area
   int16_t x0 = max(x, PLAY_AREA_X);
   int16_t y0 = max(y, PLAY_AREA_Y);
@@ -369,13 +764,44 @@ void addDirtyRect(int16_t x, int16_t y, uint16_t w, uint16_t h) {
   if (x1 <= x0 || y1 <= y0) {
     return; // Fully outside play area
   }
-  
-  dirtyRects[dirtyRectCount].x = x0;
-  dirtyRects[dirtyRectCount].y = y0;
-  dirtyRects[dirtyRectCount].w = x1 - x0;
-  dirtyRects[dirtyRectCount].h = y1 - y0;
-  dirtyRects[dirtyRectCount].valid = true;
-  dirtyRectCount++;
+#ifdef DIRTY_TILE_BITMAP
+  uint8_t tx0 = (x0 - PLAY_AREA_X) / DIRTY_TILE_SIZE;
+  uint8_t tx1 = (x1 - 1 - PLAY_AREA_X) / DIRTY_TILE_SIZE;
+  uint8_t ty0 = (y0 - PLAY_AREA_Y) / DIRTY_TILE_SIZE;
+  uint8_t ty1 = (y1 - 1 - PLAY_AREA_Y) / DIRTY_TILE_SIZE;
+  uint64_t bits = (tx1 - tx0 == 63) ? ~0ull : (((1ull << (tx1 - tx0 + 1)) - 1) << tx0);
+  for (uint8_t ty = ty0; ty <= ty1; ++ty) {
+    dirtyTiles[ty] |= bits;
+  }
+  return;
+#else
+  DirtyRect r = {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0), true};
+
+  if (dirtyRectCount >= MAX_DIRTY_RECTS) {
+    // Liste voll: in das Rect einrechnen, dessen Vereinigung am wenigsten
+    // zusätzliche Pixel kostet (statt alles zu verwerfen)
+    uint8_t best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (uint8_t i = 0; i < dirtyRectCount; ++i) {
+      uint32_t growth = rectArea(rectUnion(dirtyRects[i], r)) - rectArea(dirtyRects[i]);
+      if (growth < bestGrowth) {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+#ifdef DEBUG_GRAPHICS
+    Serial.print("[DIRTY] Rect list full, folded into rect ");
+    Serial.print(best);
+    Serial.print(" (+");
+    Serial.print(bestGrowth);
+    Serial.println(" px)");
+#endif
+    dirtyRects[best] = rectUnion(dirtyRects[best], r);
+    return;
+  }
+
+  dirtyRects[dirtyRectCount++] = r;
+#endif
 }
 
 void addDirtyRectPair(int16_t x, int16_t y, uint16_t w, uint16_t h, 
@@ -392,76 +818,286 @@ void addDirtyRectPair(int16_t x, int16_t y, uint16_t w, uint16_t h,
   }
 }
 
-void mergeDirtyRects() {
+// Deckende Ausdehnung [x0, x1) einer Sprite-Zeile, false = leer.
+// Spans einer Zeile sind nach x sortiert (auch die gespiegelten).
+static bool spanRowExtent(const SpriteSpanTable& t, bool flipX, uint16_t py, int16_t& x0, int16_t& x1) {
+  uint16_t first = t.rows[py];
+  uint16_t last = t.rows[py + 1];
+  if (first == last) return false;
+  const SpriteSpan* spans = flipX ? t.spansFlip : t.spans;
+  x0 = spans[first].x;
+  x1 = spans[last - 1].x + spans[last - 1].len;
+  return true;
+}
+
+// Ausdehnung einer Bildschirmzeile sy auf die eines platzierten Sprites erweitern
+static void extendBySilhouette(const SpriteSpanTable& t, int16_t x, int16_t y, bool flipX,
+                               int16_t sy, int16_t& ex0, int16_t& ex1) {
+  x = spanOriginX(t, x, flipX);
+  y += t.oy;
+  if (sy < y || sy >= y + (int16_t)t.h) return;
+  int16_t x0, x1;
+  if (!spanRowExtent(t, flipX, sy - y, x0, x1)) return;
+  ex0 = min(ex0, (int16_t)(x + x0));
+  ex1 = max(ex1, (int16_t)(x + x1));
+}
+
+void addDirtySilhouette(const SpriteSpanTable& cur, int16_t x, int16_t y, bool flipX,
+                        const SpriteSpanTable* prev, int16_t prevX, int16_t prevY, bool prevFlipX) {
+  int16_t y0 = y + cur.oy;
+  int16_t y1 = y0 + cur.h;
+  if (prev) {
+    y0 = min(y0, (int16_t)(prevY + prev->oy));
+    y1 = max(y1, (int16_t)(prevY + prev->oy + prev->h));
+  }
+
+  // Aufeinanderfolgende Zeilen zu einem Band zusammenfassen, solange die
+  // Hülle weniger Zusatzpixel kostet als ein eigenes Window
+  int16_t bx0 = 0, bx1 = 0, by0 = 0, rows = 0;
+  for (int16_t sy = y0; sy <= y1; ++sy) {
+    int16_t ex0 = INT16_MAX, ex1 = INT16_MIN;
+    if (sy < y1) {
+      extendBySilhouette(cur, x, y, flipX, sy, ex0, ex1);
+      if (prev) extendBySilhouette(*prev, prevX, prevY, prevFlipX, sy, ex0, ex1);
+    }
+    bool empty = ex0 >= ex1;
+
+    if (rows > 0 && !empty) {
+      int16_t hx0 = min(bx0, ex0);
+      int16_t hx1 = max(bx1, ex1);
+      uint32_t merged = (uint32_t)(hx1 - hx0) * (rows + 1);
+      uint32_t split = (uint32_t)(bx1 - bx0) * rows + (ex1 - ex0) + DIRTY_WINDOW_COST_PX;
+      if (merged <= split) {
+        bx0 = hx0;
+        bx1 = hx1;
+        rows++;
+        continue;
+      }
+    }
+    if (rows > 0) {
+      addDirtyRect(bx0, by0, bx1 - bx0, rows);
+      rows = 0;
+    }
+    if (!empty) {
+      bx0 = ex0;
+      bx1 = ex1;
+      by0 = sy;
+      rows = 1;
+    }
+  }
+}
+
+// Ab der Break-even-Schwelle ein einziges Window über die ganze Play-Area:
+// keine Window-Aufschläge, keine doppelt gesendeten Überlappungen
+static void collapseToFullAreaIfCheaper() {
+  uint32_t cost = 0;
+  for (uint8_t i = 0; i < dirtyRectCount; ++i) {
+    cost += rectArea(dirtyRects[i]) + DIRTY_WINDOW_COST_PX;
+  }
+  uint32_t fullCost = (uint32_t)PLAY_AREA_W * PLAY_AREA_H + DIRTY_WINDOW_COST_PX;
+  if (dirtyRectCount > 1 && cost * 100 >= fullCost * DIRTY_FULL_AREA_PERCENT) {
+    dirtyRects[0] = {PLAY_AREA_X, PLAY_AREA_Y, PLAY_AREA_W, PLAY_AREA_H, true};
+    dirtyRectCount = 1;
+  }
+
+#ifdef DEBUG_GRAPHICS
+  Serial.print("[DIRTY] After merge: ");
+  Serial.print(dirtyRectCount);
+  Serial.print(" rects, cost ");
+  Serial.print(cost);
+  Serial.print(" / full ");
+  Serial.println(fullCost);
+#endif
+}
+
+#ifdef DIRTY_TILE_BITMAP
+
+// Maximale horizontale Kachel-Läufe pro Kachelzeile; ein Lauf mit gleicher
+// Ausdehnung wie ein Rect, das direkt darüber endet, verlängert dieses nach unten
+static void mergeDirtyRectList() {
+  dirtyRectCount = 0;
+  int16_t areaX1 = PLAY_AREA_X + PLAY_AREA_W;
+  int16_t areaY1 = PLAY_AREA_Y + PLAY_AREA_H;
+
+  for (uint8_t ty = 0; ty < DIRTY_TILE_ROWS; ++ty) {
+    uint64_t row = dirtyTiles[ty];
+    int16_t y = PLAY_AREA_Y + ty * DIRTY_TILE_SIZE;
+    int16_t h = min((int16_t)DIRTY_TILE_SIZE, (int16_t)(areaY1 - y));
+    uint8_t tx = 0;
+
+    while (row && h > 0) {
+      while (!(row & 1)) { row >>= 1; ++tx; }
+      uint8_t start = tx;
+      while (row & 1) { row >>= 1; ++tx; }
+
+      int16_t x = PLAY_AREA_X + start * DIRTY_TILE_SIZE;
+      int16_t w = min((int16_t)((tx - start) * DIRTY_TILE_SIZE), (int16_t)(areaX1 - x));
+
+      bool stacked = false;
+      for (uint8_t k = 0; k < dirtyRectCount && !stacked; ++k) {
+        DirtyRect& above = dirtyRects[k];
+        if (above.x == x && above.w == w && above.y + above.h == y) {
+          above.h += h;
+          stacked = true;
+        }
+      }
+      if (stacked) continue;
+
+      if (dirtyRectCount >= MAX_DIRTY_RECTS) {
+        // Mehr Läufe als Platz: ganze Fläche
+        dirtyRects[0] = {PLAY_AREA_X, PLAY_AREA_Y, PLAY_AREA_W, PLAY_AREA_H, true};
+        dirtyRectCount = 1;
+        return;
+      }
+      dirtyRects[dirtyRectCount++] = {x, y, w, h, true};
+    }
+  }
+
+  collapseToFullAreaIfCheaper();
+}
+
+#else
+
+// Lohnt sich ein gemeinsames Window? Getrennt zählen überlappende Pixel
+// doppelt (beide Windows senden sie), dafür ein Window-Aufschlag mehr.
+static bool mergePays(const DirtyRect& a, const DirtyRect& b, DirtyRect& u) {
+  u = rectUnion(a, b);
+  return rectArea(u) <= rectArea(a) + rectArea(b) + DIRTY_WINDOW_COST_PX;
+}
+
+static int compareRectX(const void* a, const void* b) {
+  return ((const DirtyRect*)a)->x - ((const DirtyRect*)b)->x;
+}
+
+static void mergeDirtyRectList() {
   if (dirtyRectCount <= 1) return;
-  
-  // Simple merge: combine overlapping or adjacent rects
+
+  // Sweep über die nach x sortierte Liste: liegt b mehr als
+  // DIRTY_WINDOW_COST_PX Spalten rechts von a, kostet die Vereinigung
+  // mindestens so viele Lückenpixel und kann sich nicht mehr lohnen.
+  // Die Vereinigung behält a.x (b.x >= a.x), die Sortierung bleibt gültig.
+  // Wiederholen, bis kein Paar mehr gewinnt (meist 1-2 Durchläufe).
   bool merged = true;
-  while (merged && dirtyRectCount > 1) {
+  while (merged) {
     merged = false;
-    
+    qsort(dirtyRects, dirtyRectCount, sizeof(DirtyRect), compareRectX);
+
     for (uint8_t i = 0; i < dirtyRectCount; ++i) {
-      if (!dirtyRects[i].valid) continue;
-      
+      DirtyRect& a = dirtyRects[i];
+      if (!a.valid) continue;
+
       for (uint8_t j = i + 1; j < dirtyRectCount; ++j) {
-        if (!dirtyRects[j].valid) continue;
-        
-        DirtyRect& a = dirtyRects[i];
         DirtyRect& b = dirtyRects[j];
-        
-        // Check if rects overlap or are adjacent (within 2 pixels)
-        int16_t ax1 = a.x + a.w;
-        int16_t ay1 = a.y + a.h;
-        int16_t bx1 = b.x + b.w;
-        int16_t by1 = b.y + b.h;
-        
-        bool xOverlap = (a.x - 2 <= bx1) && (b.x - 2 <= ax1);
-        bool yOverlap = (a.y - 2 <= by1) && (b.y - 2 <= ay1);
-        
-        if (xOverlap && yOverlap) {
-          // Merge b into a
-          int16_t newX = min(a.x, b.x);
-          int16_t newY = min(a.y, b.y);
-          int16_t newX1 = max(ax1, bx1);
-          int16_t newY1 = max(ay1, by1);
-          
-          a.x = newX;
-          a.y = newY;
-          a.w = newX1 - newX;
-          a.h = newY1 - newY;
-          
-          // Invalidate b and compact array
+        if (b.x > a.x + a.w + (int16_t)DIRTY_WINDOW_COST_PX) break;
+        if (!b.valid) continue;
+
+        DirtyRect u;
+        if (mergePays(a, b, u)) {
+          a = u;
           b.valid = false;
-          
-          // Move last rect to position j to compact
-          if (j < dirtyRectCount - 1) {
-            dirtyRects[j] = dirtyRects[dirtyRectCount - 1];
-          }
-          dirtyRectCount--;
-          
           merged = true;
-          break; // Restart merge after modification
         }
       }
-      
-      if (merged) break;
     }
+
+    // Ungültige entfernen
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < dirtyRectCount; ++i) {
+      if (dirtyRects[i].valid) dirtyRects[n++] = dirtyRects[i];
+    }
+    dirtyRectCount = n;
   }
-  
-#ifdef DEBUG_GRAPHICS
-  Serial.print("[DIRTY] After merge: ");
-  Serial.print(dirtyRectCount);
-  Serial.println(" rects");
-#endif
+
+  collapseToFullAreaIfCheaper();
+}
+
+#endif  // DIRTY_TILE_BITMAP
+
+void setDirtyOccluder(int16_t x, int16_t y, int16_t w, int16_t h) {
+  // Freigegebene Fläche im nächsten Frame aus Hintergrund + Sprites neu aufbauen
+  if (occluder.valid) uncovered = occluder;
+  occluder = {x, y, w, h, w > 0 && h > 0};
+  if (occluder.valid) uncovered.valid = false;
+}
+
+static bool pushRect(DirtyRect* out, uint8_t& n, int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) return true;
+  if (n >= MAX_DIRTY_RECTS) return false;
+  out[n++] = {x, y, w, h, true};
+  return true;
+}
+
+// Schneidet das Overlay aus den gemergten Rects: ein überlappendes Rect
+// zerfällt in bis zu vier Streifen (oben, unten, links, rechts daneben).
+// Reicht der Platz nicht, die Play-Area rund um das Overlay.
+static void subtractOccluder() {
+  if (!occluder.valid) return;
+  static DirtyRect out[MAX_DIRTY_RECTS];
+  const DirtyRect& o = occluder;
+  uint8_t n = 0;
+  bool fits = true;
+
+  for (uint8_t i = 0; i < dirtyRectCount && fits; ++i) {
+    const DirtyRect& r = dirtyRects[i];
+    if (!r.valid) continue;
+    int16_t ox0 = max(r.x, o.x);
+    int16_t oy0 = max(r.y, o.y);
+    int16_t ox1 = min((int16_t)(r.x + r.w), (int16_t)(o.x + o.w));
+    int16_t oy1 = min((int16_t)(r.y + r.h), (int16_t)(o.y + o.h));
+    if (ox0 >= ox1 || oy0 >= oy1) {
+      fits = pushRect(out, n, r.x, r.y, r.w, r.h);
+      continue;
+    }
+    fits = pushRect(out, n, r.x, r.y, r.w, oy0 - r.y) &&
+           pushRect(out, n, r.x, oy1, r.w, r.y + r.h - oy1) &&
+           pushRect(out, n, r.x, oy0, ox0 - r.x, oy1 - oy0) &&
+           pushRect(out, n, ox1, oy0, r.x + r.w - ox1, oy1 - oy0);
+  }
+
+  if (!fits) {
+    int16_t ax1 = PLAY_AREA_X + PLAY_AREA_W;
+    int16_t ay1 = PLAY_AREA_Y + PLAY_AREA_H;
+    n = 0;
+    pushRect(out, n, PLAY_AREA_X, PLAY_AREA_Y, PLAY_AREA_W, o.y - PLAY_AREA_Y);
+    pushRect(out, n, PLAY_AREA_X, o.y + o.h, PLAY_AREA_W, ay1 - (o.y + o.h));
+    pushRect(out, n, PLAY_AREA_X, o.y, o.x - PLAY_AREA_X, o.h);
+    pushRect(out, n, o.x + o.w, o.y, ax1 - (o.x + o.w), o.h);
+  }
+
+  memcpy(dirtyRects, out, n * sizeof(DirtyRect));
+  dirtyRectCount = n;
+}
+
+void mergeDirtyRects() {
+  mergeDirtyRectList();
+  subtractOccluder();
+}
+
+bool dirtyRectsIntersect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  for (uint8_t i = 0; i < dirtyRectCount; ++i) {
+    const DirtyRect& r = dirtyRects[i];
+    if (!r.valid) continue;
+    if (x < r.x + r.w && r.x < x + w && y < r.y + r.h && r.y < y + h) return true;
+  }
+  return false;
 }
 
 void processDirtyRects() {
-  if (gNoCanvas || !bgCanvas) {
+  if (!hasBackground()) {
     // Fallback to full redraw
     blitPlayAreaFromCanvas();
     return;
   }
   
+#ifdef COMPOSE_DIRTY_RECTS
+  // Nichts senden: Hintergrund und Sprites gehen gemeinsam in composeDirtyRects().
+  // Auch ohne Rects öffnen: liegt alles unter einem Overlay (setDirtyOccluder),
+  // dürfen die Sprites nicht direkt gezeichnet werden.
+  composeCount = 0;
+  composeOpen = true;
+  return;
+#endif
+
   if (dirtyRectCount == 0) {
 #ifdef DEBUG_GRAPHICS
     Serial.println("[DIRTY] No dirty rects, skipping restore");
@@ -470,9 +1106,8 @@ void processDirtyRects() {
   }
   
   // Restore all dirty regions from background canvas
-  uint16_t* buf = bgCanvas->getBuffer();
+  SpiCallerScope spiScope(SPI_CALLER_DIRTY_RECTS);
   
-  tft.startWrite();
   for (uint8_t i = 0; i < dirtyRectCount; ++i) {
     if (!dirtyRects[i].valid) continue;
     
@@ -491,10 +1126,102 @@ void processDirtyRects() {
     Serial.println(r.h);
 #endif
     
-    tft.setAddrWindow(r.x, r.y, r.w, r.h);
-    for (int16_t row = 0; row < r.h; ++row) {
-      tft.writePixels(buf + (r.y + row) * TFT_WIDTH + r.x, r.w);
+    spiFlushRect(readBackgroundRow, r.x, r.y, r.w, r.h);
+  }
+}
+
+// Span-Variante: kopiert nur die deckenden Läufe, ohne Transparenz-Tests
+static void blendSpansIntoStrip(const ComposeItem& it, uint16_t* strip, int16_t stripX, int16_t stripY,
+                                int16_t w, int16_t y0, int16_t y1)
+{
+  const SpriteSpanTable& t = *it.spans;
+  const SpriteSpan* spans = it.flipX ? t.spansFlip : t.spans;
+  int16_t stripX1 = stripX + w;
+
+  for (int16_t sy = y0; sy < y1; ++sy) {
+    uint16_t py = sy - it.y;
+    uint16_t* dst = strip + (sy - stripY) * w - stripX;
+    for (uint16_t i = t.rows[py]; i < t.rows[py + 1]; ++i) {
+      const SpriteSpan& s = spans[i];
+      int16_t sx0 = it.x + s.x;
+      int16_t sx1 = sx0 + s.len;
+      int16_t cx0 = max(sx0, stripX);
+      int16_t cx1 = min(sx1, stripX1);
+      if (cx0 >= cx1) continue;
+
+      fetchSpanPixels(t, s, it.flipX, cx0 - sx0, cx1 - cx0, dst + cx0);
+    }
+  }
+}
+
+// Blendet die Zeilen [y0, y1) eines Compose-Items in den Strip (Stride w)
+static void blendItemIntoStrip(const ComposeItem& it, uint16_t* strip, int16_t stripX, int16_t stripY,
+                               int16_t w, int16_t rows)
+{
+  int16_t x0 = max(stripX, it.x);
+  int16_t x1 = min((int16_t)(stripX + w), (int16_t)(it.x + it.w));
+  int16_t y0 = max(stripY, it.y);
+  int16_t y1 = min((int16_t)(stripY + rows), (int16_t)(it.y + it.h));
+  if (x0 >= x1 || y0 >= y1) return;
+
+  if (it.spans) {
+    blendSpansIntoStrip(it, strip, stripX, stripY, w, y0, y1);
+    return;
+  }
+
+  bool opaque = it.alpha >= BLEND_ALPHA_OPAQUE;
+  for (int16_t sy = y0; sy < y1; ++sy) {
+    const uint16_t* src = it.bitmap + (sy - it.y) * it.w;
+    uint16_t* dst = strip + (sy - stripY) * w - stripX;
+    if (!opaque && !it.flipX) {
+      blendRow565(dst + x0, src + (x0 - it.x), x1 - x0, it.alpha);
+      continue;
+    }
+    for (int16_t sx = x0; sx < x1; ++sx) {
+      int16_t srcX = sx - it.x;
+      if (it.flipX) srcX = it.w - 1 - srcX;
+      uint16_t c = pgm_read_word(&src[srcX]);
+      if (isTransparent16(c)) continue;
+      dst[sx] = opaque ? c : blendStored565(c, dst[sx], it.alpha);
+    }
+  }
+}
+
+void composeDirtyRects() {
+  if (!composeOpen) return;
+  composeOpen = false;
+
+  SpiCallerScope spiScope(SPI_CALLER_DIRTY_RECTS);
+
+  for (uint8_t i = 0; i < dirtyRectCount; ++i) {
+    if (!dirtyRects[i].valid) continue;
+    const DirtyRect& r = dirtyRects[i];
+
+    // Ein Window pro Rect, die Strips laufen per RAMWR-Autoinkrement durch.
+    // Mit Async-Transport wird Strip n+1 komponiert, während n noch sendet.
+    spiFlushWindow(r.x, r.y, r.w, r.h);
+    for (int16_t sy = r.y; sy < r.y + r.h; sy += COMPOSE_STRIP_ROWS) {
+      int16_t rows = min((int16_t)COMPOSE_STRIP_ROWS, (int16_t)(r.y + r.h - sy));
+      uint16_t* strip = spiFlushAcquire();
+
+      for (int16_t row = 0; row < rows; ++row) {
+        readBackgroundRow(r.x, sy + row, r.w, strip + row * r.w);
+      }
+      for (uint8_t k = 0; k < composeCount; ++k) {
+        blendItemIntoStrip(composeItems[k], strip, r.x, sy, r.w, rows);
+      }
+      spiFlushSubmit(strip, r.w * rows);
     }
   }
-  tft.endWrite();
+  // Kein Fence: der letzte Strip läuft weiter, bis loop() vor dem Pacing
+  // abschließt oder, ohne Wartezeit, in die COLLECT-Phase des nächsten Frames
+
+#ifdef DEBUG_GRAPHICS
+  Serial.print("[COMPOSE] ");
+  Serial.print(composeCount);
+  Serial.print(" sprites into ");
+  Serial.print(dirtyRectCount);
+  Serial.println(" rects");
+#endif
+  composeCount = 0;
 }
@@ -3,9 +3,30 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
 #include "config.h"
+#include "sprite_common.h"
+#include "spi_stats.h"
+#include "spi_flush.h"
+
+// Display-Basis: mit DEBUG_SPI_STATS die zählende Variante
+#ifdef DEBUG_SPI_STATS
+typedef SpiAccountingST7789 DisplayBase;
+#else
+typedef Adafruit_ST7789 DisplayBase;
+#endif
+
+// Display-Treiber: schließt vor jedem Zugriff einen noch laufenden
+// asynchronen Flush ab (siehe spi_flush.h)
+class DisplayDriver : public DisplayBase {
+public:
+  DisplayDriver(int8_t cs, int8_t dc, int8_t rst) : DisplayBase(cs, dc, rst) {}
+  void startWrite() override {
+    spiFlushFence();
+    DisplayBase::startWrite();
+  }
+};
 
 // Globale Display-Instanz
-extern Adafruit_ST7789 tft;
+extern DisplayDriver tft;
 
 // Play-Area Variablen
 extern int16_t PLAY_AREA_X;
@@ -33,19 +54,43 @@ FramePhase getFramePhase();
 void initDisplay();
 void initBackgroundCanvas();
 
+// Hintergrund (Canvas oder Kachelspeicher, siehe bg_tiles.h)
+bool hasBackground();
+void rebuildBackground();   // Environment herstellen (aus der unverschmutzten Schicht, falls vorhanden)
+void setEnvironmentSeed(uint32_t seed);  // anderer Boden: nächster rebuildBackground() rendert neu
+uint32_t getEnvironmentSeed();
+void blitBackground();      // kompletten Hintergrund aufs Display
+// Rechteck im Canvas auf die unverschmutzte Environment-Schicht
+// zurücksetzen (ohne Dirt-Overlay). false = keine Schicht vorhanden.
+bool restoreBackgroundPristine(int16_t x, int16_t y, int16_t w, int16_t h);
+
 // Sprite-Zeichenfunktion (mit Transparenz)
 void drawSpriteBasic(const uint16_t *bitmap, uint16_t w, uint16_t h, int16_t x, int16_t y);
 
 // Optimierte Sprite-Zeichenfunktion mit Scanline-Run-Batching und FlipX
 void drawSpriteOptimized(const uint16_t* bitmap, uint16_t w, uint16_t h, int16_t x, int16_t y, bool flipX);
 
+// Sprite über vorberechnete Span-Tabelle (keine Transparenz-Tests, FlipX über gespiegelte Tabelle)
+void drawSpriteSpans(const SpriteSpanTable& table, int16_t x, int16_t y, bool flipX);
+
+// Palette-indiziertes Sprite direkt aufs TFT (Hintergrund ohne Canvas, kein Compose)
+void drawSpriteIndexed(const IndexedSprite& sprite, int16_t x, int16_t y);
+
+// Halbtransparentes Sprite (alpha 0..BLEND_ALPHA_OPAQUE, siehe blend565.h),
+// auf die Play-Area geclippt
+void drawSpriteBlended(const uint16_t* bitmap, uint16_t w, uint16_t h, int16_t x, int16_t y, uint8_t alpha);
+
 // Dirty-Region-Restore
 void restoreRegion(int16_t x, int16_t y, int16_t w, int16_t h);
 
 // Fast play-area restore from background canvas
 void blitPlayAreaFromCanvas();
 
-// Death screen
+// Zählt komplette Hintergrund-Blits (blitBackground / blitPlayAreaFromCanvas).
+// Ändert sich der Wert, steht kein Sprite mehr auf dem Display.
+uint32_t getBackgroundBlitCount();
+
+// Death screen (einmal beim Betreten von MODE_DEAD, bleibt stehen)
 void drawDeathScreen();
 
 // Backlight control
@@ -68,8 +113,32 @@ void addDirtyRect(int16_t x, int16_t y, uint16_t w, uint16_t h);
 void addDirtyRectPair(int16_t x, int16_t y, uint16_t w, uint16_t h, 
                       float prevX, float prevY);
 
+// Dirty-Region aus den Silhouetten statt der Bounding-Boxen: pro
+// Bildschirmzeile nur die deckende Ausdehnung von neuem und altem Frame,
+// zusammengefasst zu wenigen Bändern (Kostenmodell wie mergeDirtyRects).
+// prev = nullptr: keine alte Position (erster Frame)
+void addDirtySilhouette(const SpriteSpanTable& cur, int16_t x, int16_t y, bool flipX,
+                        const SpriteSpanTable* prev, int16_t prevX, int16_t prevY, bool prevFlipX);
+
 // Merge overlapping/nearby dirty rects to reduce draw calls
 void mergeDirtyRects();
 
+// Overlay über der Play-Area (z.B. Pausemenü): mergeDirtyRects() schneidet
+// das Rechteck aus allen Dirty-Rects, Restore und Compose senden dort also
+// nichts und das Overlay bleibt stehen, während dahinter animiert wird.
+// w = 0 hebt die Verdeckung auf, die Fläche wird dann im nächsten Frame
+// (clearDirtyRects()) einmal komplett neu aufgebaut.
+void setDirtyOccluder(int16_t x, int16_t y, int16_t w, int16_t h);
+
+// true = Rechteck überlappt ein (gemergtes) Dirty-Rect dieses Frames
+bool dirtyRectsIntersect(int16_t x, int16_t y, int16_t w, int16_t h);
+
 // Restore and draw all dirty regions
+// Mit COMPOSE_DIRTY_RECTS: öffnet nur die Compose-Liste, die Sprite-Funktionen
+// oben zeichnen dann nicht mehr direkt, sondern werden vorgemerkt.
 void processDirtyRects();
+
+// Setzt jedes Dirty-Rect aus bgCanvas + vorgemerkten Sprites (in Z-Reihenfolge)
+// zusammen und sendet es in einem Address-Window. Aufruf am Ende der DRAW-Phase;
+// ohne COMPOSE_DIRTY_RECTS bzw. ohne Canvas ein No-op.
+void composeDirtyRects();
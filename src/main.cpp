@@ -13,9 +13,16 @@
 #include "dirt.h"
 #include "eeprom_store.h"
 #include "shrimp.h"
+#include "render_list.h"
+#include "frame_governor.h"
+#include "frame_profiler.h"
+#include "sim_clock.h"
+#include "frame_pipeline.h"
 #include "start_menu.h"
 #include "pause_menu.h"
 #include "Buttons.h"
+#include "text_atlas.h"
+#include <stdio.h>
 #ifdef ESP32
 #include "ble_handler.h"
 #include <esp_heap_caps.h>
@@ -40,12 +47,21 @@ ScreenID currentScreen = SCREEN_MAIN;
 
 // Vorwärtsdeklaration
 void drawStatusBar();
+void drawStatusBar(int hunger, int fun, int energy);
+static void simulateFrame(FrameSnapshot& snap, float dtSec);
+static void switchMode(GameMode mode);
 
 // Cached values für Status-Bar Optimierung
 static int lastShownHunger = -1;
 static int lastShownFun = -1;
 static int lastShownEnergy = -1;
 
+// Status-Bar-Layout: feste Slots "H:nnn  " (7 Zeichen), damit eine Zahl
+// allein neu gezeichnet werden kann, ohne den Rest zu verschieben
+static const int16_t STATUS_TEXT_X = 4;
+static const int16_t STATUS_TEXT_Y = 4;
+static const uint8_t STATUS_SLOT_CELLS = 7;
+
 // Setup
 void setup()
 {
@@ -66,6 +82,7 @@ void setup()
 #endif
 
     initDisplay();
+    textAtlasInit();
     randomSeed(analogRead(0));
 
 #ifdef ESP32
@@ -111,100 +128,26 @@ void setup()
     yield();
 #endif
     
-    if (bgCanvas)
+    if (!gNoCanvas)
     {
 #ifdef DEBUG_GRAPHICS
         Serial.println("[MAIN] Filling canvas background...");
 #endif
-        bgCanvas->fillScreen(COLOR_BG);
-        drawEnvironmentToCanvas(bgCanvas);
+        rebuildBackground();
         
 #ifdef ESP32
         yield();
 #endif
-        
-#ifdef DEBUG_GRAPHICS
-        Serial.println("[MAIN] Blitting canvas to display...");
-#endif
-        // Initial aufs TFT blitten
-        tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
-        drawStatusBar();
-        drawBottomMenu();
-#ifdef DEBUG_GRAPHICS
-        Serial.println("[MAIN] Initial screen rendered");
-#endif
     }
 
-    while (true)
-    {
-        StartChoice choice = runStartMenu(hasSave());
-        if (choice == START_NEW)
-        {
-#ifdef DEBUG_GAME_LOGIC
-            Serial.println("[MAIN] Starting NEW GAME");
-#endif
-            clearSave();
-            initPet();
-            gMode = MODE_ALIVE;
-            
-            // Clear start menu completely
-            tft.fillScreen(COLOR_BG);
-            if (bgCanvas)
-            {
-                bgCanvas->fillScreen(COLOR_BG);
-                drawEnvironmentToCanvas(bgCanvas);
-                tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
-            }
-            drawStatusBar();
-            drawBottomMenu();
-            
-            break;
-        }
-        else if (choice == START_LOAD)
-        {
-#ifdef DEBUG_GAME_LOGIC
-            Serial.println("[MAIN] LOADING saved game");
-#endif
-            initPet();
-            int16_t h, f, e, hp;
-            uint32_t age;
-            bool dead;
-            if (loadFull(h, f, e, hp, age, dead))
-            {
-                pet.hunger = h;
-                pet.fun = f;
-                pet.energy = e;
-                pet.hp = hp;
-                pet.ageSec = age;
-                pet.dead = dead;
-                if (pet.hp > getMaxHP())
-                    pet.hp = getMaxHP();
-                gMode = pet.dead ? MODE_DEAD : MODE_ALIVE;
-#ifdef DEBUG_GAME_LOGIC
-                Serial.print("[MAIN] Game loaded - Age: ");
-                Serial.print(age);
-                Serial.print("s, HP: ");
-                Serial.print(hp);
-                Serial.print(", Dead: ");
-                Serial.println(dead);
-#endif
-                
-                // Clear start menu completely
-                tft.fillScreen(COLOR_BG);
-                if (bgCanvas)
-                {
-                    bgCanvas->fillScreen(COLOR_BG);
-                    drawEnvironmentToCanvas(bgCanvas);
-                    tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
-                }
-                drawStatusBar();
-                drawBottomMenu();
-                
-                break;
-            }
-        }
-    }
-    
+    // Gültiger Pet-Zustand für den ersten Simulationsframe; die Wahl im
+    // Startmenü setzt ihn danach neu
+    initPet();
+    switchMode(MODE_START);
+
+    // Simulation ab jetzt über die Pipeline (ggf. eigener Task/Kern)
+    pipelineBegin(simulateFrame);
+
 #ifdef DEBUG_GAME_LOGIC
     Serial.println("[MAIN] Entering main game loop");
 #endif
@@ -212,45 +155,288 @@ void setup()
 
 // Zeichnet die Statuszeile oben (Hunger/Fun/Energie)
 void drawStatusBar()
+{
+    drawStatusBar(pet.hunger, pet.fun, pet.energy);
+}
+
+// Ein Stat-Feld: 3 Ziffern linksbündig, Label davor bleibt stehen
+static void drawStatusField(uint8_t slot, int value)
+{
+    char digits[8];
+    snprintf(digits, sizeof(digits), "%-3d", value);
+    int16_t x = STATUS_TEXT_X + (slot * STATUS_SLOT_CELLS + 2) * TEXT_CELL_W;
+    textDrawField(x, STATUS_TEXT_Y, 3 * TEXT_CELL_W, TEXT_CELL_H, digits, x, STATUS_TEXT_Y, 0xFFFF, COLOR_STATUS_BG);
+}
+
+// Dasselbe mit Werten aus einem Frame-Snapshot (Pet läuft evtl. parallel)
+void drawStatusBar(int hunger, int fun, int energy)
 {
     // Nur neu zeichnen wenn sich Werte geändert haben
-    if (pet.hunger != lastShownHunger || pet.fun != lastShownFun || pet.energy != lastShownEnergy)
+    if (hunger == lastShownHunger && fun == lastShownFun && energy == lastShownEnergy)
+        return;
+
+    SpiCallerScope spiScope(SPI_CALLER_UI);
+    if (lastShownHunger < 0)
     {
-        tft.fillRect(0, 0, TFT_WIDTH, STATUS_BAR_H, COLOR_STATUS_BG);
-
-        tft.setCursor(4, 4);
-        tft.setTextSize(1);
-        tft.setTextColor(0xFFFF);
-
-        tft.print("H:");
-        tft.print(pet.hunger);
-        tft.print(" F:");
-        tft.print(pet.fun);
-        tft.print(" E:");
-        tft.print(pet.energy);
-
-        // Cache-Werte aktualisieren
-        lastShownHunger = pet.hunger;
-        lastShownFun = pet.fun;
-        lastShownEnergy = pet.energy;
+        // Ganze Leiste samt Labels in einem Window (nach fillScreen)
+        char line[40];
+        snprintf(line, sizeof(line), "H:%-3d  F:%-3d  E:%-3d", hunger, fun, energy);
+        textDrawField(0, 0, TFT_WIDTH, STATUS_BAR_H, line, STATUS_TEXT_X, STATUS_TEXT_Y, 0xFFFF, COLOR_STATUS_BG);
     }
+    else
+    {
+        // Sonst nur die Zahlen, die sich bewegt haben
+        if (hunger != lastShownHunger) drawStatusField(0, hunger);
+        if (fun != lastShownFun) drawStatusField(1, fun);
+        if (energy != lastShownEnergy) drawStatusField(2, energy);
+    }
+
+    // Cache-Werte aktualisieren
+    lastShownHunger = hunger;
+    lastShownFun = fun;
+    lastShownEnergy = energy;
 }
 
-// Frame-Timing-Variablen (60 FPS)
+// Ganzes Aquarium neu aufs Display (nach Start-Menü), Bars erzwingen
+static void showAquarium()
+{
+    tft.fillScreen(COLOR_BG);
+    if (hasBackground())
+        blitBackground();
+    lastShownHunger = -1;
+    invalidateBottomMenu();
+    drawStatusBar();
+    drawBottomMenu();
+}
+
+// Frame-Timing-Variablen (Periode vom Frame-Governor, 60/30/15/5 FPS)
 static unsigned long lastFrameUs = 0;
 static unsigned long nextFrameUs = 0;
+static unsigned long lastPeriodUs = 0;
 static float dtSecSmooth = 0.0167f;        // ~60 FPS initial
-const unsigned long targetFrameUs = 33333; // ~30 FPS - realistic for full play-area redraw
+static float prevAnimPhase = 0.0f;         // animPhase vor dem letzten Simulationsschritt
+// Pause: nur die Umgebung läuft weiter (Blasen, Seepferdchen, Garnele,
+// Partikel), Pet und Dirt stehen. Wird vor pipelineKick() gesetzt.
+static bool simPetFrozen = false;
+static bool modeFresh = false;             // erster Frame im aktuellen gMode
+
+// Simulation eines Frames: feste Schritte, dann alle Sprites in den
+// Snapshot. Läuft mit DUAL_CORE_PIPELINE auf dem anderen Kern, parallel zum
+// Rendern des vorigen Snapshots.
+static void simulateFrame(FrameSnapshot& snap, float dtSec)
+{
+    // Profiler-Zustand gehört loop(): nur messen, gebucht wird nach dem Abholen
+    uint32_t simStart = profilerCycles();
+    renderListBegin(snap.render);
+
+    // Simulation in festen Schritten, unabhängig von der Bildrate
+#ifdef FIXED_TIMESTEP
+    uint8_t simSteps = simClockAdvance(dtSec);
+    float simDt = SIM_DT;
+    float simAlpha = simClockAlpha();
+#else
+    uint8_t simSteps = 1;
+    float simDt = dtSec;
+    float simAlpha = 1.0f;
+#endif
+    for (uint8_t step = 0; step < simSteps; step++)
+    {
+        // Animationsphase fortschreiben (zeitbasiert)
+        prevAnimPhase = animPhase;
+        animPhase += ANIM_PHASE_RATE * simDt;
+        if (animPhase > 1000.0f)
+            animPhase -= 1000.0f;
 
-// Pause-Erkennung durch langen OK-Druck
-static uint32_t okPressStartMs = 0;
-static const uint32_t LONG_PRESS_MS = 1000;
-static bool okWasPressed = false;
+#ifndef DISABLE_BUBBLES
+        bubblesSetFishOrigin((int16_t)getFishX(), (int16_t)getFishY());
+        updateBubbles(simDt);
+#endif
+        updateShrimp(simDt);
+        if (!simPetFrozen)
+        {
+            updateDirt(simDt);
+            updatePet(simDt);
+        }
+        updateParticles(simDt);
+    }
+
+    // Sprites zwischen den letzten beiden Schritten einreichen
+#ifndef DISABLE_BUBBLES
+    drawBubbles(simAlpha);
+#endif
+    drawSeahorse(simLerpWrapped(prevAnimPhase, animPhase, simAlpha, 1000.0f));
+    drawShrimp(simAlpha);
+    drawPetAnimated(simPetFrozen ? 1.0f : simAlpha);  // eingefroren: letzter Stand, kein Pendeln
+    drawParticles(simAlpha);
+
+    dirtSnapshot(snap.dirt);
+    snap.hunger = pet.hunger;
+    snap.fun = pet.fun;
+    snap.energy = pet.energy;
+    snap.simCycles = profilerCycles() - simStart;
+}
+
+static void switchMode(GameMode mode)
+{
+    gMode = mode;
+    modeFresh = true;
+}
+
+// Hinter dem Pause-Overlay weiter animieren geht nur, wenn Sprites über
+// die Compose-Liste laufen (die das Overlay ausspart); direkt gezeichnete
+// Sprites würden darüber malen
+static bool overlayCanAnimate()
+{
+#ifdef COMPOSE_DIRTY_RECTS
+    return hasBackground();
+#else
+    return false;
+#endif
+}
+
+// Nächsten Frame simulieren und den fertigen Snapshot rendern
+// (3-phase dirty rect system). Liefert die Bewegung für den Governor.
+static uint16_t renderFrame(float dtSec)
+{
+    uint16_t motionPx;
+
+    // Nächsten Frame simulieren (ohne DUAL_CORE_PIPELINE sofort hier)
+#ifdef FIXED_TIMESTEP
+    pipelineKick(dtSec);
+#else
+    (void)dtSec;
+    pipelineKick(dtSecSmooth);
+#endif
+    profilerAddCycles(PROF_SIM, pipelineLatest().simCycles);
+
+    // PHASE 1: COLLECT - Dirty regions from the newest snapshot vs. the last one
+    {
+        ProfileScope prof(PROF_COLLECT);
+        clearDirtyRects();
+        setFramePhase(PHASE_COLLECT);
+        renderListCollectDirty(pipelineLatest().render);
+        dirtApplySnapshot(pipelineLatest().dirt);
+        motionPx = renderListMotionPx();
+    }
+
+    // Merge overlapping dirty rects to optimize
+    {
+        ProfileScope prof(PROF_MERGE);
+        mergeDirtyRects();
+    }
+
+    // PHASE 2: RESTORE - Restore dirty regions from background canvas
+    {
+        ProfileScope prof(PROF_RESTORE);
+        setFramePhase(PHASE_RESTORE);
+        processDirtyRects();
+    }
+
+    // PHASE 3: DRAW - Draw all sprites in Z-order (last = foreground)
+    {
+        ProfileScope prof(PROF_DRAW);
+        setFramePhase(PHASE_DRAW);
+
+        drawDirt();
+        renderListDraw();
+
+        // Mit COMPOSE_DIRTY_RECTS: Rects einmal komplett senden
+        composeDirtyRects();
+    }
+
+#ifdef DEBUG_SPRITES
+    static int checkFrames = 0;
+    if (checkFrames++ > 120) {  // Every 2 seconds
+        float fishX = getFishX();
+        float fishY = getFishY();
+        Serial.print("[SPRITES] Fish visible at (");
+        Serial.print((int)fishX);
+        Serial.print(",");
+        Serial.print((int)fishY);
+        Serial.println(")");
+        checkFrames = 0;
+    }
+#endif
+
+    // Draw menus LAST to ensure they're on top
+    {
+        ProfileScope prof(PROF_UI);
+        const FrameSnapshot& shown = pipelineLatest();
+        drawBottomMenu();
+        drawStatusBar(shown.hunger, shown.fun, shown.energy);
+    }
+
+#ifndef SPI_FLUSH_ASYNC
+    // Synchron ist nichts mehr unterwegs: Transaktion gleich schließen
+    spiFlushFence();
+#endif
+    return motionPx;
+}
+
+// Gewähltes Spiel starten. false = Laden fehlgeschlagen, Menü bleibt.
+static bool startGame(StartChoice choice)
+{
+    if (choice == START_NEW)
+    {
+#ifdef DEBUG_GAME_LOGIC
+        Serial.println("[MAIN] Starting NEW GAME");
+#endif
+        clearSave();
+        initPet();
+        showAquarium();
+        switchMode(MODE_ALIVE);
+        return true;
+    }
+
+#ifdef DEBUG_GAME_LOGIC
+    Serial.println("[MAIN] LOADING saved game");
+#endif
+    initPet();
+    int16_t h, f, e, hp;
+    uint32_t age;
+    bool dead;
+    if (!loadFull(h, f, e, hp, age, dead))
+        return false;
+
+    pet.hunger = h;
+    pet.fun = f;
+    pet.energy = e;
+    pet.hp = hp;
+    pet.ageSec = age;
+    pet.dead = dead;
+    if (pet.hp > getMaxHP())
+        pet.hp = getMaxHP();
+#ifdef DEBUG_GAME_LOGIC
+    Serial.print("[MAIN] Game loaded - Age: ");
+    Serial.print(age);
+    Serial.print("s, HP: ");
+    Serial.print(hp);
+    Serial.print(", Dead: ");
+    Serial.println(dead);
+#endif
+    if (pet.dead)
+    {
+        switchMode(MODE_DEAD);
+    }
+    else
+    {
+        showAquarium();
+        switchMode(MODE_ALIVE);
+    }
+    return true;
+}
 
 // Loop
 void loop()
 {
-    Buttons.poll();
+    {
+        ProfileScope prof(PROF_BUTTONS);
+        Buttons.poll();
+    }
+
+    // Simulation des letzten Frames abwarten: ab hier gehört der Zustand
+    // der Module (Pet, Menü, Dirt) wieder loop()
+    pipelineDrain();
 
     // Initialize frame timers on first run to avoid spike
     static bool inited = false;
@@ -265,14 +451,16 @@ void loop()
     // deltaTime berechnen (wrap-safe for micros() overflow at ~71 minutes)
     uint32_t deltaUs = (uint32_t)(nowUs - lastFrameUs);
     float dtSec = deltaUs * 1e-6f;
-    dtSec = constrain(dtSec, DT_MIN, DT_MAX);
-    dtSecSmooth = dtSecSmooth * (1.0f - DT_EMA_ALPHA) + dtSec * DT_EMA_ALPHA;
+    // Bei 5 FPS sind 200 ms kein Hänger: Obergrenze wächst mit der Periode
+    unsigned long periodUs = governorFrameUs();
+    dtSec = constrain(dtSec, DT_MIN, max(DT_MAX, 1.5e-6f * periodUs));
+    if (periodUs == lastPeriodUs)
+        dtSecSmooth = dtSecSmooth * (1.0f - DT_EMA_ALPHA) + dtSec * DT_EMA_ALPHA;
+    else
+        dtSecSmooth = dtSec;  // Ratenwechsel: nicht über mehrere Frames nachziehen
+    lastPeriodUs = periodUs;
     lastFrameUs = nowUs;
-
-    // Animationsphase fortschreiben (zeitbasiert)
-    animPhase += ANIM_PHASE_RATE * dtSecSmooth;
-    if (animPhase > 1000.0f)
-        animPhase -= 1000.0f;
+    uint16_t motionPx = 0;
 
     // Memory diagnostics (every 2 seconds)
 #ifdef ESP32
@@ -289,229 +477,140 @@ void loop()
     }
 #endif
 
+    // Jeder Modus läuft als Zustand im Frame-Loop: Menüs und Todesbildschirm
+    // zeichnen beim Betreten einmal und danach nur, was sich ändert
+    bool entered = modeFresh;
+    modeFresh = false;
+
     if (gMode == MODE_ALIVE)
     {
-        // Long-press detection for pause
-        int okState = digitalRead(PIN_BTN_OK);
-        if (okState == LOW && !okWasPressed)
+        // Langer OK-Druck pausiert (Buttons wertet den Zeitstempel des Drucks aus)
+        if (Buttons.takeLongPress())
         {
-            okPressStartMs = millis();
-            okWasPressed = true;
-        }
-        else if (okState == LOW && okWasPressed)
-        {
-            if (millis() - okPressStartMs >= LONG_PRESS_MS)
-            {
 #ifdef DEBUG_BUTTONS
-                Serial.println("[BTN] OK long-press detected - PAUSE GAME");
+            Serial.println("[BTN] OK long-press detected - PAUSE GAME");
 #endif
-                gMode = MODE_PAUSED;
-                while (digitalRead(PIN_BTN_OK) == LOW)
-                    ;
-                okWasPressed = false;
-            }
-        }
-        else if (okState == HIGH)
-        {
-            okWasPressed = false;
+            switchMode(MODE_PAUSED);
         }
 
         // Menü-Logik aktualisieren (Buttons -> pendingAction)
-        updateMenuLogic();
+        {
+            ProfileScope prof(PROF_MENU_LOGIC);
+            updateMenuLogic();
+        }
 
         // Pet-Logik aktualisieren (Hunger, Fun, Energie, Aktionen)
-        updatePetStats();
+        {
+            ProfileScope prof(PROF_PET_STATS);
+            updatePetStats();
+        }
 
         // Check if pet died
         if (pet.dead)
         {
-            gMode = MODE_DEAD;
+            switchMode(MODE_DEAD);
         }
 
-        // --- Frame zeichnen (3-phase dirty rect system) ---
-        
-        // PHASE 1: COLLECT - Update physics and collect dirty rects
-        clearDirtyRects();
-        setFramePhase(PHASE_COLLECT);
-        
-#ifndef DISABLE_BUBBLES
-        bubblesSetFishOrigin((int16_t)getFishX(), (int16_t)getFishY());
-        updateAndDrawBubbles(dtSecSmooth);
-#endif
-        updateAndDrawSeahorse();
-        updateAndDrawShrimp(dtSecSmooth);
-        updateDirt(dtSecSmooth);
-        drawPetAnimated(dtSecSmooth);
-        updateParticles(dtSecSmooth);
-        drawParticles();
-        
-        // Merge overlapping dirty rects to optimize
-        mergeDirtyRects();
-        
-        // PHASE 2: RESTORE - Restore dirty regions from background canvas
-        setFramePhase(PHASE_RESTORE);
-        processDirtyRects();
-        
-        // PHASE 3: DRAW - Draw all sprites in Z-order (last = foreground)
-        setFramePhase(PHASE_DRAW);
-        
-#ifndef DISABLE_BUBBLES
-        updateAndDrawBubbles(0);
-#endif
-        updateAndDrawSeahorse();
-        updateAndDrawShrimp(0);
-        drawDirt();
-        drawPetAnimated(0);
-        drawParticles();
-        
-#ifdef DEBUG_SPRITES
-        static int checkFrames = 0;
-        if (checkFrames++ > 120) {  // Every 2 seconds
-            float fishX = getFishX();
-            float fishY = getFishY();
-            Serial.print("[SPRITES] Fish visible at (");
-            Serial.print((int)fishX);
-            Serial.print(",");
-            Serial.print((int)fishY);
-            Serial.println(")");
-            checkFrames = 0;
-        }
-#endif
-        
-        // Draw menus LAST to ensure they're on top
-        drawBottomMenu();
-        drawStatusBar();
+        simPetFrozen = false;
+        motionPx = renderFrame(dtSec);
     }
     else if (gMode == MODE_PAUSED)
     {
-        PauseChoice choice = runPauseMenu();
+        if (entered)
+            pauseMenuOpen();
 
+        PauseChoice choice = pauseMenuUpdate();
         if (choice == PAUSE_RESUME)
         {
-            gMode = MODE_ALIVE;
-            tft.fillScreen(COLOR_BG);
-            if (bgCanvas)
-            {
-                tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
-            }
-            drawStatusBar();
-            drawBottomMenu();
+            switchMode(MODE_ALIVE);
         }
         else if (choice == PAUSE_SAVE_EXIT)
         {
 #ifdef DEBUG_BUTTONS
             Serial.println("[MAIN] Exiting to start menu...");
 #endif
-            // Wait for button release and debounce delay
-            delay(300);
-            
-            while (true)
-            {
-                StartChoice startChoice = runStartMenu(hasSave());
-                if (startChoice == START_NEW)
-                {
-                    clearSave();
-                    initPet();
-                    gMode = MODE_ALIVE;
-                    tft.fillScreen(COLOR_BG);
-                    if (bgCanvas)
-                    {
-                        tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
-                    }
-                    drawStatusBar();
-                    drawBottomMenu();
-                    break;
-                }
-                else if (startChoice == START_LOAD)
-                {
-                    initPet();
-                    int16_t h, f, e, hp;
-                    uint32_t age;
-                    bool dead;
-                    if (loadFull(h, f, e, hp, age, dead))
-                    {
-                        pet.hunger = h;
-                        pet.fun = f;
-                        pet.energy = e;
-                        pet.hp = hp;
-                        pet.ageSec = age;
-                        pet.dead = dead;
-                        if (pet.hp > getMaxHP())
-                            pet.hp = getMaxHP();
-                        gMode = pet.dead ? MODE_DEAD : MODE_ALIVE;
-                        tft.fillScreen(COLOR_BG);
-                        if (bgCanvas)
-                        {
-                            tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
-                        }
-                        drawStatusBar();
-                        drawBottomMenu();
-                        break;
-                    }
-                }
-            }
+            switchMode(MODE_START);
+        }
+        else if (overlayCanAnimate())
+        {
+            // Aquarium läuft hinter dem Overlay weiter, das Panel bleibt ausgespart
+            simPetFrozen = true;
+            motionPx = renderFrame(dtSec);
         }
     }
     else if (gMode == MODE_DEAD)
     {
-        if (bgCanvas)
-        {
-            tft.drawRGBBitmap(0, 0, bgCanvas->getBuffer(), TFT_WIDTH, TFT_HEIGHT);
-        }
-        drawDeathScreen();
-
-        if (digitalRead(PIN_BTN_OK) == LOW)
+        if (entered)
         {
-            delay(200);
-            while (digitalRead(PIN_BTN_OK) == LOW)
+            Buttons.consumeHeld();
+            if (hasBackground())
             {
+                blitBackground();
             }
+            drawDeathScreen();
+        }
 
-            while (true)
-            {
-                StartChoice choice = runStartMenu(hasSave());
-                if (choice == START_NEW)
-                {
-                    clearSave();
-                    initPet();
-                    gMode = MODE_ALIVE;
-                    break;
-                }
-                else if (choice == START_LOAD)
-                {
-                    initPet();
-                    int16_t h, f, e, hp;
-                    uint32_t age;
-                    bool dead;
-                    if (loadFull(h, f, e, hp, age, dead))
-                    {
-                        pet.hunger = h;
-                        pet.fun = f;
-                        pet.energy = e;
-                        pet.hp = hp;
-                        pet.ageSec = age;
-                        pet.dead = dead;
-                        if (pet.hp > getMaxHP())
-                            pet.hp = getMaxHP();
-                        gMode = pet.dead ? MODE_DEAD : MODE_ALIVE;
-                        break;
-                    }
-                }
-            }
+        bool left, ok, right;
+        Buttons.getAndClearPressed(left, ok, right);
+        if (ok)
+        {
+            Buttons.consumeHeld();
+            switchMode(MODE_START);
         }
     }
+    else // MODE_START
+    {
+        if (entered)
+            startMenuOpen(hasSave());
+
+        StartChoice choice = startMenuUpdate();
+        if (choice != START_PENDING && !startGame(choice))
+            startMenuOpen(hasSave());
+    }
+
+    // SPI-Zähler für diesen Frame abschließen (nur mit DEBUG_SPI_STATS)
+    spiStatsEndFrame();
+
+    // Stufenzeiten verbuchen, 'p'/'P' beantworten (nur mit DEBUG_FRAME_PROFILER)
+    profilerPollSerial();
+    profilerEndFrame();
+
+    // Bildrate für den nächsten Frame aus Bewegung und Eingabe
+    governorUpdate(motionPx, dtSec);
 
     // Präzises Frame-Pacing (wrap-safe)
+    unsigned long targetFrameUs = governorFrameUs();
     if (nextFrameUs == 0)
         nextFrameUs = micros();
     nextFrameUs += targetFrameUs;
     int32_t sleep = (int32_t)(nextFrameUs - micros());
+    if (sleep < -(int32_t)targetFrameUs)
+    {
+        nextFrameUs = micros(); // Reset bei großer Verzögerung
+    }
+    // Asynchroner Flush: wird gewartet, vorher abschließen, damit der Bus im
+    // Leerlauf frei ist. Ohne Wartezeit läuft der letzte Strip in die
+    // COLLECT-Phase des nächsten Frames, dessen erster Display-Zugriff wartet.
     if (sleep > 0)
     {
-        delayMicroseconds(sleep);
+        spiFlushFence();
+        sleep = (int32_t)(nextFrameUs - micros());
     }
-    else if (sleep < -(int32_t)targetFrameUs)
+    // delay() statt Busy-Wait gibt die CPU frei; in Scheiben, damit eine
+    // Taste (Flanken-Interrupt) oder ein BLE-Write den nächsten Frame sofort
+    // startet
+    while (sleep > 0)
     {
-        nextFrameUs = micros(); // Reset bei großer Verzögerung
+        uint32_t slice = min((uint32_t)sleep, FRAME_GOV_SLICE_US);
+        if (slice >= 1000)
+            delay(slice / 1000);
+        else
+            delayMicroseconds(slice);
+        if (governorInputPending())
+        {
+            nextFrameUs = micros();
+            break;
+        }
+        sleep = (int32_t)(nextFrameUs - micros());
     }
 }
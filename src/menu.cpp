@@ -1,5 +1,6 @@
 #include "menu.h"
-#include "buttons.h"
+#include "Buttons.h"
+#include "text_atlas.h"
 
 // Interaktives Menü: 4 Einträge (Feed, Play, Rest, Clean)
 enum MenuItem {
@@ -109,63 +110,57 @@ void updateMenuLogic() {
   }
 }
 
-// Zeichnet Menü mit Hervorhebung des aktuell gewählten Eintrags
-void drawBottomMenu() {
-  // Skip redraw if selection hasn't changed
-  if (currentItem == lastDrawnItem) return;
-  
-  int16_t y = TFT_HEIGHT - BOTTOM_BAR_H;
-
-  tft.fillRect(0, y, TFT_WIDTH, BOTTOM_BAR_H, COLOR_STATUS_BG);
+// Nächstes drawBottomMenu() zeichnet alle Einträge neu
+void invalidateBottomMenu() {
+  lastDrawnItem = (MenuItem)255;
+}
 
-  tft.setTextColor(0xFFFF);
-  tft.setTextSize(1);
+// Box eines Eintrags: 4 gleiche Bereiche, der letzte nimmt den Rest
+static void itemBox(MenuItem item, int16_t& x, int16_t& w) {
+  int16_t sectionW = TFT_WIDTH / 4;
+  x = sectionW * item;
+  w = (item == MENU_CLEAN) ? TFT_WIDTH - x : sectionW;
+}
 
-  const char *labelFeed = "Futter";
-  const char *labelPlay = "Spielen";
-  const char *labelRest = "Schlafen";
-  const char *labelClean = "Putzen";
+// Innenfläche eines Eintrags (ohne Rahmen) samt Beschriftung, ein Window
+static void drawItemInterior(MenuItem item) {
+  static const char *labels[4] = {"Futter", "Spielen", "Schlafen", "Putzen"};
+  int16_t y = TFT_HEIGHT - BOTTOM_BAR_H;
+  int16_t x, w;
+  itemBox(item, x, w);
 
-  // Wir teilen die Leiste in 4 Bereiche
-  int16_t sectionW = TFT_WIDTH / 4;
+  bool selected = (item == currentItem);
+  uint16_t boxColor = selected ? 0xFFFF : COLOR_STATUS_BG;   // weiß wenn selektiert
+  uint16_t textColor = selected ? COLOR_STATUS_BG : 0xFFFF; // invertierte Schrift
 
-  // Feed-Box
-  int16_t feedX = 0;
-  int16_t feedW = sectionW;
-  // Play-Box
-  int16_t playX = sectionW;
-  int16_t playW = sectionW;
-  // Rest-Box
-  int16_t restX = sectionW * 2;
-  int16_t restW = sectionW;
-  // Clean-Box
-  int16_t cleanX = sectionW * 3;
-  int16_t cleanW = TFT_WIDTH - cleanX;
+  const char *label = labels[item];
+  int16_t tx = x + (w / 2) - (strlen(label) * TEXT_CELL_W) / 2; // grobe Zentrierung
+  int16_t ty = y + (BOTTOM_BAR_H / 2) - 4;
+  textDrawField(x + 2, y + 2, w - 4, BOTTOM_BAR_H - 4, label, tx, ty, textColor, boxColor);
+}
 
-  // Hervorhebung zeichnen
-  auto drawItem = [&](MenuItem item, int16_t x, int16_t w, const char *label) {
-    bool selected = (item == currentItem);
-    uint16_t boxColor = selected ? 0xFFFF : COLOR_STATUS_BG;   // weiß wenn selektiert
-    uint16_t textColor = selected ? COLOR_STATUS_BG : 0xFFFF; // invertierte Schrift
+// Zeichnet Menü mit Hervorhebung des aktuell gewählten Eintrags
+void drawBottomMenu() {
+  // Skip redraw if selection hasn't changed
+  if (currentItem == lastDrawnItem) return;
 
-    // abgerahmter Kasten
-    tft.drawRect(x + 1, y + 1, w - 2, BOTTOM_BAR_H - 2, 0xFFFF);
-    if (selected) {
-      tft.fillRect(x + 2, y + 2, w - 4, BOTTOM_BAR_H - 4, boxColor);
+  SpiCallerScope spiScope(SPI_CALLER_UI);
+  if (lastDrawnItem == (MenuItem)255) {
+    // Erstes Mal bzw. nach fillScreen: Leiste und Rahmen, dann alle Einträge
+    int16_t y = TFT_HEIGHT - BOTTOM_BAR_H;
+    tft.fillRect(0, y, TFT_WIDTH, BOTTOM_BAR_H, COLOR_STATUS_BG);
+    for (uint8_t i = 0; i < 4; i++) {
+      int16_t x, w;
+      itemBox((MenuItem)i, x, w);
+      tft.drawRect(x + 1, y + 1, w - 2, BOTTOM_BAR_H - 2, 0xFFFF);
+      drawItemInterior((MenuItem)i);
     }
+  } else {
+    // Auswahlwechsel: nur alte und neue Box, Rahmen bleiben stehen
+    drawItemInterior(lastDrawnItem);
+    drawItemInterior(currentItem);
+  }
 
-    tft.setTextColor(textColor);
-    int16_t tx = x + (w / 2) - (strlen(label) * 6) / 2; // grobe Zentrierung
-    int16_t ty = y + (BOTTOM_BAR_H / 2) - 4;
-    tft.setCursor(tx, ty);
-    tft.print(label);
-  };
-
-  drawItem(MENU_FEED, feedX, feedW, labelFeed);
-  drawItem(MENU_PLAY, playX, playW, labelPlay);
-  drawItem(MENU_REST, restX, restW, labelRest);
-  drawItem(MENU_CLEAN, cleanX, cleanW, labelClean);
-  
   // Update cache
   lastDrawnItem = currentItem;
 }
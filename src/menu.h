@@ -7,3 +7,6 @@ void updateMenuLogic();
 
 // Zeichnet das interaktive Menü unten
 void drawBottomMenu();
+
+// Nächstes drawBottomMenu() zeichnet auch ohne Auswahlwechsel (nach fillScreen)
+void invalidateBottomMenu();
@@ -1,17 +1,13 @@
 #include "particles.h"
 #include "gfx.h"
 #include "sprite_common.h"
+#include "render_list.h"
+#include "sim_clock.h"
 #include "sprites/particles.h"
 #include <math.h>
 
-constexpr uint8_t PARTICLE_MAX_WIDTH = PARTICLE_DIRT_WIDTH;
-constexpr uint8_t PARTICLE_MAX_HEIGHT = PARTICLE_DIRT_HEIGHT;
-
 Particle gParticles[MAX_PARTICLES];
-
-static struct {
-  int16_t x, y;
-} prevPositions[MAX_PARTICLES];
+static_assert(MAX_PARTICLES <= RID_COUNT - RID_PARTICLE, "particle ids out of range");
 
 // Helper: Get particle sprite dimensions
 static void getParticleWH(ParticleType type, uint8_t* w, uint8_t* h) {
@@ -30,19 +26,9 @@ static void getParticleWH(ParticleType type, uint8_t* w, uint8_t* h) {
 void initParticles() {
   for (uint8_t i = 0; i < MAX_PARTICLES; i++) {
     gParticles[i].alive = false;
-    prevPositions[i].x = -1;
-    prevPositions[i].y = -1;
   }
 }
 
-static bool shouldDrawPixel(int16_t x, int16_t y, float alpha) {
-  uint8_t pat = (x ^ y) & 3;
-  if (alpha > 0.75f) return true;
-  if (alpha > 0.50f) return pat < 3;
-  if (alpha > 0.25f) return pat < 2;
-  return pat == 0;
-}
-
 void updateParticles(float deltaTime) {
   if (deltaTime <= 0.0f || deltaTime > 0.5f) {
     deltaTime = 0.0167f;
@@ -66,126 +52,46 @@ void updateParticles(float deltaTime) {
     p.vx *= 0.98f;
     p.vy *= 0.98f;
 
+    p.prevX = p.x;
+    p.prevY = p.y;
+
     p.x += p.vx * deltaTime;
     p.y += p.vy * deltaTime;
 
     p.age += deltaTime;
     if (p.age >= p.lifetime) {
-      // Register both current and previous positions to fully erase
-      uint8_t w, h;
-      getParticleWH(p.type, &w, &h);
-      int16_t px = static_cast<int16_t>(p.x);
-      int16_t py = static_cast<int16_t>(p.y);
-      
-      if (prevPositions[i].x >= 0) {
-        addDirtyRect(prevPositions[i].x, prevPositions[i].y, w, h);
-      }
-      addDirtyRect(px, py, w, h);  // Current position too
-      
+      // Not submitted any more, the render list erases the last position
       p.alive = false;
-      prevPositions[i].x = -1;
-      prevPositions[i].y = -1;
     }
   }
 }
 
-// Restore all particle regions (call BEFORE drawing other moving objects)
-void restoreParticleRegions() {
+// Submit living particles to the render list (call during COLLECT phase)
+void drawParticles(float alpha) {
   for (uint8_t i = 0; i < MAX_PARTICLES; i++) {
-    if (prevPositions[i].x >= 0) {
-#ifdef DEBUG_GRAPHICS
-      Serial.print("[PARTICLE-RESTORE] ");
-#endif
-      if (prevPositions[i].x < PLAY_AREA_X || prevPositions[i].x >= PLAY_AREA_X + PLAY_AREA_W ||
-          prevPositions[i].y < PLAY_AREA_Y || prevPositions[i].y >= PLAY_AREA_Y + PLAY_AREA_H) {
-        prevPositions[i].x = -1;
-        prevPositions[i].y = -1;
-        continue;
-      }
-      uint8_t w, h;
-      // Use last known type if particle still alive, otherwise default
-      if (gParticles[i].alive) {
-        getParticleWH(gParticles[i].type, &w, &h);
-      } else {
-        w = PARTICLE_MAX_WIDTH;
-        h = PARTICLE_MAX_HEIGHT;
-      }
-      int16_t margin = 2;
-      int16_t rx = max((int16_t)PLAY_AREA_X, (int16_t)(prevPositions[i].x - margin));
-      int16_t ry = max((int16_t)PLAY_AREA_Y, (int16_t)(prevPositions[i].y - margin));
-      int16_t rw = min((int16_t)(w + margin * 2), (int16_t)(PLAY_AREA_X + PLAY_AREA_W - rx));
-      int16_t rh = min((int16_t)(h + margin * 2), (int16_t)(PLAY_AREA_Y + PLAY_AREA_H - ry));
-      if (rw > 0 && rh > 0) {
-        restoreRegion(rx, ry, rw, rh);
-      }
-      prevPositions[i].x = -1;
-      prevPositions[i].y = -1;
-    }
-  }
-}
+    if (!gParticles[i].alive) continue;
 
-void drawParticles() {
-  FramePhase phase = getFramePhase();
-  
-  // COLLECT phase: Register dirty rects
-  if (phase == PHASE_COLLECT) {
-    for (uint8_t i = 0; i < MAX_PARTICLES; i++) {
-      if (!gParticles[i].alive) continue;
+    Particle& p = gParticles[i];
+    int16_t px = static_cast<int16_t>(simLerp(p.prevX, p.x, alpha));
+    int16_t py = static_cast<int16_t>(simLerp(p.prevY, p.y, alpha));
 
-      Particle& p = gParticles[i];
-      int16_t px = static_cast<int16_t>(p.x);
-      int16_t py = static_cast<int16_t>(p.y);
+    float fade = 1.0f - (p.age / p.lifetime);
+    fade = constrain(fade, 0.0f, 1.0f);
 
-      uint8_t w, h;
-      getParticleWH(p.type, &w, &h);
+    const uint16_t* sprite = nullptr;
+    uint8_t w, h;
+    getParticleWH(p.type, &w, &h);
 
-      // Register dirty rect for particle (current + previous position)
-      addDirtyRectPair(px, py, w, h, prevPositions[i].x, prevPositions[i].y);
+    switch (p.type) {
+      case PARTICLE_DIRT:
+        sprite = particle_dirt;
+        break;
+      default:
+        break;
     }
-  }
-  // DRAW phase: Draw particles and commit positions
-  else if (phase == PHASE_DRAW) {
-    for (uint8_t i = 0; i < MAX_PARTICLES; i++) {
-      if (!gParticles[i].alive) continue;
-
-      Particle& p = gParticles[i];
-      int16_t px = static_cast<int16_t>(p.x);
-      int16_t py = static_cast<int16_t>(p.y);
-
-      float alpha = 1.0f - (p.age / p.lifetime);
-      alpha = constrain(alpha, 0.0f, 1.0f);
-
-      const uint16_t* sprite = nullptr;
-      uint8_t w = 8, h = 8;
-
-      switch (p.type) {
-        case PARTICLE_DIRT:
-          sprite = particle_dirt;
-          w = PARTICLE_DIRT_WIDTH;
-          h = PARTICLE_DIRT_HEIGHT;
-          break;
-        default:
-          break;
-      }
-
-      if (sprite) {
-        for (uint8_t dy = 0; dy < h; dy++) {
-          for (uint8_t dx = 0; dx < w; dx++) {
-            int16_t sx = px + dx;
-            int16_t sy = py + dy;
-            if (sx < PLAY_AREA_X || sx >= PLAY_AREA_X + PLAY_AREA_W ||
-                sy < PLAY_AREA_Y || sy >= PLAY_AREA_Y + PLAY_AREA_H) continue;
-            uint16_t color = pgm_read_word(&sprite[dy * w + dx]);
-            if (color != TRANSPARENT_COLOR && shouldDrawPixel(sx, sy, alpha)) {
-              tft.drawPixel(sx, sy, color);
-            }
-          }
-        }
-      }
-
-      // Commit current position for next frame
-      prevPositions[i].x = px;
-      prevPositions[i].y = py;
+
+    if (sprite) {
+      renderSubmitBlended(RID_PARTICLE + i, LAYER_PARTICLES, sprite, w, h, px, py, fade);
     }
   }
 }
@@ -195,6 +101,8 @@ static void spawnParticle(float x, float y, float vx, float vy, ParticleType typ
     if (!gParticles[i].alive) {
       gParticles[i].x = x;
       gParticles[i].y = y;
+      gParticles[i].prevX = x;
+      gParticles[i].prevY = y;
       gParticles[i].vx = vx;
       gParticles[i].vy = vy;
       gParticles[i].type = type;
@@ -8,6 +8,7 @@ enum ParticleType {
 
 struct Particle {
   float x, y;
+  float prevX, prevY;   // Position vor dem letzten Simulationsschritt
   float vx, vy;
   ParticleType type;
   uint8_t frame;
@@ -20,7 +21,6 @@ constexpr uint8_t MAX_PARTICLES = 30;
 
 void initParticles();
 void updateParticles(float deltaTime);
-void restoreParticleRegions();
-void drawParticles();
+void drawParticles(float alpha);   // interpoliert zwischen den letzten beiden Schritten
 
 void spawnDirtPuff(float centerX, float centerY, uint8_t count);
@@ -3,167 +3,216 @@
 #include "config.h"
 #include "pet.h"
 #include "eeprom_store.h"
-#include "buttons.h"
+#include "Buttons.h"
+#include "text_atlas.h"
+#include <stdio.h>
 
-PauseChoice runPauseMenu()
+// Panel innerhalb der Play-Area (16..150), damit Status- und Bottom-Bar frei bleiben
+static const int16_t PANEL_X = 30;
+static const int16_t PANEL_Y = 24;
+static const int16_t PANEL_W = TFT_WIDTH - 60;
+static const int16_t PANEL_H = 122;
+static const uint16_t PANEL_BG = 0x18C3;
+
+static const uint8_t NUM_STATS = 5;
+static const int16_t STATS_Y = PANEL_Y + 30;
+static const int16_t STATS_SPACING = 12;
+
+static const uint8_t NUM_OPTIONS = 3;
+static const int16_t OPTIONS_Y = PANEL_Y + 90;
+static const int16_t OPTIONS_SPACING = 10;
+
+static const uint32_t SAVED_MS = 800;   // "Saved!" so lange zeigen, dann weiter
+
+static uint8_t selected = 0;
+static bool showingSaved = false;
+static uint32_t savedSinceMs = 0;
+
+// Was auf dem Display steht
+static int32_t drawnStat[NUM_STATS];
+static uint8_t drawnSelected = 255;
+
+static void drawPanel()
 {
-    uint8_t selected = 0;
-    const uint8_t NUM_OPTIONS = 3;
-    int16_t maxHP = getMaxHP();
+    tft.fillRect(PANEL_X, PANEL_Y, PANEL_W, PANEL_H, PANEL_BG);
+    tft.drawRect(PANEL_X, PANEL_Y, PANEL_W, PANEL_H, 0xFFFF);
+
+    tft.setTextColor(0xFFE0);
+    tft.setTextSize(2);
+    tft.setCursor(80, PANEL_Y + 8);
+    tft.print("PAUSED");
+}
 
-    while (true)
+// Aktueller Wert einer Statuszeile (Alter in Minuten)
+static int32_t statValue(uint8_t i)
+{
+    switch (i)
     {
-        tft.fillRect(30, 40, TFT_WIDTH - 60, TFT_HEIGHT - 80, 0x18C3);
-        tft.drawRect(30, 40, TFT_WIDTH - 60, TFT_HEIGHT - 80, 0xFFFF);
-
-        tft.setTextColor(0xFFE0);
-        tft.setTextSize(2);
-        tft.setCursor(80, 50);
-        tft.print("PAUSED");
-
-        tft.setTextColor(0xFFFF);
-        tft.setTextSize(1);
-        int16_t statsY = 72;
-        tft.setCursor(40, statsY);
-        tft.print("Hunger: ");
-        tft.print(pet.hunger);
-
-        tft.setCursor(40, statsY + 12);
-        tft.print("Fun: ");
-        tft.print(pet.fun);
-
-        tft.setCursor(40, statsY + 24);
-        tft.print("Energy: ");
-        tft.print(pet.energy);
-
-        tft.setCursor(40, statsY + 36);
-        tft.print("HP: ");
-        tft.print(pet.hp);
-        tft.print("/");
-        tft.print(maxHP);
-
-        tft.setCursor(40, statsY + 48);
-        tft.print("Age: ");
-        uint32_t hours = pet.ageSec / 3600;
-        uint32_t mins = (pet.ageSec % 3600) / 60;
-        if (hours > 0) {
-            tft.print(hours);
-            tft.print("h ");
-        }
-        tft.print(mins);
-        tft.print("m");
+    case 0: return pet.hunger;
+    case 1: return pet.fun;
+    case 2: return pet.energy;
+    case 3: return pet.hp;
+    default: return pet.ageSec / 60;
+    }
+}
 
-        const char *options[NUM_OPTIONS] = {"Resume", "Save & Resume", "Save & Exit"};
-        int16_t startY = 140;
-        int16_t spacing = 16;
+// Eine Zeile komplett als Textfeld (Hintergrund + Schrift in einem Window)
+static void drawStat(uint8_t i, int32_t value)
+{
+    int16_t y = STATS_Y + i * STATS_SPACING;
+    char line[32];
 
-        tft.setTextSize(1);
-        for (uint8_t i = 0; i < NUM_OPTIONS; i++)
-        {
-            int16_t y = startY + i * spacing;
-
-            if (i == selected)
-            {
-                tft.setTextColor(0xFFE0);
-            }
-            else
-            {
-                tft.setTextColor(0xFFFF);
-            }
-
-            tft.setCursor(40, y);
-            if (i == selected)
-            {
-                tft.print("> ");
-            }
-            else
-            {
-                tft.print("  ");
-            }
-            tft.print(options[i]);
-        }
+    switch (i)
+    {
+    case 0:
+        snprintf(line, sizeof(line), "Hunger: %ld", (long)value);
+        break;
+    case 1:
+        snprintf(line, sizeof(line), "Fun: %ld", (long)value);
+        break;
+    case 2:
+        snprintf(line, sizeof(line), "Energy: %ld", (long)value);
+        break;
+    case 3:
+        snprintf(line, sizeof(line), "HP: %ld/%d", (long)value, (int)getMaxHP());
+        break;
+    default:
+    {
+        uint32_t hours = value / 60;
+        uint32_t mins = value % 60;
+        if (hours > 0)
+            snprintf(line, sizeof(line), "Age: %luh %lum", (unsigned long)hours, (unsigned long)mins);
+        else
+            snprintf(line, sizeof(line), "Age: %lum", (unsigned long)mins);
+        break;
+    }
+    }
+    textDrawField(40, y, 160, TEXT_CELL_H, line, 40, y, 0xFFFF, PANEL_BG);
+    drawnStat[i] = value;
+}
+
+static void drawOption(uint8_t i)
+{
+    static const char *options[NUM_OPTIONS] = {"Resume", "Save & Resume", "Save & Exit"};
+    int16_t y = OPTIONS_Y + i * OPTIONS_SPACING;
+    char line[24];
+    snprintf(line, sizeof(line), "%s%s", i == selected ? "> " : "  ", options[i]);
+    textDrawField(40, y, 120, TEXT_CELL_H, line, 40, y, i == selected ? 0xFFE0 : 0xFFFF, PANEL_BG);
+}
 
-        delay(100);
+static PauseChoice closeMenu(PauseChoice choice)
+{
+    Buttons.consumeHeld();
+    setDirtyOccluder(0, 0, 0, 0);
+    return choice;
+}
 
-        Buttons.poll();
-        bool btnLeftPressed = false;
-        bool btnOkPressed = false;
-        bool btnRightPressed = false;
-        Buttons.getAndClearPressed(btnLeftPressed, btnOkPressed, btnRightPressed);
+void pauseMenuOpen()
+{
+    SpiCallerScope spiScope(SPI_CALLER_UI);
+    selected = 0;
+    showingSaved = false;
+    drawPanel();
+    for (uint8_t i = 0; i < NUM_STATS; i++)
+        drawStat(i, statValue(i));
+    for (uint8_t i = 0; i < NUM_OPTIONS; i++)
+        drawOption(i);
+    drawnSelected = selected;
+    setDirtyOccluder(PANEL_X, PANEL_Y, PANEL_W, PANEL_H);
+}
 
-        if (btnLeftPressed)
-        {
+PauseChoice pauseMenuUpdate()
+{
+    SpiCallerScope spiScope(SPI_CALLER_UI);
+
+    if (showingSaved)
+    {
+        if (millis() - savedSinceMs < SAVED_MS)
+            return PAUSE_PENDING;
+        return closeMenu(PAUSE_RESUME);
+    }
+
+    bool btnLeftPressed = false;
+    bool btnOkPressed = false;
+    bool btnRightPressed = false;
+    Buttons.getAndClearPressed(btnLeftPressed, btnOkPressed, btnRightPressed);
+
+    if (btnLeftPressed)
+    {
 #ifdef DEBUG_BUTTONS
-            Serial.print("[PAUSE] Navigate UP - Selected: ");
-            Serial.println(selected);
+        Serial.print("[PAUSE] Navigate UP - Selected: ");
+        Serial.println(selected);
 #endif
-            if (selected == 0)
-            {
-                selected = NUM_OPTIONS - 1;
-            }
-            else
-            {
-                selected--;
-            }
+        if (selected == 0)
+        {
+            selected = NUM_OPTIONS - 1;
         }
-
-        if (btnRightPressed)
+        else
         {
+            selected--;
+        }
+    }
+
+    if (btnRightPressed)
+    {
 #ifdef DEBUG_BUTTONS
-            Serial.print("[PAUSE] Navigate DOWN - Selected: ");
-            Serial.println(selected);
+        Serial.print("[PAUSE] Navigate DOWN - Selected: ");
+        Serial.println(selected);
 #endif
-            selected = (selected + 1) % NUM_OPTIONS;
-        }
+        selected = (selected + 1) % NUM_OPTIONS;
+    }
 
-        if (btnOkPressed)
-        {
+    if (btnOkPressed)
+    {
 #ifdef DEBUG_BUTTONS
-            Serial.print("[PAUSE] OK pressed on option: ");
-            Serial.println(selected);
+        Serial.print("[PAUSE] OK pressed on option: ");
+        Serial.println(selected);
 #endif
 
-            if (selected == PAUSE_SAVE_RESUME)
-            {
+        if (selected == PAUSE_SAVE_RESUME)
+        {
 #ifdef DEBUG_BUTTONS
-                Serial.println("[PAUSE] Action: SAVE & RESUME");
+            Serial.println("[PAUSE] Action: SAVE & RESUME");
 #endif
-                saveFullIfDue(pet.hunger, pet.fun, pet.energy, pet.hp, pet.ageSec, pet.dead, true);
-
-                tft.fillRect(40, TFT_HEIGHT - 40, TFT_WIDTH - 80, 20, 0x0000);
-                tft.setTextColor(0x07E0);
-                tft.setTextSize(1);
-                tft.setCursor(80, TFT_HEIGHT - 35);
-                tft.print("Saved!");
-                delay(800);
-
-                while (digitalRead(PIN_BTN_OK) == LOW)
-                    ;
-
-                return PAUSE_RESUME;
-            }
-            else if (selected == PAUSE_SAVE_EXIT)
-            {
+            saveFullIfDue(pet.hunger, pet.fun, pet.energy, pet.hp, pet.ageSec, pet.dead, true);
+
+            tft.setTextColor(0x07E0);
+            tft.setTextSize(1);
+            tft.setCursor(PANEL_X + PANEL_W - 60, PANEL_Y + 12);
+            tft.print("Saved!");
+            savedSinceMs = millis();
+            showingSaved = true;
+            return PAUSE_PENDING;
+        }
+        else if (selected == PAUSE_SAVE_EXIT)
+        {
 #ifdef DEBUG_BUTTONS
-                Serial.println("[PAUSE] Action: SAVE & EXIT");
+            Serial.println("[PAUSE] Action: SAVE & EXIT");
 #endif
-                saveFullIfDue(pet.hunger, pet.fun, pet.energy, pet.hp, pet.ageSec, pet.dead, true);
-
-                while (digitalRead(PIN_BTN_OK) == LOW)
-                    ;
-
-                return PAUSE_SAVE_EXIT;
-            }
-            else
-            {
+            saveFullIfDue(pet.hunger, pet.fun, pet.energy, pet.hp, pet.ageSec, pet.dead, true);
+            return closeMenu(PAUSE_SAVE_EXIT);
+        }
+        else
+        {
 #ifdef DEBUG_BUTTONS
-                Serial.println("[PAUSE] Action: RESUME");
+            Serial.println("[PAUSE] Action: RESUME");
 #endif
-                while (digitalRead(PIN_BTN_OK) == LOW)
-                    ;
-
-                return PAUSE_RESUME;
-            }
+            return closeMenu(PAUSE_RESUME);
         }
     }
+
+    // Nur geänderte Zeilen: alte und neue Auswahl, Werte, die sich bewegt haben
+    if (selected != drawnSelected)
+    {
+        drawOption(drawnSelected);
+        drawOption(selected);
+        drawnSelected = selected;
+    }
+    for (uint8_t i = 0; i < NUM_STATS; i++)
+    {
+        int32_t value = statValue(i);
+        if (value != drawnStat[i])
+            drawStat(i, value);
+    }
+    return PAUSE_PENDING;
 }
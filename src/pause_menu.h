@@ -1,9 +1,18 @@
 #pragma once
+#include <Arduino.h>
 
 enum PauseChoice {
   PAUSE_RESUME,
   PAUSE_SAVE_RESUME,
-  PAUSE_SAVE_EXIT
+  PAUSE_SAVE_EXIT,
+  PAUSE_PENDING   // Menü bleibt offen
 };
 
-PauseChoice runPauseMenu();
+// Pausemenü als Overlay über der Play-Area, Zustand im normalen Frame-Loop.
+// pauseMenuOpen() zeichnet das Panel einmal und meldet es als verdeckt an
+// (setDirtyOccluder), das Aquarium dahinter läuft weiter. pauseMenuUpdate()
+// einmal pro Frame: Tasten auswerten, nur geänderte Zeilen neu zeichnen.
+// Mit einer Wahl gibt das Menü die Fläche wieder frei, der nächste Frame
+// baut sie aus Hintergrund und Sprites neu auf.
+void pauseMenuOpen();
+PauseChoice pauseMenuUpdate();
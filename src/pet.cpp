@@ -7,6 +7,8 @@
 #include "dirt.h"
 #include "eeprom_store.h"
 #include "environment.h"
+#include "render_list.h"
+#include "sim_clock.h"
 
 static constexpr uint32_t LIFE_YEAR_SEC = 24ul*60*60;
 static constexpr uint32_t BAD_START_SEC = 3600;
@@ -23,9 +25,6 @@ static float fishY = 0.0f;
 float fishVX = 0.0f;
 float fishVY = 0.0f;
 
-static float prevFishDrawX = -1.0f;
-static float prevFishDrawY = -1.0f;
-
 // aktueller Ziel-Wegpunkt
 static float targetX = 0.0f;
 static float targetY = 0.0f;
@@ -34,6 +33,11 @@ static bool petInitDone = false;
 // Swim phase for organic movement
 static float swimPhase = 0.0f;
 
+// Stand vor dem letzten Simulationsschritt (Interpolation beim Zeichnen)
+static float prevFishX = 0.0f;
+static float prevFishY = 0.0f;
+static float prevSwimPhase = 0.0f;
+
 // Movement noise for natural behavior
 static float noiseAccum = 0.0f;
 static float noiseValue = 0.0f;
@@ -101,6 +105,9 @@ void initPet() {
   fishY = PLAY_AREA_Y + PLAY_AREA_H / 2.0f;
   fishVX = 0.0f;
   fishVY = 0.0f;
+  prevFishX = fishX;
+  prevFishY = fishY;
+  prevSwimPhase = swimPhase;
 
   nextPoopAt = random(2, 10);
   
@@ -404,12 +411,12 @@ static void updateFishMovement(float dtSec) {
   }
 }
 
-// Zeichnet Fisch + leichte Sinus-Animation
-void drawPetAnimated(float dtSec) {
-  FramePhase phase = getFramePhase();
-  
-  // COLLECT phase: Update physics and register dirty rects
-  if (phase == PHASE_COLLECT) {
+// Ein Simulationsschritt: Bewegung, Animator, Aktionen
+void updatePet(float dtSec) {
+    prevFishX = fishX;
+    prevFishY = fishY;
+    prevSwimPhase = swimPhase;
+
     updateFishMovement(dtSec);
     updateAnimator(dtSec);
 
@@ -597,6 +604,12 @@ void drawPetAnimated(float dtSec) {
     saveFullIfDue(pet.hunger, pet.fun, pet.energy, pet.hp, pet.ageSec, pet.dead, true);
     pendingAction = ACTION_NONE;
   }
+}
+
+// Leichte Sinus-Animation auf der interpolierten Position, reicht den Fisch
+// in die Render-Liste ein
+void drawPetAnimated(float alpha) {
+    float phase = simLerpWrapped(prevSwimPhase, swimPhase, alpha, 2.0f * PI);
 
     // Speed-dependent tail movement using swimPhase
     float speedNorm = sqrtf(fishVX*fishVX + fishVY*fishVY) / FISH_MAX_SPEED;
@@ -607,8 +620,8 @@ void drawPetAnimated(float dtSec) {
     float ampScale = (gAnimator.transitionProgress < 1.0f) 
                      ? (0.3f + 0.7f * gAnimator.transitionProgress)
                      : 1.0f;
-    float swing = sinf(swimPhase) * swingAmp * ampScale;
-    float bob = sinf(swimPhase * 0.8f) * bobAmp * ampScale;
+    float swing = sinf(phase) * swingAmp * ampScale;
+    float bob = sinf(phase * 0.8f) * bobAmp * ampScale;
     
     // Add chewing wobble during EATING animation (4 Hz up-down motion)
     if (gAnimator.currentState == ANIM_EATING && actionInProgress) {
@@ -616,69 +629,15 @@ void drawPetAnimated(float dtSec) {
       bob += sinf(chewPhase) * 3.0f; // 3 pixel vertical wobble
     }
 
-    int16_t x = static_cast<int16_t>(fishX + swing - CLOWNFISH_WIDTH / 2);
-    int16_t y = static_cast<int16_t>(fishY + bob - CLOWNFISH_HEIGHT / 2);
+    int16_t x = static_cast<int16_t>(simLerp(prevFishX, fishX, alpha) + swing - CLOWNFISH_WIDTH / 2);
+    int16_t y = static_cast<int16_t>(simLerp(prevFishY, fishY, alpha) + bob - CLOWNFISH_HEIGHT / 2);
 
     // Clamp to play area to prevent UI ghosting
     x = constrain(x, (int16_t)PLAY_AREA_X, (int16_t)(PLAY_AREA_X + PLAY_AREA_W - CLOWNFISH_WIDTH));
     y = constrain(y, (int16_t)PLAY_AREA_Y, (int16_t)(PLAY_AREA_Y + PLAY_AREA_H - CLOWNFISH_HEIGHT));
 
-    // Register dirty rect for fish (current + previous position)
-    addDirtyRectPair(x, y, CLOWNFISH_WIDTH, CLOWNFISH_HEIGHT, prevFishDrawX, prevFishDrawY);
-  }
-  // DRAW phase: Draw fish and commit position
-  else if (phase == PHASE_DRAW) {
-    // Speed-dependent tail movement using swimPhase
-    float speedNorm = sqrtf(fishVX*fishVX + fishVY*fishVY) / FISH_MAX_SPEED;
-    float swingAmp = 3.0f + speedNorm * 3.0f;
-    float bobAmp = 2.0f + speedNorm * 2.0f;
-    
-    float ampScale = (gAnimator.transitionProgress < 1.0f) 
-                     ? (0.4f + 0.6f * gAnimator.transitionProgress)
-                     : 1.0f;
-    float swing = sinf(swimPhase) * swingAmp * ampScale;
-    float bob = sinf(swimPhase * 0.7f) * bobAmp * ampScale;
-    
-    if (gAnimator.currentState == ANIM_EATING && actionInProgress) {
-      float chewPhase = actionTimer * 4.0f * 2.0f * PI;
-      bob += sinf(chewPhase) * 3.0f;
-    }
-
-    const uint16_t* frame = getCurrentFrame();
-    bool flip = isFlipped();
-
-    int16_t x = static_cast<int16_t>(fishX + swing - CLOWNFISH_WIDTH / 2);
-    int16_t y = static_cast<int16_t>(fishY + bob - CLOWNFISH_HEIGHT / 2);
-
-    x = constrain(x, (int16_t)PLAY_AREA_X, (int16_t)(PLAY_AREA_X + PLAY_AREA_W - CLOWNFISH_WIDTH));
-    y = constrain(y, (int16_t)PLAY_AREA_Y, (int16_t)(PLAY_AREA_Y + PLAY_AREA_H - CLOWNFISH_HEIGHT));
-
-    drawSpriteOptimized(frame, CLOWNFISH_WIDTH, CLOWNFISH_HEIGHT, x, y, flip);
-
-    // Commit current position for next frame
-    prevFishDrawX = x;
-    prevFishDrawY = y;
-  }
-}
-
-void restorePetRegion() {
-  if (prevFishDrawX >= 0) {
-#ifdef DEBUG_GRAPHICS
-    Serial.print("[FISH-RESTORE] ");
-#endif
-    int16_t margin = 1; // Reduced from 8 - only need small margin for swing/bob
-    int16_t rx = max((int16_t)PLAY_AREA_X, (int16_t)(prevFishDrawX - margin));
-    int16_t ry = max((int16_t)PLAY_AREA_Y, (int16_t)(prevFishDrawY - margin));
-    int16_t rw = min((int16_t)(CLOWNFISH_WIDTH + margin * 2), (int16_t)(PLAY_AREA_X + PLAY_AREA_W - rx));
-    int16_t rh = min((int16_t)(CLOWNFISH_HEIGHT + margin * 2), (int16_t)(PLAY_AREA_Y + PLAY_AREA_H - ry));
-    if (rw > 0 && rh > 0) {
-      restoreRegion(rx, ry, rw, rh);
-    }
-    
-    // Invalidate after restore to prevent double-restore
-    prevFishDrawX = -1;
-    prevFishDrawY = -1;
-  }
+    // Einmal platzieren: Dirty-Region und Zeichnen kommen aus der Render-Liste
+    renderSubmitSpans(RID_FISH, LAYER_FISH, *getCurrentFrame(), x, y, isFlipped());
 }
 
 float getFishX() { return fishX; }
@@ -23,11 +23,12 @@ void updatePetStats();
 // Returns max HP based on age
 int16_t getMaxHP();
 
-// Stellt die vorherige Fischregion wieder her
-void restorePetRegion();
+// Fisch: Wegpunkt-Navigation, Animator und Aktionen (ein Simulationsschritt)
+void updatePet(float dtSec);
 
-// Zeichnet Fisch mit Animation & Wegpunkt-Navigation
-void drawPetAnimated(float dtSec);
+// Fisch mit Sinus-Animation, interpoliert zwischen den letzten beiden
+// Schritten (COLLECT, zeichnet über die Render-Liste)
+void drawPetAnimated(float alpha);
 
 // Aktionen, die über das Menü ausgelöst werden
 enum PetAction {
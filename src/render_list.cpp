@@ -0,0 +1,199 @@
+#include "render_list.h"
+#include "gfx.h"
+#include "blend565.h"
+
+// Zwei Listen im Wechsel: eine wird in diesem Frame gefüllt, die andere
+// beschreibt, was gerade auf dem Display steht
+static RenderNode nodes[2][MAX_RENDER_NODES];
+static uint8_t nodeCount[2] = {0, 0};
+static uint8_t curList = 0;
+
+// Stand von getBackgroundBlitCount() beim letzten renderListDraw()
+static uint32_t drawnBlitCount = 0;
+
+// Größte Bewegung eines Knotens im letzten renderListCollectDirty()
+static uint16_t motionPx = 0;
+
+// Snapshot, in den die Simulation gerade einreicht (nur Simulationsseite)
+static RenderSnapshot* target = nullptr;
+
+static RenderNode* allocNode(uint8_t id, RenderLayer layer, int16_t x, int16_t y) {
+  if (!target || id >= RID_COUNT || target->nodeCount >= MAX_RENDER_NODES) {
+#ifdef DEBUG_GRAPHICS
+    Serial.print("[RENDER] node dropped, id ");
+    Serial.println(id);
+#endif
+    return nullptr;
+  }
+  RenderNode* n = &target->nodes[target->nodeCount++];
+  n->id = id;
+  n->layer = layer;
+  n->x = x;
+  n->y = y;
+  n->flipX = false;
+  n->spans = nullptr;
+  n->bitmap = nullptr;
+  n->w = 0;
+  n->h = 0;
+  n->alpha = BLEND_ALPHA_OPAQUE;
+  n->changed = true;
+  return n;
+}
+
+void renderListBegin(RenderSnapshot& snap) {
+  snap.nodeCount = 0;
+  target = &snap;
+}
+
+void renderSubmitSpans(uint8_t id, RenderLayer layer, const SpriteSpanTable& table,
+                       int16_t x, int16_t y, bool flipX) {
+  RenderNode* n = allocNode(id, layer, x, y);
+  if (!n) return;
+  n->spans = &table;
+  n->flipX = flipX;
+}
+
+void renderSubmitBlended(uint8_t id, RenderLayer layer, const uint16_t* bitmap,
+                         uint16_t w, uint16_t h, int16_t x, int16_t y, float alpha) {
+  RenderNode* n = allocNode(id, layer, x, y);
+  if (!n) return;
+  n->bitmap = bitmap;
+  n->w = w;
+  n->h = h;
+  n->alpha = blendAlpha5(alpha);   // gleiche Stufe = unverändert, kein Redraw
+}
+
+// Gleiches Bild an gleicher Stelle wie im letzten Frame?
+static bool sameAsPrev(const RenderNode& n, const RenderNode& p) {
+  return n.spans == p.spans && n.bitmap == p.bitmap &&
+         n.x == p.x && n.y == p.y && n.flipX == p.flipX &&
+         n.w == p.w && n.h == p.h && n.alpha == p.alpha;
+}
+
+// Deckende Bounding-Box auf dem Display
+static DirtyRect nodeBox(const RenderNode& n) {
+  if (n.spans) {
+    const SpriteSpanTable& t = *n.spans;
+    return {spanOriginX(t, n.x, n.flipX), (int16_t)(n.y + t.oy), (int16_t)t.w, (int16_t)t.h, true};
+  }
+  return {n.x, n.y, (int16_t)n.w, (int16_t)n.h, true};
+}
+
+// Knoten ohne Partner im anderen Frame: nur seine eigene Fläche
+static void addDirtyNode(const RenderNode& n) {
+  if (n.spans) {
+    addDirtySilhouette(*n.spans, n.x, n.y, n.flipX, nullptr, 0, 0, false);
+  } else {
+    addDirtyRect(n.x, n.y, n.w, n.h);
+  }
+}
+
+void renderListCollectDirty(const RenderSnapshot& snap) {
+  memcpy(nodes[curList], snap.nodes, snap.nodeCount * sizeof(RenderNode));
+  nodeCount[curList] = snap.nodeCount;
+
+  RenderNode* cur = nodes[curList];
+  const RenderNode* prev = nodes[curList ^ 1];
+  uint8_t curCount = nodeCount[curList];
+  uint8_t prevCount = nodeCount[curList ^ 1];
+
+  // Seit dem letzten Frame komplett übermalt (Pause-Menü, Start): nichts
+  // steht mehr, jeder Knoten braucht seine Fläche. Mit COMPOSE_DIRTY_RECTS
+  // landen Sprites nur innerhalb der Dirty-Rects auf dem Display.
+  bool repainted = getBackgroundBlitCount() != drawnBlitCount;
+  uint32_t motion = 0;
+
+  uint8_t prevById[RID_COUNT];
+  memset(prevById, 0xFF, sizeof(prevById));
+  for (uint8_t i = 0; i < prevCount; i++) {
+    prevById[prev[i].id] = i;
+  }
+
+  for (uint8_t i = 0; i < curCount; i++) {
+    RenderNode& n = cur[i];
+    uint8_t pi = prevById[n.id];
+    prevById[n.id] = 0xFF;  // gepaart, siehe Restschleife unten
+
+    if (pi == 0xFF) {
+      addDirtyNode(n);
+      motion = max<uint32_t>(motion, FRAME_GOV_CHANGE_PX);
+      continue;
+    }
+    const RenderNode& p = prev[pi];
+    if (sameAsPrev(n, p)) {
+      if (!repainted) {
+        n.changed = false;
+        continue;
+      }
+    } else {
+      uint32_t m = abs(n.x - p.x) + abs(n.y - p.y);
+      if (n.spans != p.spans || n.bitmap != p.bitmap || n.flipX != p.flipX || n.alpha != p.alpha) {
+        m += FRAME_GOV_CHANGE_PX;
+      }
+      motion = max(motion, m);
+    }
+    if (n.spans && p.spans) {
+      addDirtySilhouette(*n.spans, n.x, n.y, n.flipX, p.spans, p.x, p.y, p.flipX);
+    } else {
+      addDirtyNode(n);
+      addDirtyNode(p);
+    }
+  }
+
+  // Im letzten Frame gezeichnet, jetzt nicht mehr: alte Fläche löschen
+  for (uint8_t id = 0; id < RID_COUNT; id++) {
+    if (prevById[id] == 0xFF) continue;
+    addDirtyNode(prev[prevById[id]]);
+    motion = max<uint32_t>(motion, FRAME_GOV_CHANGE_PX);
+  }
+  motionPx = min<uint32_t>(motion, 0xFFFF);
+}
+
+uint16_t renderListMotionPx() {
+  return motionPx;
+}
+
+static bool overlaps(const DirtyRect& a, const DirtyRect& b) {
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+void renderListDraw() {
+  const RenderNode* cur = nodes[curList];
+  uint8_t count = nodeCount[curList];
+
+  // Blit zwischen COLLECT und DRAW: Compose ist dann nicht offen, die
+  // Sprites zeichnen direkt und müssen alle wieder hin
+  uint32_t blitCount = getBackgroundBlitCount();
+  bool repainted = blitCount != drawnBlitCount;
+  drawnBlitCount = blitCount;
+
+  // Boxen der schon gezeichneten Knoten: ein direkt gezeichnetes Sprite
+  // überschreibt auch Pixel außerhalb der Dirty-Rects, alles darüber muss mit
+  DirtyRect drawn[MAX_RENDER_NODES];
+  uint8_t drawnCount = 0;
+
+  // Wenige Knoten, wenige Ebenen: ein Durchlauf pro Ebene hält die
+  // Einreichungsreihenfolge innerhalb einer Ebene stabil
+  for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
+    for (uint8_t i = 0; i < count; i++) {
+      const RenderNode& n = cur[i];
+      if (n.layer != layer) continue;
+
+      DirtyRect box = nodeBox(n);
+      bool draw = n.changed || repainted || dirtyRectsIntersect(box.x, box.y, box.w, box.h);
+      for (uint8_t k = 0; !draw && k < drawnCount; k++) {
+        draw = overlaps(box, drawn[k]);
+      }
+      if (!draw) continue;
+      drawn[drawnCount++] = box;
+
+      if (n.spans) {
+        drawSpriteSpans(*n.spans, n.x, n.y, n.flipX);
+      } else {
+        drawSpriteBlended(n.bitmap, n.w, n.h, n.x, n.y, n.alpha);
+      }
+    }
+  }
+
+  curList ^= 1;
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <Arduino.h>
+#include "sprite_common.h"
+#include "gfx.h"
+
+// ---- Render-Liste: Sprite-Platzierung einmal pro Frame ----
+// Die Entities rechnen in COLLECT ihre Position aus und reichen pro
+// sichtbarem Sprite genau einen Knoten ein (Sprite, Position, Flip, Ebene).
+// Die Dirty-Regionen entstehen aus dem Vergleich mit der Liste des letzten
+// Frames, gezeichnet wird in DRAW aus derselben Liste nach Ebene sortiert.
+// Kein Modul merkt sich mehr selbst seine alte Position.
+// Eingereicht wird in einen RenderSnapshot, den die Simulation füllt und der
+// Render-Teil (ggf. auf dem anderen Kern, siehe frame_pipeline.h) übernimmt.
+// Ein Knoten, der exakt wie im letzten Frame dasteht (Sprite, x, y, Flip,
+// alpha), erzeugt weder Restore noch Redraw, solange nichts anderes über
+// oder unter ihm neu gezeichnet wird.
+
+// Ebenen in Zeichenreihenfolge (hinten -> vorne)
+enum RenderLayer : uint8_t {
+  LAYER_BUBBLES = 0,
+  LAYER_SEAHORSE,
+  LAYER_SHRIMP,
+  LAYER_FISH,
+  LAYER_PARTICLES,
+  LAYER_COUNT
+};
+
+// Stabile Kennung pro Entity, verbindet einen Knoten mit seinem Vorgänger
+// im letzten Frame. Pools belegen einen Block ab ihrer Basis (+ Index).
+enum RenderId : uint8_t {
+  RID_FISH = 0,
+  RID_SHRIMP,
+  RID_SEAHORSE1,
+  RID_SEAHORSE2,
+  RID_BUBBLE = 8,       // + Bubble-Index (max. 16)
+  RID_PARTICLE = 24,    // + Partikel-Index (max. 32)
+  RID_COUNT = 56
+};
+
+constexpr uint8_t MAX_RENDER_NODES = 48;
+
+struct RenderNode {
+  uint8_t id;
+  uint8_t layer;
+  bool flipX;
+  int16_t x, y;
+  const SpriteSpanTable* spans;  // Span-Sprite (Silhouetten-Dirty) oder ...
+  const uint16_t* bitmap;        // ... RGB565-Bitmap, geblendet mit alpha
+  uint16_t w, h;                 // nur für bitmap
+  uint8_t alpha;                 // 0..BLEND_ALPHA_OPAQUE
+  bool changed;                  // von renderListCollectDirty() gesetzt
+};
+
+// Sprites eines Simulationsframes: alles, was die Render-Liste braucht,
+// ohne Zustand der Module zu lesen
+struct RenderSnapshot {
+  RenderNode nodes[MAX_RENDER_NODES];
+  uint8_t nodeCount;
+};
+
+// Beginn der Simulation eines Frames: snap leeren und als Ziel setzen
+void renderListBegin(RenderSnapshot& snap);
+
+// Knoten einreichen (pro id höchstens einmal pro Frame)
+void renderSubmitSpans(uint8_t id, RenderLayer layer, const SpriteSpanTable& table,
+                       int16_t x, int16_t y, bool flipX);
+void renderSubmitBlended(uint8_t id, RenderLayer layer, const uint16_t* bitmap,
+                         uint16_t w, uint16_t h, int16_t x, int16_t y, float alpha);
+
+// COLLECT (Render-Teil): snap wird die neue Liste, Dirty-Regionen aus alter
+// und neuer Liste. Knoten gleicher id bekommen die gemeinsame Silhouette,
+// verschwundene Knoten werden gelöscht, unveränderte tragen nichts bei.
+void renderListCollectDirty(const RenderSnapshot& snap);
+
+// Größte Bewegung eines Knotens im letzten Frame in Pixeln (|dx| + |dy|,
+// Sprite-/Flip-/Alpha-Wechsel und Auf-/Abtauchen zusätzlich je
+// FRAME_GOV_CHANGE_PX). Die Bildrate richtet sich nach dem schnellsten
+// Sprite, nicht nach der Summe. Maß für den Frame-Governor.
+uint16_t renderListMotionPx();
+
+// DRAW: geänderte Knoten und alle, die ein Dirty-Rect oder einen schon
+// gezeichneten Knoten berühren, nach Ebene zeichnen. Danach wird die Liste
+// zur alten.
+void renderListDraw();
@@ -1,9 +1,9 @@
 #pragma once
 #include "gfx.h"
 
-// Seepferdchen-Animation zeichnen
-void updateAndDrawSeahorse();
-void restoreSeahorseRegion();
+// Seepferdchen-Animation: Position aus der Animationsphase berechnen und in
+// die Render-Liste eintragen
+void drawSeahorse(float phase);
 
 // Basisposition kommt aus main.cpp
 extern int16_t seahorseBaseX;
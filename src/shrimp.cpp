@@ -1,17 +1,26 @@
 #include "shrimp.h"
 #include "gfx.h"
-#include "sprites/bee_shrimp.h"
+#include "render_list.h"
+#include "sim_clock.h"
+#include "sprites/bee_shrimp_spans.h"
 
 static float shrimpX = 0;
 static float shrimpY = 0;
+static float prevShrimpX = 0;   // vor dem letzten Simulationsschritt
 static float targetX = 0;
 static float velocityX = 0;
-static int16_t lastDrawX = -1;
-static int16_t lastDrawY = -1;
 static bool movingLeft = false;
 static float animTimer = 0.0f;
 static int currentFrame = 0;
 
+static const SpriteSpanTable* currentSprite() {
+    switch(currentFrame) {
+        case 1: return &shrimp_move_BitmapSpans;
+        case 2: return &shrimp_move01_BitmapSpans;
+        default: return &bee_shrimpBitmapSpans;
+    }
+}
+
 void initShrimp() {
     // Calculate ground position (same as in main.cpp setup)
     int16_t groundH = 28;
@@ -19,96 +28,50 @@ void initShrimp() {
     
     shrimpX = random(PLAY_AREA_X, PLAY_AREA_X + PLAY_AREA_W - BEE_SHRIMP_WIDTH);
     shrimpY = groundY - 0;
+    prevShrimpX = shrimpX;
     targetX = random(PLAY_AREA_X, PLAY_AREA_X + PLAY_AREA_W - BEE_SHRIMP_WIDTH);
     velocityX = 0;
-    lastDrawX = -1;
-    lastDrawY = -1;
 }
 
-void updateAndDrawShrimp(float deltaTime) {
-    FramePhase phase = getFramePhase();
+void updateShrimp(float deltaTime) {
     const float SHRIMP_SPEED = 15.0f;
     const float TARGET_THRESHOLD = 2.0f;
 
-    // COLLECT phase: Update physics and register dirty rects
-    if (phase == PHASE_COLLECT) {
-        // Check if reached target and pick new one
-        if (abs(shrimpX - targetX) < TARGET_THRESHOLD) {
-            targetX = random(PLAY_AREA_X, PLAY_AREA_X + PLAY_AREA_W - BEE_SHRIMP_WIDTH);
-        }
-
-        // Always move toward target (no pauses)
-        if (shrimpX < targetX) {
-            velocityX = SHRIMP_SPEED;
-            movingLeft = true;
-        } else {
-            velocityX = -SHRIMP_SPEED;
-            movingLeft = false;
-        }
-
-        if (deltaTime > 0) {
-            shrimpX += velocityX * deltaTime;
-        }
-
-        shrimpX = constrain(shrimpX, (float)PLAY_AREA_X, (float)(PLAY_AREA_X + PLAY_AREA_W - BEE_SHRIMP_WIDTH));
+    prevShrimpX = shrimpX;
 
-        if (abs(velocityX) > 0.1f && deltaTime > 0) {
-            animTimer += deltaTime * 6.0f;
-            if (animTimer >= 1.0f) {
-                animTimer -= 1.0f;
-                currentFrame = (currentFrame + 1) % 3;
-            }
-        } else {
-            currentFrame = 0;
-            animTimer = 0.0f;
-        }
+    // Check if reached target and pick new one
+    if (abs(shrimpX - targetX) < TARGET_THRESHOLD) {
+        targetX = random(PLAY_AREA_X, PLAY_AREA_X + PLAY_AREA_W - BEE_SHRIMP_WIDTH);
+    }
 
-        int16_t drawX = (int16_t)shrimpX;
-        int16_t drawY = (int16_t)shrimpY;
+    // Always move toward target (no pauses)
+    if (shrimpX < targetX) {
+        velocityX = SHRIMP_SPEED;
+        movingLeft = true;
+    } else {
+        velocityX = -SHRIMP_SPEED;
+        movingLeft = false;
+    }
 
-        // Register dirty rect for shrimp (current + previous position)
-        addDirtyRectPair(drawX, drawY, BEE_SHRIMP_WIDTH, BEE_SHRIMP_HEIGHT, lastDrawX, lastDrawY);
+    if (deltaTime > 0) {
+        shrimpX += velocityX * deltaTime;
     }
-    // DRAW phase: Draw shrimp and commit position
-    else if (phase == PHASE_DRAW) {
-        const uint16_t* sprite;
-        switch(currentFrame) {
-            case 1: sprite = shrimp_move_Bitmap; break;
-            case 2: sprite = shrimp_move01_Bitmap; break;
-            default: sprite = bee_shrimpBitmap; break;
-        }
 
-        int16_t drawX = (int16_t)shrimpX;
-        int16_t drawY = (int16_t)shrimpY;
-        
-        drawSpriteOptimized(sprite, BEE_SHRIMP_WIDTH, BEE_SHRIMP_HEIGHT, drawX, drawY, movingLeft);
+    shrimpX = constrain(shrimpX, (float)PLAY_AREA_X, (float)(PLAY_AREA_X + PLAY_AREA_W - BEE_SHRIMP_WIDTH));
 
-        // Commit current position for next frame
-        lastDrawX = drawX;
-        lastDrawY = drawY;
+    if (abs(velocityX) > 0.1f && deltaTime > 0) {
+        animTimer += deltaTime * 6.0f;
+        if (animTimer >= 1.0f) {
+            animTimer -= 1.0f;
+            currentFrame = (currentFrame + 1) % 3;
+        }
+    } else {
+        currentFrame = 0;
+        animTimer = 0.0f;
     }
 }
 
-void restoreShrimpRegion() {
-  if (lastDrawX >= 0 && lastDrawY >= 0) {
-#ifdef DEBUG_GRAPHICS
-    Serial.print("[SHRIMP-RESTORE] ");
-#endif
-    const int16_t margin = 2;
-    
-    int16_t rx = max<int16_t>(PLAY_AREA_X, (int16_t)(lastDrawX - margin));
-    int16_t ry = max<int16_t>(PLAY_AREA_Y, (int16_t)(lastDrawY - margin));
-    int16_t rw = min<int16_t>((int16_t)(BEE_SHRIMP_WIDTH + 2 * margin),
-                              (int16_t)(PLAY_AREA_X + PLAY_AREA_W - rx));
-    int16_t rh = min<int16_t>((int16_t)(BEE_SHRIMP_HEIGHT + 2 * margin),
-                              (int16_t)(PLAY_AREA_Y + PLAY_AREA_H - ry));
-    
-    if (rw > 0 && rh > 0) {
-      restoreRegion(rx, ry, rw, rh);
-    }
-    
-    // Invalidate after restore to prevent double-restore
-    lastDrawX = -1;
-    lastDrawY = -1;
-  }
+void drawShrimp(float alpha) {
+    renderSubmitSpans(RID_SHRIMP, LAYER_SHRIMP, *currentSprite(),
+                      (int16_t)simLerp(prevShrimpX, shrimpX, alpha), (int16_t)shrimpY, movingLeft);
 }
@@ -2,5 +2,5 @@
 #include <Arduino.h>
 
 void initShrimp();
-void updateAndDrawShrimp(float deltaTime);
-void restoreShrimpRegion();
+void updateShrimp(float deltaTime);   // ein Simulationsschritt
+void drawShrimp(float alpha);         // Render-Liste, interpoliert (COLLECT)
@@ -0,0 +1,28 @@
+#include "sim_clock.h"
+#include "config.h"
+
+static float accumulator = 0.0f;
+
+uint8_t simClockAdvance(float dtSec) {
+  if (dtSec > 0.0f) accumulator += dtSec;
+
+  uint8_t steps = 0;
+  while (accumulator >= SIM_DT && steps < SIM_MAX_STEPS) {
+    accumulator -= SIM_DT;
+    steps++;
+  }
+  // Catch-up-Grenze erreicht: nicht in den nächsten Frame verschleppen
+  if (accumulator >= SIM_DT) {
+#ifdef DEBUG_GAME_LOGIC
+    Serial.print("[SIM] dropped ");
+    Serial.print(accumulator * 1000.0f);
+    Serial.println(" ms");
+#endif
+    accumulator = 0.0f;
+  }
+  return steps;
+}
+
+float simClockAlpha() {
+  return accumulator / SIM_DT;
+}
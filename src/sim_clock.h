@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+
+// ---- Simulationsuhr (FIXED_TIMESTEP) ----
+// Sammelt die echte Frame-Zeit und gibt sie in festen SIM_DT-Schritten an
+// die Simulation weiter. Was übrig bleibt, ist der angebrochene Schritt:
+// gezeichnet wird bei simClockAlpha() zwischen vorletztem und letztem
+// Zustand. Bei mehr als SIM_MAX_STEPS fälligen Schritten (Hänger, Pause)
+// wird der Rest verworfen statt nachgeholt.
+
+// Frame-Zeit hinzufügen, liefert die Zahl der jetzt fälligen Schritte
+uint8_t simClockAdvance(float dtSec);
+
+// Anteil des angebrochenen Schritts, 0..1
+float simClockAlpha();
+
+// Zwischenwert für die Interpolation
+inline float simLerp(float from, float to, float alpha) {
+  return from + (to - from) * alpha;
+}
+
+// Dasselbe für Phasen, die bei period umbrechen (to < from = übergelaufen)
+inline float simLerpWrapped(float from, float to, float alpha, float period) {
+  if (to < from) to += period;
+  float v = from + (to - from) * alpha;
+  return v >= period ? v - period : v;
+}
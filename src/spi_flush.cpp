@@ -0,0 +1,233 @@
+#include "spi_flush.h"
+#include "gfx.h"
+#include "sprite_common.h"
+
+#ifdef NATIVE_BUILD
+#include <stdio.h>
+#include "host_sim.h"
+#elif defined(SPI_FLUSH_ASYNC)
+#include <SPI.h>
+#include <EventResponder.h>
+#endif
+
+static uint16_t stage[SPI_FLUSH_STAGES][SPI_FLUSH_STAGE_PIXELS];
+static uint8_t nextStage = 0;
+static SpiFlushStats stats = {0, 0, 0, 0};
+
+bool gSpiFlushOpen = false;
+
+// Reine Transferzeit in Mikrosekunden bei SPI_CLOCK_HZ
+static uint32_t busTimeUs(uint16_t pixels) {
+  return (uint32_t)((uint64_t)pixels * 16u * 1000000u / SPI_CLOCK_HZ);
+}
+
+#if defined(NATIVE_BUILD)
+// ---- Host: simulierter Async-Transport ----
+// Transfers laufen in virtueller Zeit hintereinander über den "Bus" und
+// landen erst bei Fertigstellung im Framebuffer. Eine Prüfsumme pro Puffer
+// erkennt CPU-Zugriffe, während der Transport ihn besitzt.
+
+struct HostSlot {
+  bool busy;      // gehört dem Transport
+  bool cpuOwned;  // per Acquire an die CPU ausgegeben
+  uint16_t pixels;
+  uint64_t doneAt;
+  uint32_t checksum;
+};
+
+static HostSlot slots[SPI_FLUSH_STAGES];
+static uint64_t busFreeAt = 0;
+
+static uint32_t stageChecksum(const uint16_t* buf, uint16_t pixels) {
+  uint32_t h = 2166136261u;  // FNV-1a
+  for (uint16_t i = 0; i < pixels; ++i) {
+    h = (h ^ buf[i]) * 16777619u;
+  }
+  return h;
+}
+
+static void ownershipViolation(const char* what, uint8_t slot) {
+  fprintf(stderr, "[FLUSH] ownership violation: %s (stage %u)\n", what, slot);
+  abort();
+}
+
+// Ältesten laufenden Transfer abschließen, falls er bis 'until' fertig ist
+static bool retireOldest(uint64_t until) {
+  int8_t oldest = -1;
+  for (uint8_t i = 0; i < SPI_FLUSH_STAGES; ++i) {
+    if (slots[i].busy && (oldest < 0 || slots[i].doneAt < slots[oldest].doneAt)) {
+      oldest = i;
+    }
+  }
+  if (oldest < 0 || slots[oldest].doneAt > until) return false;
+
+  HostSlot& s = slots[oldest];
+  if (stageChecksum(stage[oldest], s.pixels) != s.checksum) {
+    ownershipViolation("staging buffer modified while in flight", oldest);
+  }
+  tft.writePixels(stage[oldest], s.pixels, true, PIXELS_BIG_ENDIAN);
+  s.busy = false;
+  return true;
+}
+
+static void stallUntil(uint64_t t) {
+  uint64_t now = hostNowMicros();
+  if (t <= now) return;
+  stats.stalls++;
+  stats.stallUs += (uint32_t)(t - now);
+  hostAdvanceMicros(t - now);
+}
+
+static void transportInit() {
+  for (uint8_t i = 0; i < SPI_FLUSH_STAGES; ++i) {
+    slots[i] = {false, false, 0, 0, 0};
+  }
+}
+
+static void transportStart(uint8_t slot, uint16_t pixels) {
+  HostSlot& s = slots[slot];
+  if (!s.cpuOwned) ownershipViolation("submit without acquire", slot);
+  s.cpuOwned = false;
+  retireOldest(hostNowMicros());
+
+  uint64_t now = hostNowMicros();
+  uint64_t start = (busFreeAt > now) ? busFreeAt : now;
+  s.busy = true;
+  s.pixels = pixels;
+  s.doneAt = start + busTimeUs(pixels);
+  s.checksum = stageChecksum(stage[slot], pixels);
+  busFreeAt = s.doneAt;
+}
+
+static void transportWaitSlot(uint8_t slot) {
+  while (slots[slot].busy) {
+    stallUntil(slots[slot].doneAt);
+    retireOldest(hostNowMicros());
+  }
+  if (slots[slot].cpuOwned) ownershipViolation("acquire of a buffer still held by the CPU", slot);
+  slots[slot].cpuOwned = true;
+}
+
+static void transportWaitAll() {
+  while (retireOldest(hostNowMicros()) || busFreeAt > hostNowMicros()) {
+    stallUntil(busFreeAt);
+  }
+}
+
+#elif defined(SPI_FLUSH_ASYNC)
+// ---- Teensy 4.1: LPSPI-DMA über SPI.transfer(..., EventResponder) ----
+// Nach setAddrWindow() steht DC bereits auf Daten, der DMA schiebt nur noch
+// Bytes. Adafruit sendet MSB zuerst, daher wird der Puffer vorher getauscht
+// (mit WIRE_ORDER_PIXELS liegt er schon so im Speicher).
+// Es läuft immer höchstens ein Transfer, der zweite Puffer wird solange befüllt.
+
+static EventResponder dmaEvent;
+static volatile bool dmaBusy = false;
+static int8_t dmaSlot = -1;
+
+static void dmaDone(EventResponderRef) {
+  dmaBusy = false;
+}
+
+static void dmaWait() {
+  if (!dmaBusy) return;
+  uint32_t t0 = micros();
+  while (dmaBusy) {
+  }
+  stats.stalls++;
+  stats.stallUs += micros() - t0;
+}
+
+static void transportInit() {
+  dmaEvent.attachImmediate(&dmaDone);
+}
+
+static void transportStart(uint8_t slot, uint16_t pixels) {
+  uint16_t* buf = stage[slot];
+#ifndef WIRE_ORDER_PIXELS
+  for (uint16_t i = 0; i < pixels; ++i) {
+    buf[i] = (buf[i] << 8) | (buf[i] >> 8);
+  }
+#endif
+  dmaWait();
+  dmaBusy = true;
+  dmaSlot = slot;
+  SPI.transfer(buf, nullptr, pixels * 2, dmaEvent);
+}
+
+static void transportWaitSlot(uint8_t slot) {
+  if (dmaSlot == slot) dmaWait();
+}
+
+static void transportWaitAll() {
+  dmaWait();
+}
+
+#else
+// ---- Synchron: ein Puffer, writePixels() blockiert bis alles gesendet ist ----
+
+static void transportInit() {}
+
+static void transportStart(uint8_t slot, uint16_t pixels) {
+  tft.writePixels(stage[slot], pixels, true, PIXELS_BIG_ENDIAN);
+}
+
+static void transportWaitSlot(uint8_t) {}
+static void transportWaitAll() {}
+
+#endif
+
+void spiFlushInit() {
+  nextStage = 0;
+  gSpiFlushOpen = false;
+  transportInit();
+}
+
+void spiFlushWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!gSpiFlushOpen) {
+    tft.startWrite();
+    gSpiFlushOpen = true;
+  } else {
+    transportWaitAll();
+  }
+  tft.setAddrWindow(x, y, w, h);
+}
+
+uint16_t* spiFlushAcquire() {
+  uint8_t slot = nextStage;
+  nextStage = (nextStage + 1) % SPI_FLUSH_STAGES;
+  transportWaitSlot(slot);
+  return stage[slot];
+}
+
+void spiFlushSubmit(uint16_t* buf, uint16_t pixels) {
+  uint8_t slot = (buf - stage[0]) / SPI_FLUSH_STAGE_PIXELS;
+  stats.transfers++;
+  stats.busUs += busTimeUs(pixels);
+  transportStart(slot, pixels);
+}
+
+void spiFlushRect(SpiRowSource src, int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) return;
+
+  spiFlushWindow(x, y, w, h);
+  int16_t rowsPerStage = SPI_FLUSH_STAGE_PIXELS / w;
+  for (int16_t row = 0; row < h; row += rowsPerStage) {
+    int16_t rows = min(rowsPerStage, (int16_t)(h - row));
+    uint16_t* buf = spiFlushAcquire();
+    for (int16_t r = 0; r < rows; ++r) {
+      src(x, y + row + r, w, buf + r * w);
+    }
+    spiFlushSubmit(buf, w * rows);
+  }
+}
+
+void spiFlushFinish() {
+  transportWaitAll();
+  gSpiFlushOpen = false;
+  tft.endWrite();
+}
+
+SpiFlushStats spiFlushStats() {
+  return stats;
+}
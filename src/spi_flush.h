@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"
+
+// ---- Asynchroner SPI-Flush mit Ping-Pong-Staging ----
+// Pixel werden in Staging-Puffer kopiert/komponiert und an einen Transport
+// übergeben. Mit DMA läuft der Transfer weiter, während die CPU schon den
+// nächsten Strip (oder die COLLECT-Phase des nächsten Frames) rechnet.
+//
+// Besitzregeln:
+//  - spiFlushAcquire() liefert einen Puffer, der ab dann der CPU gehört
+//    (wartet, falls der Transport ihn noch sendet)
+//  - spiFlushSubmit() gibt ihn an den Transport ab; bis zum nächsten
+//    Acquire darf die CPU ihn weder lesen noch schreiben
+//  - spiFlushWindow() wartet, bis alle Transfers fertig sind (ein Window-
+//    Wechsel mitten im RAMWR-Stream ist ungültig)
+//  - spiFlushFence() schließt alles ab und beendet die SPI-Transaktion.
+//    DisplayDriver::startWrite() ruft sie vor jedem anderen Display-Zugriff
+//    auf, Menüs und Status-Bar müssen sich also um nichts kümmern.
+//    Am Frame-Ende ruft sie renderFrame() (synchron) bzw. loop() vor dem
+//    Pacing-Warten (asynchron), damit der Bus im Leerlauf frei ist; ohne
+//    Wartezeit überlappt der letzte Strip die COLLECT-Phase des nächsten Frames.
+//
+// Transporte: Host = simulierter Async-Transport in virtueller Zeit mit
+// Ownership-Prüfung, Teensy 4.1 mit SPI_FLUSH_DMA = LPSPI-DMA,
+// sonst synchron über tft.writePixels() (ein Puffer genügt).
+// Pixel stehen im Speicherformat (px565, sprite_common.h); mit
+// WIRE_ORDER_PIXELS gehen die Puffer ungetauscht auf den Bus.
+
+constexpr uint16_t SPI_FLUSH_STAGE_PIXELS = COMPOSE_STRIP_ROWS * TFT_WIDTH;
+
+#if defined(NATIVE_BUILD) || (defined(__IMXRT1062__) && defined(SPI_FLUSH_DMA))
+#define SPI_FLUSH_ASYNC
+constexpr uint8_t SPI_FLUSH_STAGES = 2;
+#else
+constexpr uint8_t SPI_FLUSH_STAGES = 1;
+#endif
+
+struct SpiFlushStats {
+  uint32_t transfers;   // abgeschickte Staging-Puffer
+  uint32_t stalls;      // Acquire/Window/Fence musste auf den Transport warten
+  uint32_t stallUs;     // davon blockierte CPU-Zeit
+  uint32_t busUs;       // reine Transferzeit
+};
+
+// Einmal nach tft.init()
+void spiFlushInit();
+
+// Address-Window für die folgenden Submits setzen (öffnet ggf. die Transaktion)
+void spiFlushWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Staging-Puffer (SPI_FLUSH_STAGE_PIXELS) holen bzw. abschicken
+uint16_t* spiFlushAcquire();
+void spiFlushSubmit(uint16_t* buf, uint16_t pixels);
+
+// Liefert w Pixel der Zeile y ab x (Canvas-memcpy oder Kachel-Dekoder)
+typedef void (*SpiRowSource)(int16_t x, int16_t y, int16_t w, uint16_t* dst);
+
+// Rechteck zeilenweise aus src in die Staging-Puffer holen und senden
+void spiFlushRect(SpiRowSource src, int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Alle Transfers abschließen und Transaktion beenden
+extern bool gSpiFlushOpen;
+void spiFlushFinish();
+inline void spiFlushFence() {
+  if (gSpiFlushOpen) spiFlushFinish();
+}
+
+SpiFlushStats spiFlushStats();
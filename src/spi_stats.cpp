@@ -0,0 +1,170 @@
+#include "spi_stats.h"
+
+#ifdef DEBUG_SPI_STATS
+
+#include "gfx.h"
+
+static constexpr uint8_t NUM_PHASES = 3;
+
+static const char* const phaseNames[NUM_PHASES] = {"COLLECT", "RESTORE", "DRAW"};
+static const char* const callerNames[SPI_CALLER_COUNT] = {
+  "other", "restoreRegion", "dirtyRects", "spriteOpt", "spriteBasic", "particles", "ui"
+};
+
+static SpiCaller currentCaller = SPI_CALLER_OTHER;
+
+static SpiCounters frameCounters[NUM_PHASES][SPI_CALLER_COUNT];
+static SpiCounters reportCounters[NUM_PHASES][SPI_CALLER_COUNT];
+static SpiCounters totalCounters[NUM_PHASES][SPI_CALLER_COUNT];
+static SpiCounters lastFrame;
+static uint32_t reportMaxFrameBytes = 0;
+static uint16_t reportFrames = 0;
+static uint32_t totalFrames = 0;
+static bool autoReport = true;
+
+static SpiCounters& slot() {
+  return frameCounters[getFramePhase()][currentCaller];
+}
+
+static void addCounters(SpiCounters& dst, const SpiCounters& src) {
+  dst.pixels += src.pixels;
+  dst.windows += src.windows;
+  dst.bytes += src.bytes;
+  dst.transactions += src.transactions;
+}
+
+static SpiCounters sumCounters(SpiCounters (&table)[NUM_PHASES][SPI_CALLER_COUNT]) {
+  SpiCounters sum = {0, 0, 0, 0};
+  for (uint8_t p = 0; p < NUM_PHASES; ++p) {
+    for (uint8_t c = 0; c < SPI_CALLER_COUNT; ++c) {
+      addCounters(sum, table[p][c]);
+    }
+  }
+  return sum;
+}
+
+// Busbelegung in Mikrosekunden bei SPI_CLOCK_HZ
+static uint32_t busTimeUs(uint32_t bytes) {
+  return (uint32_t)((uint64_t)bytes * 8u * 1000000u / SPI_CLOCK_HZ);
+}
+
+void SpiAccountingST7789::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  SpiCounters& c = slot();
+  uint32_t px = (uint32_t)w * h;
+  c.windows++;
+  c.pixels += px;
+  c.bytes += SPI_WINDOW_CMD_BYTES + px * 2;
+  Adafruit_ST7789::setAddrWindow(x, y, w, h);
+}
+
+void SpiAccountingST7789::startWrite() {
+  slot().transactions++;
+  Adafruit_ST7789::startWrite();
+}
+
+SpiCallerScope::SpiCallerScope(SpiCaller caller) : prevCaller(currentCaller) {
+  currentCaller = caller;
+}
+
+SpiCallerScope::~SpiCallerScope() {
+  currentCaller = prevCaller;
+}
+
+static void printCounters(const char* label, const SpiCounters& c, uint32_t frames) {
+  Serial.print(label);
+  Serial.print(c.pixels / frames);
+  Serial.print(" px, ");
+  Serial.print(c.windows / frames);
+  Serial.print(" win, ");
+  Serial.print(c.bytes / frames);
+  Serial.print(" B, ");
+  // Transaktionen mit einer Nachkommastelle: ruhige Frames öffnen keine
+  uint32_t txTenths = c.transactions * 10 / frames;
+  Serial.print(txTenths / 10);
+  Serial.print(".");
+  Serial.print(txTenths % 10);
+  Serial.print(" tx, ");
+  Serial.print(busTimeUs(c.bytes / frames));
+  Serial.println(" us");
+}
+
+static void printTable(SpiCounters (&table)[NUM_PHASES][SPI_CALLER_COUNT], uint32_t frames) {
+  if (frames == 0) return;
+  for (uint8_t p = 0; p < NUM_PHASES; ++p) {
+    for (uint8_t c = 0; c < SPI_CALLER_COUNT; ++c) {
+      const SpiCounters& cnt = table[p][c];
+      if (cnt.windows == 0 && cnt.transactions == 0) continue;
+      Serial.print("[SPI]   ");
+      Serial.print(phaseNames[p]);
+      Serial.print("/");
+      Serial.print(callerNames[c]);
+      printCounters(": ", cnt, frames);
+    }
+  }
+}
+
+void spiStatsEndFrame() {
+  lastFrame = sumCounters(frameCounters);
+  if (lastFrame.bytes > reportMaxFrameBytes) {
+    reportMaxFrameBytes = lastFrame.bytes;
+  }
+
+  for (uint8_t p = 0; p < NUM_PHASES; ++p) {
+    for (uint8_t c = 0; c < SPI_CALLER_COUNT; ++c) {
+      addCounters(reportCounters[p][c], frameCounters[p][c]);
+      addCounters(totalCounters[p][c], frameCounters[p][c]);
+      frameCounters[p][c] = {0, 0, 0, 0};
+    }
+  }
+  totalFrames++;
+
+  if (++reportFrames < SPI_STATS_REPORT_FRAMES) return;
+
+  if (autoReport) {
+    SpiCounters sum = sumCounters(reportCounters);
+    Serial.print("[SPI] ");
+    Serial.print(reportFrames);
+    printCounters(" frames, avg/frame: ", sum, reportFrames);
+    Serial.print("[SPI]   max frame: ");
+    Serial.print(reportMaxFrameBytes);
+    Serial.print(" B (");
+    Serial.print(busTimeUs(reportMaxFrameBytes));
+    Serial.println(" us)");
+    printTable(reportCounters, reportFrames);
+  }
+
+  for (uint8_t p = 0; p < NUM_PHASES; ++p) {
+    for (uint8_t c = 0; c < SPI_CALLER_COUNT; ++c) {
+      reportCounters[p][c] = {0, 0, 0, 0};
+    }
+  }
+  reportFrames = 0;
+  reportMaxFrameBytes = 0;
+}
+
+void spiStatsSetAutoReport(bool enabled) {
+  autoReport = enabled;
+}
+
+SpiCounters spiStatsTotal() {
+  return sumCounters(totalCounters);
+}
+
+SpiCounters spiStatsLastFrame() {
+  return lastFrame;
+}
+
+void spiStatsPrintSummary() {
+  if (totalFrames == 0) return;
+  SpiCounters sum = sumCounters(totalCounters);
+  Serial.print("[SPI] total ");
+  Serial.print(totalFrames);
+  Serial.print(" frames, ");
+  Serial.print(sum.bytes);
+  Serial.println(" B");
+  Serial.print("[SPI] ");
+  printCounters("avg/frame: ", sum, totalFrames);
+  printTable(totalCounters, totalFrames);
+}
+
+#endif // DEBUG_SPI_STATS
@@ -0,0 +1,82 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_ST7789.h>
+#include "config.h"
+
+// ---- SPI-Accounting für den Dirty-Rect-Renderer ----
+// Zählt pro Frame Pixel, Address-Windows (CASET/RASET/RAMWR), Bytes und
+// startWrite()-Transaktionen, aufgeschlüsselt nach Frame-Phase und Aufrufer.
+// Aktiv nur mit -DDEBUG_SPI_STATS, sonst kompilieren alle Hooks zu nichts.
+
+// Wer gerade auf den Bus schreibt
+enum SpiCaller : uint8_t {
+  SPI_CALLER_OTHER = 0,
+  SPI_CALLER_RESTORE_REGION,   // restoreRegion()
+  SPI_CALLER_DIRTY_RECTS,      // processDirtyRects() / blitPlayAreaFromCanvas()
+  SPI_CALLER_SPRITE_OPTIMIZED, // drawSpriteOptimized()
+  SPI_CALLER_SPRITE_BASIC,     // drawSpriteBasic()
+  SPI_CALLER_PARTICLES,        // drawParticles()
+  SPI_CALLER_UI,               // Status-Bar, Menüs, Overlays
+  SPI_CALLER_COUNT
+};
+
+struct SpiCounters {
+  uint32_t pixels;
+  uint32_t windows;
+  uint32_t bytes;
+  uint32_t transactions;
+};
+
+// Bytes pro Address-Window: CASET (1+4) + RASET (1+4) + RAMWR (1)
+constexpr uint8_t SPI_WINDOW_CMD_BYTES = 11;
+
+// Frames pro Serial-Report
+constexpr uint16_t SPI_STATS_REPORT_FRAMES = 120;
+
+#ifdef DEBUG_SPI_STATS
+
+// Display-Treiber mit Zählern: setAddrWindow() und startWrite() sind in
+// Adafruit_SPITFT virtuell, damit sieht der Zähler auch alle Aufrufe aus
+// der Library (fillRect, drawPixel, Text). Jedes Window wird im Code
+// vollständig gefüllt, daher gilt Pixel = Window-Fläche.
+class SpiAccountingST7789 : public Adafruit_ST7789 {
+public:
+  SpiAccountingST7789(int8_t cs, int8_t dc, int8_t rst) : Adafruit_ST7789(cs, dc, rst) {}
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+  void startWrite() override;
+};
+
+// Setzt den Aufrufer für die Lebensdauer des Scopes
+class SpiCallerScope {
+public:
+  explicit SpiCallerScope(SpiCaller caller);
+  ~SpiCallerScope();
+private:
+  SpiCaller prevCaller;
+};
+
+// Frame abschließen (einmal pro loop())
+void spiStatsEndFrame();
+
+// Periodische Serial-Reports an/aus (Host schaltet sie ab)
+void spiStatsSetAutoReport(bool enabled);
+
+// Summen seit Start (alle Phasen/Aufrufer) bzw. des letzten Frames
+SpiCounters spiStatsTotal();
+SpiCounters spiStatsLastFrame();
+
+// Zusammenfassung seit Start über Serial ausgeben
+void spiStatsPrintSummary();
+
+#else
+
+struct SpiCallerScope {
+  explicit SpiCallerScope(SpiCaller) {}
+};
+
+inline void spiStatsEndFrame() {}
+inline void spiStatsSetAutoReport(bool) {}
+inline void spiStatsPrintSummary() {}
+
+#endif
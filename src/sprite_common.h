@@ -1,11 +1,76 @@
 #pragma once
 #include <Arduino.h>
+#include "config.h"
+
+// ---- Pixelformat im Speicher ----
+// Sprite-Daten, Canvas und Puffer halten Pixel im "Speicherformat": mit
+// WIRE_ORDER_PIXELS byte-getauscht (so, wie der ST7789 sie vom Bus liest),
+// sonst logisches RGB565. px565() wandelt in beide Richtungen; die Konverter
+// schreiben jede Farbe als px565(0x....), der Tausch kostet also zur
+// Laufzeit nichts. Gerechnet (Blenden, Verläufe) wird immer logisch.
+#ifdef WIRE_ORDER_PIXELS
+constexpr bool PIXELS_BIG_ENDIAN = true;
+constexpr uint16_t px565(uint16_t c) { return (uint16_t)((c << 8) | (c >> 8)); }
+#else
+constexpr bool PIXELS_BIG_ENDIAN = false;
+constexpr uint16_t px565(uint16_t c) { return c; }
+#endif
 
 // Globale Transparenzfarbe (Pink aus deinem Sprite-Generator)
 constexpr uint16_t TRANSPARENT_COLOR = 0xF81F; // magenta
-constexpr uint16_t TRANSPARENT_COLOR_SWAP = 0x1FF8; // byte-swapped magenta
+constexpr uint16_t TRANSPARENT_KEY = px565(TRANSPARENT_COLOR); // so steht sie in den Sprite-Daten
+
+// Die Byte-Reihenfolge ist festgelegt, ein Vergleich genügt
+inline bool isTransparent16(uint16_t c) {
+  return c == TRANSPARENT_KEY;
+}
+
+// ---- Palette-indizierte Sprites (erzeugt mit convert_sprite.py --indexed) ----
+// 4 Bit (bis 15 Farben) oder 8 Bit (bis 255 Farben) pro Pixel statt RGB565,
+// die Blitter expandieren beim Zeichnen über die Palette.
+struct IndexedSprite {
+  uint16_t w, h;
+  uint8_t bits;             // 4: zwei Pixel pro Byte, High-Nibble zuerst; 8: ein Pixel pro Byte
+  const uint8_t* indices;   // w*h Indizes, zeilenweise
+  const uint16_t* palette;  // RGB565 im Speicherformat, Index 0 = transparent
+  uint8_t ox, oy;           // --trim: Lage des zugeschnittenen Bilds im Originalsprite
+};
+
+// Palettenindex des Pixels i (zeilenweise gezählt)
+inline uint8_t indexedIndex(const IndexedSprite& s, uint16_t i) {
+  if (s.bits == 8) return pgm_read_byte(&s.indices[i]);
+  uint8_t b = pgm_read_byte(&s.indices[i >> 1]);
+  return (i & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+inline uint16_t indexedColor(const IndexedSprite& s, uint8_t index) {
+  return pgm_read_word(&s.palette[index]);
+}
+
+// ---- Span-Tabellen (erzeugt mit convert_sprite.py --spans) ----
+// Pro Zeile die deckenden Läufe eines Sprites; offset zeigt in die
+// Pixeldaten (RGB565 oder Indizes), der Blitter kopiert also ohne
+// Transparenz-Tests.
+struct SpriteSpan {
+  uint8_t x;        // Startspalte im Sprite
+  uint8_t len;      // Länge des Laufs
+  uint16_t offset;  // Index des ersten Pixels im Bitmap
+};
+
+struct SpriteSpanTable {
+  const uint16_t* bitmap;
+  uint16_t w, h;
+  const uint16_t* rows;         // h+1 Einträge: erste Span je Zeile
+  const SpriteSpan* spans;
+  const SpriteSpan* spansFlip;  // gespiegelt: x = w - x - len, Pixel rückwärts lesen
+  const IndexedSprite* indexed; // gesetzt = Pixel über Palette, bitmap ist dann nullptr
+  uint8_t ox, oy;               // --trim: w x h ist nur der deckende Ausschnitt,
+  uint16_t fullW;               // (ox, oy) seine Lage im fullW breiten Originalframe
+};
 
-// Robust transparency check (handles both byte orders)
-inline bool isTransparent16(uint16_t c) { 
-  return c == TRANSPARENT_COLOR || c == TRANSPARENT_COLOR_SWAP; 
+// Linke obere Ecke des Ausschnitts für ein Sprite, dessen Originalframe bei
+// x liegt. Gespiegelt liegt der Ausschnitt spiegelbildlich im Originalframe,
+// so behalten alle Frames einer Animation denselben Anker.
+inline int16_t spanOriginX(const SpriteSpanTable& t, int16_t x, bool flipX) {
+  return x + (flipX ? t.fullW - t.ox - t.w : t.ox);
 }
@@ -1,59 +1,60 @@
 #pragma once
 #include <Arduino.h>
+#include "../sprite_common.h"
 
 // Green Anemone - 50x50
 const uint16_t ANEMONE_GREEN_WIDTH = 50;
 const uint16_t ANEMONE_GREEN_HEIGHT = 50;
 
 const uint16_t anemone_greenBitmap[] PROGMEM = {
-  0x05EA, 0x0DE4, 0x04E0, 0x04E0, 0x04DA, 0x04BC, 0x0553, 0x0E18, 0x0501, 0x0CC2, 0x05FF, 0x0D9D, 0x05FE, 0x04ED, 0x0420, 0x0400, 0x0420, 0x0420, 0x0498, 0x0499, 0x04A2, 0x0300, 0x0260, 0x0360, 0x059D, 0x04BB, 0x0572, 0x0440, 0x03C0, 0x01E1, 0x0201, 0x06AC, 0x060B, 0x0540, 0x02E0, 0x0360, 0x0580, 0x0480, 0x0D36, 0x0418, 0x03D5, 0x03AA, 0x0320, 0x0B81, 0x0360, 0x0402, 0x1511, 0x05AB, 0x0567, 0x0562,
-  0x05A1, 0x0500, 0x0500, 0x04C1, 0x061E, 0x05DE, 0x0501, 0x068A, 0x05A2, 0x0549, 0x053D, 0x05FE, 0x161F, 0x053D, 0x0381, 0x0400, 0x0420, 0x0360, 0x0361, 0x0360, 0x03C2, 0x0340, 0x0280, 0x0220, 0x0499, 0x0477, 0x1461, 0x5E5D, 0x15FF, 0x0D3D, 0x09A0, 0x26CE, 0x0E6A, 0x0580, 0x0CE1, 0x0300, 0x0560, 0x04C0, 0x0495, 0x03F5, 0x044C, 0x0467, 0x02C1, 0x02C0, 0x0BE1, 0x0380, 0x0320, 0x0320, 0x05A7, 0x0561,
-  0x04A0, 0x0540, 0x0541, 0x0577, 0x05DF, 0x053D, 0x35FE, 0x45DF, 0x05B4, 0x0581, 0x04F8, 0x05BF, 0x057E, 0x053A, 0x1675, 0x0CA4, 0x0480, 0x04A0, 0x03E0, 0x04B1, 0x8F3F, 0x04FA, 0x7F9F, 0x1DFE, 0x04F1, 0x04A8, 0x0C62, 0x051A, 0x0459, 0x0459, 0x0C52, 0x0120, 0x0623, 0x0581, 0x02C0, 0x0260, 0x0560, 0x04E0, 0x03E0, 0x04ED, 0x0420, 0x0480, 0x0CE8, 0x13E8, 0x0301, 0x0460, 0x5EF8, 0x96FF, 0x0D50, 0x05A1,
-  0x056A, 0x056A, 0x0563, 0x04C4, 0x04FA, 0x0DB3, 0x25DD, 0x1DBD, 0x053C, 0x0564, 0x0521, 0x0565, 0x15FB, 0x6E5F, 0x0D7F, 0x0D8E, 0x467F, 0x053C, 0x0559, 0x05F2, 0x05EF, 0x0595, 0x055E, 0x049A, 0x050F, 0x0380, 0x0300, 0x02C3, 0x04D7, 0x0478, 0x03C4, 0x0241, 0x05E0, 0x0443, 0x04DC, 0x1DF6, 0x2EBF, 0x0449, 0x0380, 0x0280, 0x0D00, 0x0460, 0x04E0, 0x0565, 0x0C65, 0x1542, 0x053D, 0x04FB, 0x04FC, 0x0400,
-  0x053C, 0x0552, 0x04A0, 0x0CE4, 0x0484, 0x0E89, 0x1633, 0x05BA, 0x0653, 0x05A1, 0x04A0, 0x0400, 0x0553, 0x05BD, 0x051C, 0x467F, 0x0D7F, 0x049B, 0x04F7, 0x05D5, 0x0542, 0x0520, 0x04FA, 0x04F6, 0x0589, 0x04C2, 0x02C1, 0x02A0, 0x0CC8, 0x0DDD, 0x361F, 0x0D7D, 0x0340, 0x0496, 0x04BB, 0x055E, 0x04FC, 0x0479, 0x0BF1, 0x0A41, 0x0220, 0x0440, 0x0480, 0x04E0, 0x0500, 0x04A0, 0x051A, 0x053A, 0x056E, 0x03A0,
-  0x053C, 0x0E12, 0x05C3, 0x1625, 0x0420, 0x03A2, 0x05C2, 0x0480, 0x0380, 0x0DA0, 0x0540, 0x04E0, 0x04E0, 0x0509, 0x0625, 0x4E7F, 0x059E, 0x047B, 0x059D, 0x055E, 0x04D6, 0x0544, 0x0341, 0x162C, 0x0546, 0x0544, 0x04E4, 0x0285, 0x140F, 0x051C, 0x04BB, 0x0439, 0x0220, 0x1D15, 0x0C99, 0x049A, 0x045A, 0x04BB, 0x03E6, 0x057E, 0x0417, 0x0C57, 0x02C0, 0x03E0, 0x0440, 0x0440, 0x0E05, 0x05A4, 0x05A1, 0x0320,
-  0x059B, 0x05EC, 0x0628, 0x05C0, 0x0DF6, 0x1DDE, 0x055C, 0x0DCC, 0x0381, 0x02A0, 0x0260, 0x0D41, 0x0520, 0x04A0, 0x0480, 0x03C2, 0x0DBA, 0x0DE8, 0x1E1F, 0x057E, 0x04D5, 0x0544, 0x0CA0, 0x0280, 0x0505, 0x0420, 0x03A1, 0x053D, 0x0418, 0x0435, 0x0458, 0x03F9, 0x0261, 0x01E0, 0x03AB, 0x0D71, 0x0595, 0x054D, 0x0340, 0x051D, 0x0437, 0x0434, 0x0422, 0x0D6D, 0x2635, 0x0360, 0x05C3, 0x05C1, 0x05A0, 0x1461,
-  0x0647, 0x0E5E, 0x053C, 0x0DEA, 0x0619, 0x05BE, 0x04D8, 0x0528, 0x0520, 0x04E1, 0x0CE1, 0x03C0, 0x0440, 0x05BE, 0x059E, 0x0448, 0x0380, 0x0380, 0x0440, 0x0300, 0x04ED, 0x054B, 0x04A2, 0x03C0, 0x0D01, 0x03E0, 0x03C2, 0x03F5, 0x042F, 0x0446, 0x0572, 0x04E8, 0x1DAB, 0x0220, 0x0365, 0x1E1D, 0x0D9E, 0x0599, 0x03E0, 0x0D3A, 0x0458, 0x0C31, 0x15DC, 0x25DE, 0x14D9, 0x05ED, 0x02C0, 0x0560, 0x05A0, 0x0560,
-  0x059D, 0x04DB, 0x0590, 0x04CC, 0x04C3, 0x0CDA, 0x05CF, 0x0D41, 0x0440, 0x04A1, 0x4E7E, 0x051A, 0x0404, 0x057E, 0x051D, 0x0518, 0x0CC1, 0x1562, 0x0500, 0x0DE4, 0x059D, 0x05DF, 0x055E, 0x1C97, 0x0300, 0x1DC3, 0x03C0, 0x1DE9, 0x0440, 0x0420, 0x062C, 0x0567, 0x04A1, 0x0240, 0x038D, 0x055D, 0x2DDF, 0x051D, 0x0504, 0x0421, 0x04A5, 0x0522, 0x057D, 0x055F, 0x053C, 0x0601, 0x05A0, 0x0560, 0x0606, 0x1CA1,
-  0x04B3, 0x04B8, 0x04E0, 0x0480, 0x04A1, 0x042A, 0x057F, 0x0539, 0x05E6, 0x0487, 0x2E1F, 0x04DC, 0x0482, 0x66FF, 0x0559, 0x0E96, 0x0560, 0x0381, 0x0320, 0x0340, 0x055C, 0x15DE, 0x05BE, 0x0499, 0x02A0, 0x0300, 0x04E0, 0x0420, 0x0E03, 0x04A0, 0x0360, 0x05E6, 0x0522, 0x0DA4, 0x02C9, 0x04BA, 0x04DB, 0x04BA, 0x0E0F, 0x04A0, 0x04E0, 0x15A1, 0x055B, 0x25FF, 0x055C, 0x0540, 0x0560, 0x0623, 0x2522, 0x14E0,
-  0x04F5, 0x04D2, 0x0D20, 0x0520, 0x04E0, 0x055E, 0x04BC, 0x0C79, 0x05A1, 0x0400, 0x051D, 0x0D93, 0x1553, 0x057E, 0x0478, 0x04C7, 0x03C0, 0x0B60, 0x1D74, 0x051B, 0x04DB, 0x04FB, 0x055C, 0x0518, 0x36B7, 0x0280, 0x02A0, 0x04A0, 0x0381, 0x15C2, 0x0380, 0x0602, 0x0D81, 0x04A0, 0x0C41, 0x15BA, 0x0498, 0x05B9, 0x0D87, 0x0440, 0x0500, 0x0420, 0x0481, 0x0509, 0x02C0, 0x0520, 0x0540, 0x0580, 0x05C3, 0x4480,
-  0x059E, 0x05DF, 0x059D, 0x0461, 0x164E, 0x055C, 0x051D, 0x04DA, 0x0401, 0x02E0, 0x1D72, 0x02E2, 0x0221, 0x04BB, 0x0B74, 0x0469, 0x055D, 0x14BB, 0x059E, 0x04D9, 0x0484, 0x0302, 0x0584, 0x059E, 0x7E9F, 0x0DBE, 0x0C04, 0x15A6, 0x0460, 0x0360, 0x0C01, 0x0320, 0x0540, 0x0440, 0x03C0, 0x02C0, 0x04E0, 0x0522, 0x0460, 0x0520, 0x05E1, 0x0420, 0x03E0, 0x03E0, 0x03E0, 0x46A7, 0x05E1, 0x05A0, 0x0560, 0x0560,
-  0x057E, 0x1DDF, 0x04FC, 0x04DA, 0x0BA0, 0x0401, 0x0DCC, 0x0421, 0x0360, 0x15FF, 0x057E, 0x04BB, 0x0460, 0x1DAE, 0x0450, 0x0D5C, 0x04DB, 0x0438, 0x04D8, 0x0514, 0x04C0, 0x0C21, 0x0483, 0x057D, 0x2DBF, 0x0D7E, 0x0496, 0x03C0, 0x0480, 0x0320, 0x0260, 0x02A0, 0x16A6, 0x04C0, 0x0440, 0x0380, 0x02E0, 0x03A0, 0x0320, 0x04E5, 0x04C0, 0x0460, 0x03E0, 0x03E0, 0x0BC0, 0x0B20, 0x6FCD, 0x0664, 0x05A0, 0x0540,
-  0x057E, 0x059E, 0x04DC, 0x04F6, 0x0634, 0x0D64, 0x0D82, 0x04E0, 0x03A1, 0x0D9E, 0x051D, 0x04F6, 0x04C0, 0x0420, 0x0524, 0x0428, 0x0418, 0x0416, 0x060E, 0x0DE4, 0x0440, 0x03C0, 0x0320, 0x04DC, 0x04BA, 0x0479, 0x0458, 0x03A1, 0x04C2, 0x02C0, 0x01E0, 0x01C0, 0x02A0, 0x05A0, 0x04A0, 0x0400, 0x03E0, 0x03E1, 0x0320, 0x0492, 0x04BA, 0x0600, 0x04C0, 0x0420, 0x0380, 0x0B61, 0x0585, 0x05A4, 0x0603, 0x04C0,
-  0x0DD9, 0x04FA, 0x04D9, 0x054E, 0x04C4, 0x03E0, 0x0400, 0x0400, 0x0380, 0x0D12, 0x057C, 0x264A, 0x0400, 0x0360, 0x0320, 0x02C0, 0x04C8, 0x03E0, 0x02A0, 0x0642, 0x0460, 0x03E0, 0x0320, 0x0280, 0x0690, 0x04D6, 0x04B2, 0x0520, 0x0D24, 0x0A80, 0x01E0, 0x01A0, 0x01A0, 0x04A0, 0x05A0, 0x04E0, 0x0460, 0x03E0, 0x0C01, 0x02C1, 0x0497, 0x3466, 0x0540, 0x04C0, 0x0C20, 0x03A0, 0x05C2, 0x0D20, 0x0580, 0x04E0,
-  0x05AA, 0x0460, 0x1504, 0x0569, 0x0480, 0x0400, 0x03C0, 0x03C0, 0x03A0, 0x059E, 0x049B, 0x0CB6, 0x0340, 0x0380, 0x0320, 0x02C0, 0x01E1, 0x2E14, 0x0363, 0x02A1, 0x0D63, 0x0420, 0x0360, 0x02E0, 0x0260, 0x05C5, 0x062A, 0x0D62, 0x05C7, 0x03E0, 0x01A0, 0x01E0, 0x01C0, 0x0200, 0x0DC1, 0x0561, 0x04C0, 0x0440, 0x03C0, 0x0400, 0x0400, 0x0360, 0x0440, 0x0540, 0x0480, 0x0480, 0x2E57, 0x6E3F, 0x25DE, 0x0644,
-  0x0460, 0x0320, 0x02E0, 0x02C0, 0x02A0, 0x0CC1, 0x03E0, 0x0381, 0x02C0, 0x05DD, 0x049B, 0x0CF1, 0x03A0, 0x0340, 0x0B81, 0x02E0, 0x057D, 0x3E1F, 0x051D, 0x0C42, 0x0380, 0x0300, 0x04E0, 0x03A0, 0x02E0, 0x05C1, 0x064E, 0x561E, 0x0D3E, 0x04BA, 0x06CD, 0x3694, 0x0F58, 0x06AB, 0x0669, 0x0601, 0x05A0, 0x0540, 0x0540, 0x0D01, 0x0380, 0x0360, 0x0100, 0x0E83, 0x04C0, 0x0460, 0x04DC, 0x04FD, 0x04BD, 0x04E7,
-  0x03C0, 0x0321, 0x0200, 0x0A40, 0x0220, 0x04DA, 0x1DF1, 0x0180, 0x0260, 0x02C1, 0x0E37, 0x0441, 0x0D12, 0x0320, 0x0320, 0x05A8, 0x04DB, 0x04DB, 0x04FC, 0x0240, 0x0468, 0x0483, 0x0360, 0x05A0, 0x0460, 0x1543, 0x051D, 0x0D5E, 0x04BC, 0x047C, 0x0671, 0x0647, 0x0560, 0x0540, 0x0520, 0x0520, 0x04E0, 0x04A0, 0x0400, 0x0460, 0x0500, 0x0CE1, 0x0A40, 0x0220, 0x0560, 0x0480, 0x0498, 0x0479, 0x0478, 0x0545,
-  0x0440, 0x0340, 0x0260, 0x01E0, 0x0CD0, 0x0459, 0x04CE, 0x0AC0, 0x0360, 0x0140, 0x0C4D, 0x049C, 0x045A, 0x04C8, 0x0400, 0x03C0, 0x0380, 0x062E, 0x0672, 0x05C1, 0x0D60, 0x05A4, 0x05C6, 0x05A5, 0x0582, 0x0521, 0x2DB6, 0x0CDB, 0x04BB, 0x0539, 0x064A, 0x0E24, 0x0581, 0x0602, 0x16A6, 0x0E43, 0x0DC2, 0x04C0, 0x0420, 0x03C0, 0x0460, 0x04A1, 0x0500, 0x03C0, 0x0421, 0x04E0, 0x0BC0, 0x062F, 0x05F0, 0x0541,
-  0x04C0, 0x0420, 0x0340, 0x02E0, 0x0220, 0x0363, 0x0CE9, 0x0420, 0x0422, 0x0401, 0x04BC, 0x045A, 0x0439, 0x14CA, 0x0380, 0x0380, 0x0300, 0x0D87, 0x05C4, 0x05C6, 0x04A0, 0x02A0, 0x03E0, 0x0480, 0x0566, 0x0E92, 0x0320, 0x0300, 0x0440, 0x05C0, 0x04E0, 0x05A1, 0x0360, 0x0320, 0x0300, 0x4C04, 0x0360, 0x0D80, 0x0B80, 0x0380, 0x03E0, 0x03E0, 0x03E0, 0x0400, 0x0480, 0x0503, 0x0420, 0x06A8, 0x0540, 0x0461,
-  0x0300, 0x0320, 0x04B5, 0x1D99, 0x0320, 0x0D1A, 0x053C, 0x057E, 0x04DA, 0x051C, 0x0CDB, 0x04FB, 0x04DA, 0x04A4, 0x0BE0, 0x0B40, 0x0B41, 0x02E0, 0x0DE0, 0x0561, 0x0460, 0x0421, 0x02E0, 0x0340, 0x0C80, 0x05D5, 0x04A7, 0x0340, 0x03A0, 0x1EAC, 0x0582, 0x05C2, 0x0669, 0x0321, 0x0AE0, 0x1A80, 0x02C0, 0x0B00, 0x0D80, 0x0480, 0x0B60, 0x0380, 0x0380, 0x03A0, 0x0420, 0x0460, 0x0440, 0x04E4, 0x0540, 0x0C83,
-  0x02E1, 0x0200, 0x055D, 0x055D, 0x0CD4, 0x0433, 0x059D, 0x057E, 0x0479, 0x057D, 0x051C, 0x051B, 0x0543, 0x13C7, 0x0C2B, 0x00C0, 0x0081, 0x0B01, 0x03A0, 0x0D20, 0x0BE0, 0x0360, 0x03C0, 0x0420, 0x0301, 0x0CB5, 0x0C52, 0x0421, 0x0400, 0x0420, 0x0F0F, 0x0581, 0x05E5, 0x0420, 0x1A80, 0x1A80, 0x53A3, 0x3B08, 0x0AA0, 0x0C80, 0x04A1, 0x0320, 0x0320, 0x0340, 0x0340, 0x03C0, 0x0400, 0x0461, 0x0500, 0x04E0,
-  0x01E2, 0x1421, 0x04FC, 0x055C, 0x0535, 0x0B63, 0x0D9C, 0x05DF, 0x04BA, 0x05BB, 0x0DFE, 0x04FA, 0x1DA7, 0x00E0, 0x0183, 0x0266, 0x09A1, 0x0140, 0x0160, 0x15E2, 0x0420, 0x0380, 0x0320, 0x0300, 0x03C0, 0x0400, 0x0460, 0x04E0, 0x0460, 0x0480, 0x03E0, 0x0561, 0x0540, 0x0400, 0x4C01, 0xAB20, 0xAB42, 0x3B89, 0x0401, 0x0300, 0x0380, 0x03E0, 0x03C0, 0x0340, 0x0340, 0x0380, 0x03E0, 0x0440, 0x0520, 0x0500,
-  0x0241, 0x03E0, 0x0C9A, 0x0539, 0x0601, 0x038A, 0x0D7C, 0x0517, 0x03A3, 0x057C, 0x0D58, 0x03C4, 0x0901, 0x0180, 0x09E1, 0x0180, 0x01E0, 0x01A0, 0x0180, 0x01A0, 0x0D60, 0x04A0, 0x03A0, 0x0400, 0x03A0, 0x03E0, 0x0400, 0x0647, 0x0500, 0x04C0, 0x0480, 0x04C1, 0x04E1, 0x0CE0, 0xB2C1, 0xCB65, 0xD341, 0xBC06, 0x23A0, 0x0AE0, 0x5D6B, 0x0300, 0x0280, 0x06CC, 0x0DA3, 0x0560, 0x0460, 0x0420, 0x05C1, 0x0520,
-  0x01E0, 0x14EE, 0x050A, 0x04FC, 0x051C, 0x0DD8, 0x057E, 0x0479, 0x0475, 0x0415, 0x03B5, 0x0C22, 0x01C0, 0x0321, 0x0260, 0x0180, 0x01E0, 0x0240, 0x0260, 0x09E2, 0x01A0, 0x0E02, 0x04A0, 0x04E0, 0x0480, 0x0460, 0x0420, 0x1ECF, 0x0500, 0x04E0, 0x04A0, 0x0DEA, 0x04C3, 0x6309, 0xFFFF, 0xF7FD, 0xFFFF, 0xC300, 0x6C0E, 0x69E5, 0xE3C4, 0x0840, 0x070F, 0x06CE, 0x56DC, 0x2D72, 0x03A0, 0x03E0, 0x04E0, 0x0560,
-  0x0283, 0x05BE, 0x057C, 0x04FA, 0x05B8, 0x05C9, 0x051B, 0x0417, 0x044C, 0x12E6, 0x03C9, 0x0321, 0x0280, 0x03E0, 0x0BA1, 0x0360, 0x02E0, 0x0080, 0x00C0, 0x0180, 0x0300, 0x02E0, 0x0DEA, 0x0501, 0x04A0, 0x04A0, 0x04A0, 0x0566, 0x0604, 0x0500, 0x04E0, 0x0462, 0x04E5, 0xF7BF, 0xCB27, 0xDB87, 0xEDF7, 0xFFBF, 0xAD35, 0x62EE, 0xCB02, 0xEBA5, 0x06EF, 0x051B, 0x057D, 0x0DFE, 0x0538, 0x03A0, 0x0400, 0x05C0,
-  0x051B, 0x05BE, 0x055C, 0x0E97, 0x04A0, 0x0CB9, 0x0519, 0x15B0, 0x161E, 0x2E3F, 0x04DD, 0x2F36, 0x1EAF, 0x0D8A, 0x0CE6, 0x0060, 0x0080, 0x0180, 0x01A0, 0x0AE2, 0x0321, 0x04E3, 0x05CF, 0x050F, 0x04CC, 0x04E3, 0x04E0, 0x0411, 0x0F51, 0x0666, 0x0580, 0x0500, 0xD384, 0xFBC5, 0xFC25, 0xFC66, 0xFCC6, 0xE596, 0xD409, 0x9B04, 0xBA61, 0xBAC3, 0x9F93, 0x04FA, 0x057D, 0x463F, 0x0D9F, 0x03C0, 0x2320, 0x13A0,
-  0x04B9, 0x04FB, 0x04FC, 0x0E2E, 0x02C0, 0x0D23, 0x0548, 0x1568, 0x051E, 0x15DF, 0x04DC, 0x04B3, 0x05A1, 0x05E1, 0x0DA1, 0x0480, 0x0460, 0x0320, 0x0481, 0x0540, 0x04E0, 0x0562, 0x0528, 0x04A9, 0x046C, 0x03D0, 0x032F, 0x04F3, 0x1634, 0x0731, 0x05E5, 0x0549, 0x2860, 0xFFFF, 0xFC66, 0xFC86, 0xFFFF, 0x2147, 0xAD15, 0xA242, 0xC201, 0x4B00, 0x8C91, 0x1D3A, 0x055C, 0x0DDD, 0x04C7, 0x0B80, 0x1B40, 0x2320,
-  0x0EB6, 0x0597, 0x0E88, 0x0521, 0x0452, 0x040C, 0x0D43, 0x0100, 0x04B9, 0x04DA, 0x04DB, 0x060F, 0x05E0, 0x0580, 0x0560, 0x03C0, 0x0340, 0x02E0, 0x02C0, 0x0300, 0x0420, 0x0300, 0x0420, 0x04A3, 0x0467, 0x042D, 0x04D4, 0x0634, 0x355A, 0x1D6F, 0x05A1, 0x0440, 0x2147, 0x2147, 0xFD46, 0xFD27, 0x2147, 0x2147, 0xC65A, 0x8A86, 0xFBE5, 0xFCC5, 0xF484, 0xEDC7, 0x4A07, 0x138A, 0x0365, 0x03C0, 0x0460, 0x0360,
-  0x0525, 0x053C, 0x0D58, 0x04C0, 0x04A2, 0x0C00, 0x1441, 0x0203, 0x043B, 0x0633, 0x0608, 0x066A, 0x0E87, 0x05C0, 0x0520, 0x02C0, 0x02E0, 0x02A0, 0x02C0, 0x02C0, 0x0340, 0x0240, 0x0321, 0x03A0, 0x0440, 0x03C1, 0x2EF3, 0x0DF4, 0x2020, 0xF3E4, 0xFCA5, 0x8CA4, 0xCED5, 0xFCA6, 0xFE4B, 0xF546, 0xFCE7, 0xFC26, 0xF7DE, 0xEAE3, 0xFCE5, 0xFCC5, 0xF463, 0xFDA5, 0x20A2, 0x3CE8, 0x0AA4, 0x22E0, 0x0B20, 0x0340,
-  0x04D4, 0x051C, 0x0497, 0x1C21, 0x054E, 0x0CEC, 0x0CB6, 0x02C3, 0x0457, 0x0458, 0x0D98, 0x05DE, 0x169A, 0x0B93, 0x0301, 0x02E0, 0x0280, 0x1D58, 0x361F, 0x055E, 0x0520, 0x04E0, 0x1402, 0x01E0, 0x03E0, 0x04C7, 0x04EC, 0x0B4C, 0xE446, 0xFBE4, 0xFC64, 0xFD05, 0xEDD0, 0x2147, 0xFE46, 0xFE26, 0x2147, 0xFC67, 0xF7FE, 0xFC44, 0xFCC4, 0xFC84, 0xFCE4, 0xFD85, 0x08A1, 0x1C86, 0x1A22, 0x1A20, 0x22A0, 0x12A0,
-  0x0DBF, 0x04F7, 0x0D2F, 0x24E0, 0x0474, 0x0497, 0x0402, 0x151E, 0x055D, 0x2CE5, 0x04FA, 0x055D, 0x05B9, 0x03ED, 0x2362, 0x1B69, 0x057A, 0x0CBA, 0x0D7D, 0x057D, 0x0540, 0x04E0, 0x0400, 0x03A0, 0x0320, 0x03C1, 0x0406, 0x2D71, 0xBB03, 0xD341, 0xFC65, 0xFC44, 0xE442, 0xF5A7, 0x2147, 0x2147, 0xFDA5, 0xFC64, 0xFFDD, 0xFC45, 0xFC64, 0xFC44, 0xFC43, 0xF4C4, 0x44E9, 0x2262, 0x12A0, 0x0BC0, 0x1A80, 0x2200,
-  0x059E, 0x0577, 0x0E44, 0x1460, 0x04EF, 0x0416, 0x0CB6, 0x04DC, 0x0DDF, 0x0A40, 0x0321, 0x04FC, 0x04FB, 0x0C26, 0x174F, 0x03D7, 0x049A, 0x04FA, 0x04BB, 0x0D38, 0x0500, 0x0400, 0x0320, 0x02C0, 0x0AA1, 0x0260, 0x0401, 0x03C9, 0x0B86, 0x4100, 0xF3E4, 0xFCC6, 0xF523, 0xFFBA, 0xFE05, 0xFD05, 0xFDA5, 0xFFFF, 0xF544, 0xE5A7, 0xF444, 0xE321, 0xFC65, 0x2183, 0x02A8, 0x1204, 0x12A1, 0x0460, 0x02C0, 0x0A60,
-  0x0518, 0x0E76, 0x04C0, 0x14EE, 0x162D, 0x0495, 0x0100, 0x059C, 0x05FB, 0x0980, 0x02E0, 0x0499, 0x051C, 0x1DED, 0x0520, 0x0459, 0x0479, 0x45E8, 0x08E0, 0x00E0, 0x0340, 0x02E0, 0x0260, 0x0220, 0x0260, 0x0260, 0x0240, 0x02A0, 0x0300, 0x0340, 0x0D43, 0xDCE7, 0xED64, 0xFDA3, 0xCD05, 0xD420, 0xF4E2, 0xFD65, 0xB2E2, 0x22A1, 0x1AA0, 0x0242, 0x0206, 0x09E6, 0x1962, 0x2161, 0x0AC3, 0x0428, 0x0423, 0x2282,
-  0x057E, 0x0D29, 0x04FB, 0x155E, 0x0539, 0x14D4, 0x2572, 0x0D3C, 0x04DB, 0x0526, 0x2B02, 0x047B, 0x0497, 0x1E17, 0x1D9B, 0x2481, 0x262B, 0x00A0, 0x0160, 0x02A1, 0x0220, 0x01E0, 0x09C1, 0x1522, 0x0340, 0x0260, 0x0240, 0x0220, 0x0281, 0x1A01, 0x0500, 0x04E0, 0x0380, 0x0BA2, 0x6C84, 0xF726, 0x0D83, 0x3B00, 0x1A80, 0x11C1, 0x0A20, 0x1201, 0x08E0, 0x3E1E, 0x3E1E, 0x15DC, 0x0320, 0x0361, 0x0380, 0x0340,
-  0x05DE, 0x04DB, 0x0539, 0x04FC, 0x0598, 0x1B80, 0x0CA8, 0x0457, 0x0456, 0x1C00, 0x2221, 0x072E, 0x0D6D, 0x04DB, 0x3E3F, 0x36BB, 0x33C1, 0x0100, 0x01E1, 0x02A0, 0x0A60, 0x0020, 0x0D61, 0x0480, 0x0440, 0x0340, 0x0AC0, 0x00C0, 0x0060, 0x09C3, 0x04E1, 0x0502, 0x1B60, 0x1B20, 0x2543, 0x0C40, 0x0C40, 0x0C40, 0x6E7F, 0x15BE, 0x14B7, 0x0B61, 0x0CFD, 0x0D1D, 0x155E, 0x04FC, 0x0307, 0x0361, 0x0360, 0x03A0,
-  0x059D, 0x04BB, 0x0DE3, 0x1DEE, 0x0AE1, 0x1A80, 0x11A0, 0x1D6A, 0x05A5, 0x0980, 0x1941, 0x2E97, 0x0D0A, 0x04DC, 0x3D9F, 0x057D, 0x1DD3, 0x0020, 0x0300, 0x02E0, 0x0340, 0x0CA1, 0x0400, 0x04A0, 0x15E2, 0x1642, 0x15C3, 0x0580, 0x0500, 0x04E0, 0x0527, 0x04E0, 0x1BA2, 0x2360, 0x0D83, 0x0C40, 0x7E7B, 0x2513, 0x053E, 0x0438, 0x0476, 0x02A0, 0x047B, 0x04BB, 0x04DB, 0x04BA, 0x05B5, 0x0223, 0x0340, 0x0301,
-  0x057A, 0x0EF1, 0x1582, 0x04C1, 0x02E0, 0x0140, 0x00E0, 0x1140, 0x2C64, 0x0C71, 0x0479, 0x0CDC, 0x0474, 0x053C, 0x047A, 0x043A, 0x05AE, 0x0DEA, 0x0605, 0x05E5, 0x05C3, 0x05A0, 0x0580, 0x0500, 0x04E0, 0x04C0, 0x0480, 0x0460, 0x03C0, 0x03C0, 0x1E32, 0x04E9, 0x0D91, 0x3360, 0x548B, 0x0C9C, 0x03F8, 0x0558, 0x0458, 0x0438, 0x0D2D, 0x04C1, 0x02A6, 0x04D8, 0x04BA, 0x04DA, 0x05CC, 0x0E23, 0x0340, 0x0D41,
-  0x0601, 0x05E0, 0x04A1, 0x02C0, 0x03A0, 0x0587, 0x0506, 0x0464, 0x0BAA, 0x03D3, 0x0417, 0x0C17, 0x0511, 0x0D5D, 0x0438, 0x0439, 0x05A5, 0x05E0, 0x05C0, 0x05C0, 0x0580, 0x0580, 0x0560, 0x3E70, 0x0500, 0x04A0, 0x0480, 0x0440, 0x03A0, 0x03A0, 0x15D6, 0x04DB, 0x257E, 0x04FC, 0x25B9, 0x0419, 0x0416, 0x1431, 0x04B7, 0x0CB5, 0x3D01, 0x1C80, 0x0480, 0x0DEF, 0x1658, 0x0601, 0x05E0, 0x05A0, 0x0560, 0x03A2,
-  0x04A0, 0x0580, 0x0D81, 0x3C63, 0x154C, 0x03D4, 0x040F, 0x0481, 0x0499, 0x0459, 0x1E10, 0x246A, 0x0980, 0x0287, 0x04F8, 0x0556, 0x0627, 0x0480, 0x04A0, 0x0D41, 0x0D80, 0x1D02, 0x3E5D, 0x2DBE, 0x0CF9, 0x0180, 0x0060, 0x0040, 0x0040, 0x00A0, 0x2579, 0x055D, 0x1D9F, 0x04DD, 0x0E09, 0x04BA, 0x0436, 0x54A2, 0x43E0, 0x2626, 0x0520, 0x0C40, 0x03A0, 0x051B, 0x04DB, 0x0651, 0x0641, 0x0DE0, 0x0560, 0x0560,
-  0x0480, 0x0560, 0x03A0, 0x3400, 0x0352, 0x0D9E, 0x04FA, 0x156C, 0x0499, 0x0479, 0x0DCF, 0x0120, 0x00E0, 0x0D1B, 0x0C19, 0x0571, 0x0540, 0x04E0, 0x0440, 0x0380, 0x0280, 0x0A20, 0x15FD, 0x0CDD, 0x04F9, 0x0D82, 0x0CA1, 0x0180, 0x0261, 0x02E0, 0x0280, 0x04DC, 0x04DC, 0x0478, 0x8EF6, 0x1C40, 0x2420, 0x0C01, 0x03A0, 0x0360, 0x16A2, 0x04C0, 0x0B82, 0x04FB, 0x04DB, 0x0D72, 0x0300, 0x0621, 0x0601, 0x0540,
-  0x03C0, 0x0380, 0x0AE0, 0x14CD, 0x03B5, 0x04DB, 0x04D9, 0x0D8A, 0x0D38, 0x04F6, 0x0521, 0x02C0, 0x0D3D, 0x04FC, 0x043A, 0x0498, 0x0560, 0x0C60, 0x02A0, 0x0261, 0x0220, 0x01E0, 0x0A01, 0x152B, 0x05A0, 0x04C0, 0x0460, 0x0360, 0x03C0, 0x1565, 0x0500, 0x04C1, 0x05DA, 0x0DBF, 0x25BF, 0x055C, 0x1BA2, 0x0BA0, 0x0B80, 0x0380, 0x0B41, 0x066A, 0x159C, 0x059E, 0x25ED, 0x05AB, 0x0D00, 0x0320, 0x05E0, 0x05E1,
-  0x0C41, 0x0300, 0x0260, 0x0220, 0x1462, 0x0518, 0x0D9F, 0x057E, 0x0260, 0x0160, 0x02C1, 0x0200, 0x051B, 0x055C, 0x047A, 0x0D34, 0x00A0, 0x08C0, 0x01C1, 0x0260, 0x01A0, 0x01A0, 0x0220, 0x0BA1, 0x0360, 0x0260, 0x03A0, 0x1EE6, 0x0D00, 0x04C0, 0x04C0, 0x04A0, 0x0460, 0x055D, 0x051D, 0x04DC, 0x0EAC, 0x0B60, 0x0380, 0x0360, 0x0380, 0x0CDC, 0x155F, 0x051D, 0x0578, 0x04C0, 0x0420, 0x1A00, 0x0E25, 0x0600,
-  0x1D0F, 0x0340, 0x0220, 0x0200, 0x0980, 0x04BA, 0x055E, 0x055E, 0x0D79, 0x0450, 0x00E0, 0x01A0, 0x0120, 0x060A, 0x1421, 0x01A1, 0x0080, 0x0060, 0x0040, 0x0040, 0x0121, 0x0340, 0x0421, 0x1CE6, 0x2667, 0x0669, 0x0500, 0x04C0, 0x04A0, 0x04A0, 0x04C0, 0x04A0, 0x0C60, 0x2E9C, 0x053B, 0x059B, 0x05C3, 0x0520, 0x03E0, 0x0360, 0x0320, 0x0479, 0x049A, 0x049A, 0x0579, 0x0420, 0x04E0, 0x0CA0, 0x0B02, 0x0640,
-  0x04FA, 0x0DF2, 0x01C0, 0x0160, 0x0223, 0x0479, 0x04BA, 0x0499, 0x0386, 0x43C0, 0x0AC0, 0x0102, 0x151D, 0x04D7, 0x1C41, 0x0340, 0x00A0, 0x0248, 0x04FD, 0x0CBA, 0x05F2, 0x0D84, 0x04C0, 0x04A0, 0x0568, 0x0521, 0x04E0, 0x04C0, 0x04C0, 0x04E0, 0x1402, 0x0300, 0x0361, 0x0300, 0x0220, 0x1DA2, 0x05A0, 0x0500, 0x03A0, 0x03A0, 0x0360, 0x02E2, 0x0D96, 0x0DF4, 0x05E8, 0x0400, 0x0480, 0x04A0, 0x0940, 0x01A0,
-  0x04B8, 0x0DA5, 0x0200, 0x0100, 0x0468, 0x06F3, 0x0E90, 0x0EB1, 0x0A42, 0x0AA0, 0x3BE1, 0x01E0, 0x0C57, 0x04D4, 0x1BC1, 0x1AC0, 0x1220, 0x363E, 0x04DC, 0x0478, 0x0587, 0x0540, 0x04E0, 0x05ED, 0x06D1, 0x0D81, 0x04E0, 0x0CE1, 0x0020, 0x0080, 0x0020, 0x0061, 0x0060, 0x0180, 0x02E0, 0x0320, 0x05C0, 0x0500, 0x03A0, 0x0380, 0x0360, 0x02E0, 0x0CA3, 0x0600, 0x05A0, 0x0600, 0x0400, 0x4E9D, 0x45BE, 0x25DF,
-  0x0D8F, 0x0560, 0x03C0, 0x0A46, 0x03C1, 0x06EA, 0x0601, 0x0684, 0x09E0, 0x1220, 0x0AA0, 0x13C5, 0x0DCE, 0x2460, 0x54C5, 0x2AE0, 0x11E0, 0x2E1D, 0x04FB, 0x0478, 0x0E6F, 0x02E0, 0x1DD7, 0x04FB, 0x04BA, 0x15A2, 0x0160, 0x0160, 0x00C0, 0x0040, 0x0060, 0x0060, 0x0040, 0x0060, 0x02A1, 0x0641, 0x0580, 0x0480, 0x0CE1, 0x03E0, 0x0360, 0x0340, 0x02A0, 0x0600, 0x05A0, 0x0C20, 0x13E0, 0x0479, 0x03F7, 0x0BD7,
-  0x05C0, 0x0480, 0x0D1B, 0x05DE, 0x1E7F, 0x0E42, 0x0600, 0x05E0, 0x0DA1, 0x1180, 0x1A20, 0x0060, 0x15AB, 0x0D9A, 0x03C5, 0x1579, 0x057E, 0x0519, 0x04B9, 0x1CCE, 0x0440, 0x0261, 0x1DDE, 0x055E, 0x04DA, 0x00C1, 0x0061, 0x0040, 0x0000, 0x0940, 0x0100, 0x0060, 0x0060, 0x0CA0, 0x0484, 0x06E9, 0x05A0, 0x03E0, 0x1242, 0x04A0, 0x0380, 0x02E0, 0x02E0, 0x0480, 0x04E0, 0x03E0, 0x0D20, 0x044C, 0x0416, 0x0571,
-  0x0260, 0x0D60, 0x0497, 0x0498, 0x0478, 0x0462, 0x0440, 0x0440, 0x6F9A, 0x0380, 0x1121, 0x0960, 0x04FA, 0x057C, 0x0D18, 0x0507, 0x04FA, 0x04DA, 0x0479, 0x0477, 0x5E07, 0x08E1, 0x1350, 0x2E5F, 0x2E19, 0x7E7F, 0x45BE, 0x00C0, 0x0120, 0x0120, 0x0100, 0x0120, 0x0580, 0x0440, 0x06CC, 0x06EC, 0x05C0, 0x0240, 0x0040, 0x0840, 0x0460, 0x0320, 0x02A0, 0x0A41, 0x04C0, 0x0440, 0x0420, 0x0AE1, 0x0441, 0x2CC3,
-  0x0A60, 0x0161, 0x0E15, 0x054F, 0x058C, 0x0340, 0x0340, 0x055D, 0x051D, 0x0558, 0x0320, 0x08E0, 0x04B9, 0x04FA, 0x0DD3, 0x02C0, 0x04D4, 0x0D38, 0x04BA, 0x0456, 0x7606, 0x0061, 0x0840, 0x0120, 0x0D9D, 0x259E, 0x0D5D, 0x57D6, 0x01A0, 0x0101, 0x00A0, 0x0460, 0x0360, 0x055E, 0x04DB, 0x04F6, 0x2EE8, 0x0060, 0x0060, 0x0080, 0x0140, 0x03C0, 0x02C0, 0x0A61, 0x057E, 0x057E, 0x25D7, 0x0CE0, 0x0B60, 0x0D88
+  px565(0x05EA), px565(0x0DE4), px565(0x04E0), px565(0x04E0), px565(0x04DA), px565(0x04BC), px565(0x0553), px565(0x0E18), px565(0x0501), px565(0x0CC2), px565(0x05FF), px565(0x0D9D), px565(0x05FE), px565(0x04ED), px565(0x0420), px565(0x0400), px565(0x0420), px565(0x0420), px565(0x0498), px565(0x0499), px565(0x04A2), px565(0x0300), px565(0x0260), px565(0x0360), px565(0x059D), px565(0x04BB), px565(0x0572), px565(0x0440), px565(0x03C0), px565(0x01E1), px565(0x0201), px565(0x06AC), px565(0x060B), px565(0x0540), px565(0x02E0), px565(0x0360), px565(0x0580), px565(0x0480), px565(0x0D36), px565(0x0418), px565(0x03D5), px565(0x03AA), px565(0x0320), px565(0x0B81), px565(0x0360), px565(0x0402), px565(0x1511), px565(0x05AB), px565(0x0567), px565(0x0562),
+  px565(0x05A1), px565(0x0500), px565(0x0500), px565(0x04C1), px565(0x061E), px565(0x05DE), px565(0x0501), px565(0x068A), px565(0x05A2), px565(0x0549), px565(0x053D), px565(0x05FE), px565(0x161F), px565(0x053D), px565(0x0381), px565(0x0400), px565(0x0420), px565(0x0360), px565(0x0361), px565(0x0360), px565(0x03C2), px565(0x0340), px565(0x0280), px565(0x0220), px565(0x0499), px565(0x0477), px565(0x1461), px565(0x5E5D), px565(0x15FF), px565(0x0D3D), px565(0x09A0), px565(0x26CE), px565(0x0E6A), px565(0x0580), px565(0x0CE1), px565(0x0300), px565(0x0560), px565(0x04C0), px565(0x0495), px565(0x03F5), px565(0x044C), px565(0x0467), px565(0x02C1), px565(0x02C0), px565(0x0BE1), px565(0x0380), px565(0x0320), px565(0x0320), px565(0x05A7), px565(0x0561),
+  px565(0x04A0), px565(0x0540), px565(0x0541), px565(0x0577), px565(0x05DF), px565(0x053D), px565(0x35FE), px565(0x45DF), px565(0x05B4), px565(0x0581), px565(0x04F8), px565(0x05BF), px565(0x057E), px565(0x053A), px565(0x1675), px565(0x0CA4), px565(0x0480), px565(0x04A0), px565(0x03E0), px565(0x04B1), px565(0x8F3F), px565(0x04FA), px565(0x7F9F), px565(0x1DFE), px565(0x04F1), px565(0x04A8), px565(0x0C62), px565(0x051A), px565(0x0459), px565(0x0459), px565(0x0C52), px565(0x0120), px565(0x0623), px565(0x0581), px565(0x02C0), px565(0x0260), px565(0x0560), px565(0x04E0), px565(0x03E0), px565(0x04ED), px565(0x0420), px565(0x0480), px565(0x0CE8), px565(0x13E8), px565(0x0301), px565(0x0460), px565(0x5EF8), px565(0x96FF), px565(0x0D50), px565(0x05A1),
+  px565(0x056A), px565(0x056A), px565(0x0563), px565(0x04C4), px565(0x04FA), px565(0x0DB3), px565(0x25DD), px565(0x1DBD), px565(0x053C), px565(0x0564), px565(0x0521), px565(0x0565), px565(0x15FB), px565(0x6E5F), px565(0x0D7F), px565(0x0D8E), px565(0x467F), px565(0x053C), px565(0x0559), px565(0x05F2), px565(0x05EF), px565(0x0595), px565(0x055E), px565(0x049A), px565(0x050F), px565(0x0380), px565(0x0300), px565(0x02C3), px565(0x04D7), px565(0x0478), px565(0x03C4), px565(0x0241), px565(0x05E0), px565(0x0443), px565(0x04DC), px565(0x1DF6), px565(0x2EBF), px565(0x0449), px565(0x0380), px565(0x0280), px565(0x0D00), px565(0x0460), px565(0x04E0), px565(0x0565), px565(0x0C65), px565(0x1542), px565(0x053D), px565(0x04FB), px565(0x04FC), px565(0x0400),
+  px565(0x053C), px565(0x0552), px565(0x04A0), px565(0x0CE4), px565(0x0484), px565(0x0E89), px565(0x1633), px565(0x05BA), px565(0x0653), px565(0x05A1), px565(0x04A0), px565(0x0400), px565(0x0553), px565(0x05BD), px565(0x051C), px565(0x467F), px565(0x0D7F), px565(0x049B), px565(0x04F7), px565(0x05D5), px565(0x0542), px565(0x0520), px565(0x04FA), px565(0x04F6), px565(0x0589), px565(0x04C2), px565(0x02C1), px565(0x02A0), px565(0x0CC8), px565(0x0DDD), px565(0x361F), px565(0x0D7D), px565(0x0340), px565(0x0496), px565(0x04BB), px565(0x055E), px565(0x04FC), px565(0x0479), px565(0x0BF1), px565(0x0A41), px565(0x0220), px565(0x0440), px565(0x0480), px565(0x04E0), px565(0x0500), px565(0x04A0), px565(0x051A), px565(0x053A), px565(0x056E), px565(0x03A0),
+  px565(0x053C), px565(0x0E12), px565(0x05C3), px565(0x1625), px565(0x0420), px565(0x03A2), px565(0x05C2), px565(0x0480), px565(0x0380), px565(0x0DA0), px565(0x0540), px565(0x04E0), px565(0x04E0), px565(0x0509), px565(0x0625), px565(0x4E7F), px565(0x059E), px565(0x047B), px565(0x059D), px565(0x055E), px565(0x04D6), px565(0x0544), px565(0x0341), px565(0x162C), px565(0x0546), px565(0x0544), px565(0x04E4), px565(0x0285), px565(0x140F), px565(0x051C), px565(0x04BB), px565(0x0439), px565(0x0220), px565(0x1D15), px565(0x0C99), px565(0x049A), px565(0x045A), px565(0x04BB), px565(0x03E6), px565(0x057E), px565(0x0417), px565(0x0C57), px565(0x02C0), px565(0x03E0), px565(0x0440), px565(0x0440), px565(0x0E05), px565(0x05A4), px565(0x05A1), px565(0x0320),
+  px565(0x059B), px565(0x05EC), px565(0x0628), px565(0x05C0), px565(0x0DF6), px565(0x1DDE), px565(0x055C), px565(0x0DCC), px565(0x0381), px565(0x02A0), px565(0x0260), px565(0x0D41), px565(0x0520), px565(0x04A0), px565(0x0480), px565(0x03C2), px565(0x0DBA), px565(0x0DE8), px565(0x1E1F), px565(0x057E), px565(0x04D5), px565(0x0544), px565(0x0CA0), px565(0x0280), px565(0x0505), px565(0x0420), px565(0x03A1), px565(0x053D), px565(0x0418), px565(0x0435), px565(0x0458), px565(0x03F9), px565(0x0261), px565(0x01E0), px565(0x03AB), px565(0x0D71), px565(0x0595), px565(0x054D), px565(0x0340), px565(0x051D), px565(0x0437), px565(0x0434), px565(0x0422), px565(0x0D6D), px565(0x2635), px565(0x0360), px565(0x05C3), px565(0x05C1), px565(0x05A0), px565(0x1461),
+  px565(0x0647), px565(0x0E5E), px565(0x053C), px565(0x0DEA), px565(0x0619), px565(0x05BE), px565(0x04D8), px565(0x0528), px565(0x0520), px565(0x04E1), px565(0x0CE1), px565(0x03C0), px565(0x0440), px565(0x05BE), px565(0x059E), px565(0x0448), px565(0x0380), px565(0x0380), px565(0x0440), px565(0x0300), px565(0x04ED), px565(0x054B), px565(0x04A2), px565(0x03C0), px565(0x0D01), px565(0x03E0), px565(0x03C2), px565(0x03F5), px565(0x042F), px565(0x0446), px565(0x0572), px565(0x04E8), px565(0x1DAB), px565(0x0220), px565(0x0365), px565(0x1E1D), px565(0x0D9E), px565(0x0599), px565(0x03E0), px565(0x0D3A), px565(0x0458), px565(0x0C31), px565(0x15DC), px565(0x25DE), px565(0x14D9), px565(0x05ED), px565(0x02C0), px565(0x0560), px565(0x05A0), px565(0x0560),
+  px565(0x059D), px565(0x04DB), px565(0x0590), px565(0x04CC), px565(0x04C3), px565(0x0CDA), px565(0x05CF), px565(0x0D41), px565(0x0440), px565(0x04A1), px565(0x4E7E), px565(0x051A), px565(0x0404), px565(0x057E), px565(0x051D), px565(0x0518), px565(0x0CC1), px565(0x1562), px565(0x0500), px565(0x0DE4), px565(0x059D), px565(0x05DF), px565(0x055E), px565(0x1C97), px565(0x0300), px565(0x1DC3), px565(0x03C0), px565(0x1DE9), px565(0x0440), px565(0x0420), px565(0x062C), px565(0x0567), px565(0x04A1), px565(0x0240), px565(0x038D), px565(0x055D), px565(0x2DDF), px565(0x051D), px565(0x0504), px565(0x0421), px565(0x04A5), px565(0x0522), px565(0x057D), px565(0x055F), px565(0x053C), px565(0x0601), px565(0x05A0), px565(0x0560), px565(0x0606), px565(0x1CA1),
+  px565(0x04B3), px565(0x04B8), px565(0x04E0), px565(0x0480), px565(0x04A1), px565(0x042A), px565(0x057F), px565(0x0539), px565(0x05E6), px565(0x0487), px565(0x2E1F), px565(0x04DC), px565(0x0482), px565(0x66FF), px565(0x0559), px565(0x0E96), px565(0x0560), px565(0x0381), px565(0x0320), px565(0x0340), px565(0x055C), px565(0x15DE), px565(0x05BE), px565(0x0499), px565(0x02A0), px565(0x0300), px565(0x04E0), px565(0x0420), px565(0x0E03), px565(0x04A0), px565(0x0360), px565(0x05E6), px565(0x0522), px565(0x0DA4), px565(0x02C9), px565(0x04BA), px565(0x04DB), px565(0x04BA), px565(0x0E0F), px565(0x04A0), px565(0x04E0), px565(0x15A1), px565(0x055B), px565(0x25FF), px565(0x055C), px565(0x0540), px565(0x0560), px565(0x0623), px565(0x2522), px565(0x14E0),
+  px565(0x04F5), px565(0x04D2), px565(0x0D20), px565(0x0520), px565(0x04E0), px565(0x055E), px565(0x04BC), px565(0x0C79), px565(0x05A1), px565(0x0400), px565(0x051D), px565(0x0D93), px565(0x1553), px565(0x057E), px565(0x0478), px565(0x04C7), px565(0x03C0), px565(0x0B60), px565(0x1D74), px565(0x051B), px565(0x04DB), px565(0x04FB), px565(0x055C), px565(0x0518), px565(0x36B7), px565(0x0280), px565(0x02A0), px565(0x04A0), px565(0x0381), px565(0x15C2), px565(0x0380), px565(0x0602), px565(0x0D81), px565(0x04A0), px565(0x0C41), px565(0x15BA), px565(0x0498), px565(0x05B9), px565(0x0D87), px565(0x0440), px565(0x0500), px565(0x0420), px565(0x0481), px565(0x0509), px565(0x02C0), px565(0x0520), px565(0x0540), px565(0x0580), px565(0x05C3), px565(0x4480),
+  px565(0x059E), px565(0x05DF), px565(0x059D), px565(0x0461), px565(0x164E), px565(0x055C), px565(0x051D), px565(0x04DA), px565(0x0401), px565(0x02E0), px565(0x1D72), px565(0x02E2), px565(0x0221), px565(0x04BB), px565(0x0B74), px565(0x0469), px565(0x055D), px565(0x14BB), px565(0x059E), px565(0x04D9), px565(0x0484), px565(0x0302), px565(0x0584), px565(0x059E), px565(0x7E9F), px565(0x0DBE), px565(0x0C04), px565(0x15A6), px565(0x0460), px565(0x0360), px565(0x0C01), px565(0x0320), px565(0x0540), px565(0x0440), px565(0x03C0), px565(0x02C0), px565(0x04E0), px565(0x0522), px565(0x0460), px565(0x0520), px565(0x05E1), px565(0x0420), px565(0x03E0), px565(0x03E0), px565(0x03E0), px565(0x46A7), px565(0x05E1), px565(0x05A0), px565(0x0560), px565(0x0560),
+  px565(0x057E), px565(0x1DDF), px565(0x04FC), px565(0x04DA), px565(0x0BA0), px565(0x0401), px565(0x0DCC), px565(0x0421), px565(0x0360), px565(0x15FF), px565(0x057E), px565(0x04BB), px565(0x0460), px565(0x1DAE), px565(0x0450), px565(0x0D5C), px565(0x04DB), px565(0x0438), px565(0x04D8), px565(0x0514), px565(0x04C0), px565(0x0C21), px565(0x0483), px565(0x057D), px565(0x2DBF), px565(0x0D7E), px565(0x0496), px565(0x03C0), px565(0x0480), px565(0x0320), px565(0x0260), px565(0x02A0), px565(0x16A6), px565(0x04C0), px565(0x0440), px565(0x0380), px565(0x02E0), px565(0x03A0), px565(0x0320), px565(0x04E5), px565(0x04C0), px565(0x0460), px565(0x03E0), px565(0x03E0), px565(0x0BC0), px565(0x0B20), px565(0x6FCD), px565(0x0664), px565(0x05A0), px565(0x0540),
+  px565(0x057E), px565(0x059E), px565(0x04DC), px565(0x04F6), px565(0x0634), px565(0x0D64), px565(0x0D82), px565(0x04E0), px565(0x03A1), px565(0x0D9E), px565(0x051D), px565(0x04F6), px565(0x04C0), px565(0x0420), px565(0x0524), px565(0x0428), px565(0x0418), px565(0x0416), px565(0x060E), px565(0x0DE4), px565(0x0440), px565(0x03C0), px565(0x0320), px565(0x04DC), px565(0x04BA), px565(0x0479), px565(0x0458), px565(0x03A1), px565(0x04C2), px565(0x02C0), px565(0x01E0), px565(0x01C0), px565(0x02A0), px565(0x05A0), px565(0x04A0), px565(0x0400), px565(0x03E0), px565(0x03E1), px565(0x0320), px565(0x0492), px565(0x04BA), px565(0x0600), px565(0x04C0), px565(0x0420), px565(0x0380), px565(0x0B61), px565(0x0585), px565(0x05A4), px565(0x0603), px565(0x04C0),
+  px565(0x0DD9), px565(0x04FA), px565(0x04D9), px565(0x054E), px565(0x04C4), px565(0x03E0), px565(0x0400), px565(0x0400), px565(0x0380), px565(0x0D12), px565(0x057C), px565(0x264A), px565(0x0400), px565(0x0360), px565(0x0320), px565(0x02C0), px565(0x04C8), px565(0x03E0), px565(0x02A0), px565(0x0642), px565(0x0460), px565(0x03E0), px565(0x0320), px565(0x0280), px565(0x0690), px565(0x04D6), px565(0x04B2), px565(0x0520), px565(0x0D24), px565(0x0A80), px565(0x01E0), px565(0x01A0), px565(0x01A0), px565(0x04A0), px565(0x05A0), px565(0x04E0), px565(0x0460), px565(0x03E0), px565(0x0C01), px565(0x02C1), px565(0x0497), px565(0x3466), px565(0x0540), px565(0x04C0), px565(0x0C20), px565(0x03A0), px565(0x05C2), px565(0x0D20), px565(0x0580), px565(0x04E0),
+  px565(0x05AA), px565(0x0460), px565(0x1504), px565(0x0569), px565(0x0480), px565(0x0400), px565(0x03C0), px565(0x03C0), px565(0x03A0), px565(0x059E), px565(0x049B), px565(0x0CB6), px565(0x0340), px565(0x0380), px565(0x0320), px565(0x02C0), px565(0x01E1), px565(0x2E14), px565(0x0363), px565(0x02A1), px565(0x0D63), px565(0x0420), px565(0x0360), px565(0x02E0), px565(0x0260), px565(0x05C5), px565(0x062A), px565(0x0D62), px565(0x05C7), px565(0x03E0), px565(0x01A0), px565(0x01E0), px565(0x01C0), px565(0x0200), px565(0x0DC1), px565(0x0561), px565(0x04C0), px565(0x0440), px565(0x03C0), px565(0x0400), px565(0x0400), px565(0x0360), px565(0x0440), px565(0x0540), px565(0x0480), px565(0x0480), px565(0x2E57), px565(0x6E3F), px565(0x25DE), px565(0x0644),
+  px565(0x0460), px565(0x0320), px565(0x02E0), px565(0x02C0), px565(0x02A0), px565(0x0CC1), px565(0x03E0), px565(0x0381), px565(0x02C0), px565(0x05DD), px565(0x049B), px565(0x0CF1), px565(0x03A0), px565(0x0340), px565(0x0B81), px565(0x02E0), px565(0x057D), px565(0x3E1F), px565(0x051D), px565(0x0C42), px565(0x0380), px565(0x0300), px565(0x04E0), px565(0x03A0), px565(0x02E0), px565(0x05C1), px565(0x064E), px565(0x561E), px565(0x0D3E), px565(0x04BA), px565(0x06CD), px565(0x3694), px565(0x0F58), px565(0x06AB), px565(0x0669), px565(0x0601), px565(0x05A0), px565(0x0540), px565(0x0540), px565(0x0D01), px565(0x0380), px565(0x0360), px565(0x0100), px565(0x0E83), px565(0x04C0), px565(0x0460), px565(0x04DC), px565(0x04FD), px565(0x04BD), px565(0x04E7),
+  px565(0x03C0), px565(0x0321), px565(0x0200), px565(0x0A40), px565(0x0220), px565(0x04DA), px565(0x1DF1), px565(0x0180), px565(0x0260), px565(0x02C1), px565(0x0E37), px565(0x0441), px565(0x0D12), px565(0x0320), px565(0x0320), px565(0x05A8), px565(0x04DB), px565(0x04DB), px565(0x04FC), px565(0x0240), px565(0x0468), px565(0x0483), px565(0x0360), px565(0x05A0), px565(0x0460), px565(0x1543), px565(0x051D), px565(0x0D5E), px565(0x04BC), px565(0x047C), px565(0x0671), px565(0x0647), px565(0x0560), px565(0x0540), px565(0x0520), px565(0x0520), px565(0x04E0), px565(0x04A0), px565(0x0400), px565(0x0460), px565(0x0500), px565(0x0CE1), px565(0x0A40), px565(0x0220), px565(0x0560), px565(0x0480), px565(0x0498), px565(0x0479), px565(0x0478), px565(0x0545),
+  px565(0x0440), px565(0x0340), px565(0x0260), px565(0x01E0), px565(0x0CD0), px565(0x0459), px565(0x04CE), px565(0x0AC0), px565(0x0360), px565(0x0140), px565(0x0C4D), px565(0x049C), px565(0x045A), px565(0x04C8), px565(0x0400), px565(0x03C0), px565(0x0380), px565(0x062E), px565(0x0672), px565(0x05C1), px565(0x0D60), px565(0x05A4), px565(0x05C6), px565(0x05A5), px565(0x0582), px565(0x0521), px565(0x2DB6), px565(0x0CDB), px565(0x04BB), px565(0x0539), px565(0x064A), px565(0x0E24), px565(0x0581), px565(0x0602), px565(0x16A6), px565(0x0E43), px565(0x0DC2), px565(0x04C0), px565(0x0420), px565(0x03C0), px565(0x0460), px565(0x04A1), px565(0x0500), px565(0x03C0), px565(0x0421), px565(0x04E0), px565(0x0BC0), px565(0x062F), px565(0x05F0), px565(0x0541),
+  px565(0x04C0), px565(0x0420), px565(0x0340), px565(0x02E0), px565(0x0220), px565(0x0363), px565(0x0CE9), px565(0x0420), px565(0x0422), px565(0x0401), px565(0x04BC), px565(0x045A), px565(0x0439), px565(0x14CA), px565(0x0380), px565(0x0380), px565(0x0300), px565(0x0D87), px565(0x05C4), px565(0x05C6), px565(0x04A0), px565(0x02A0), px565(0x03E0), px565(0x0480), px565(0x0566), px565(0x0E92), px565(0x0320), px565(0x0300), px565(0x0440), px565(0x05C0), px565(0x04E0), px565(0x05A1), px565(0x0360), px565(0x0320), px565(0x0300), px565(0x4C04), px565(0x0360), px565(0x0D80), px565(0x0B80), px565(0x0380), px565(0x03E0), px565(0x03E0), px565(0x03E0), px565(0x0400), px565(0x0480), px565(0x0503), px565(0x0420), px565(0x06A8), px565(0x0540), px565(0x0461),
+  px565(0x0300), px565(0x0320), px565(0x04B5), px565(0x1D99), px565(0x0320), px565(0x0D1A), px565(0x053C), px565(0x057E), px565(0x04DA), px565(0x051C), px565(0x0CDB), px565(0x04FB), px565(0x04DA), px565(0x04A4), px565(0x0BE0), px565(0x0B40), px565(0x0B41), px565(0x02E0), px565(0x0DE0), px565(0x0561), px565(0x0460), px565(0x0421), px565(0x02E0), px565(0x0340), px565(0x0C80), px565(0x05D5), px565(0x04A7), px565(0x0340), px565(0x03A0), px565(0x1EAC), px565(0x0582), px565(0x05C2), px565(0x0669), px565(0x0321), px565(0x0AE0), px565(0x1A80), px565(0x02C0), px565(0x0B00), px565(0x0D80), px565(0x0480), px565(0x0B60), px565(0x0380), px565(0x0380), px565(0x03A0), px565(0x0420), px565(0x0460), px565(0x0440), px565(0x04E4), px565(0x0540), px565(0x0C83),
+  px565(0x02E1), px565(0x0200), px565(0x055D), px565(0x055D), px565(0x0CD4), px565(0x0433), px565(0x059D), px565(0x057E), px565(0x0479), px565(0x057D), px565(0x051C), px565(0x051B), px565(0x0543), px565(0x13C7), px565(0x0C2B), px565(0x00C0), px565(0x0081), px565(0x0B01), px565(0x03A0), px565(0x0D20), px565(0x0BE0), px565(0x0360), px565(0x03C0), px565(0x0420), px565(0x0301), px565(0x0CB5), px565(0x0C52), px565(0x0421), px565(0x0400), px565(0x0420), px565(0x0F0F), px565(0x0581), px565(0x05E5), px565(0x0420), px565(0x1A80), px565(0x1A80), px565(0x53A3), px565(0x3B08), px565(0x0AA0), px565(0x0C80), px565(0x04A1), px565(0x0320), px565(0x0320), px565(0x0340), px565(0x0340), px565(0x03C0), px565(0x0400), px565(0x0461), px565(0x0500), px565(0x04E0),
+  px565(0x01E2), px565(0x1421), px565(0x04FC), px565(0x055C), px565(0x0535), px565(0x0B63), px565(0x0D9C), px565(0x05DF), px565(0x04BA), px565(0x05BB), px565(0x0DFE), px565(0x04FA), px565(0x1DA7), px565(0x00E0), px565(0x0183), px565(0x0266), px565(0x09A1), px565(0x0140), px565(0x0160), px565(0x15E2), px565(0x0420), px565(0x0380), px565(0x0320), px565(0x0300), px565(0x03C0), px565(0x0400), px565(0x0460), px565(0x04E0), px565(0x0460), px565(0x0480), px565(0x03E0), px565(0x0561), px565(0x0540), px565(0x0400), px565(0x4C01), px565(0xAB20), px565(0xAB42), px565(0x3B89), px565(0x0401), px565(0x0300), px565(0x0380), px565(0x03E0), px565(0x03C0), px565(0x0340), px565(0x0340), px565(0x0380), px565(0x03E0), px565(0x0440), px565(0x0520), px565(0x0500),
+  px565(0x0241), px565(0x03E0), px565(0x0C9A), px565(0x0539), px565(0x0601), px565(0x038A), px565(0x0D7C), px565(0x0517), px565(0x03A3), px565(0x057C), px565(0x0D58), px565(0x03C4), px565(0x0901), px565(0x0180), px565(0x09E1), px565(0x0180), px565(0x01E0), px565(0x01A0), px565(0x0180), px565(0x01A0), px565(0x0D60), px565(0x04A0), px565(0x03A0), px565(0x0400), px565(0x03A0), px565(0x03E0), px565(0x0400), px565(0x0647), px565(0x0500), px565(0x04C0), px565(0x0480), px565(0x04C1), px565(0x04E1), px565(0x0CE0), px565(0xB2C1), px565(0xCB65), px565(0xD341), px565(0xBC06), px565(0x23A0), px565(0x0AE0), px565(0x5D6B), px565(0x0300), px565(0x0280), px565(0x06CC), px565(0x0DA3), px565(0x0560), px565(0x0460), px565(0x0420), px565(0x05C1), px565(0x0520),
+  px565(0x01E0), px565(0x14EE), px565(0x050A), px565(0x04FC), px565(0x051C), px565(0x0DD8), px565(0x057E), px565(0x0479), px565(0x0475), px565(0x0415), px565(0x03B5), px565(0x0C22), px565(0x01C0), px565(0x0321), px565(0x0260), px565(0x0180), px565(0x01E0), px565(0x0240), px565(0x0260), px565(0x09E2), px565(0x01A0), px565(0x0E02), px565(0x04A0), px565(0x04E0), px565(0x0480), px565(0x0460), px565(0x0420), px565(0x1ECF), px565(0x0500), px565(0x04E0), px565(0x04A0), px565(0x0DEA), px565(0x04C3), px565(0x6309), px565(0xFFFF), px565(0xF7FD), px565(0xFFFF), px565(0xC300), px565(0x6C0E), px565(0x69E5), px565(0xE3C4), px565(0x0840), px565(0x070F), px565(0x06CE), px565(0x56DC), px565(0x2D72), px565(0x03A0), px565(0x03E0), px565(0x04E0), px565(0x0560),
+  px565(0x0283), px565(0x05BE), px565(0x057C), px565(0x04FA), px565(0x05B8), px565(0x05C9), px565(0x051B), px565(0x0417), px565(0x044C), px565(0x12E6), px565(0x03C9), px565(0x0321), px565(0x0280), px565(0x03E0), px565(0x0BA1), px565(0x0360), px565(0x02E0), px565(0x0080), px565(0x00C0), px565(0x0180), px565(0x0300), px565(0x02E0), px565(0x0DEA), px565(0x0501), px565(0x04A0), px565(0x04A0), px565(0x04A0), px565(0x0566), px565(0x0604), px565(0x0500), px565(0x04E0), px565(0x0462), px565(0x04E5), px565(0xF7BF), px565(0xCB27), px565(0xDB87), px565(0xEDF7), px565(0xFFBF), px565(0xAD35), px565(0x62EE), px565(0xCB02), px565(0xEBA5), px565(0x06EF), px565(0x051B), px565(0x057D), px565(0x0DFE), px565(0x0538), px565(0x03A0), px565(0x0400), px565(0x05C0),
+  px565(0x051B), px565(0x05BE), px565(0x055C), px565(0x0E97), px565(0x04A0), px565(0x0CB9), px565(0x0519), px565(0x15B0), px565(0x161E), px565(0x2E3F), px565(0x04DD), px565(0x2F36), px565(0x1EAF), px565(0x0D8A), px565(0x0CE6), px565(0x0060), px565(0x0080), px565(0x0180), px565(0x01A0), px565(0x0AE2), px565(0x0321), px565(0x04E3), px565(0x05CF), px565(0x050F), px565(0x04CC), px565(0x04E3), px565(0x04E0), px565(0x0411), px565(0x0F51), px565(0x0666), px565(0x0580), px565(0x0500), px565(0xD384), px565(0xFBC5), px565(0xFC25), px565(0xFC66), px565(0xFCC6), px565(0xE596), px565(0xD409), px565(0x9B04), px565(0xBA61), px565(0xBAC3), px565(0x9F93), px565(0x04FA), px565(0x057D), px565(0x463F), px565(0x0D9F), px565(0x03C0), px565(0x2320), px565(0x13A0),
+  px565(0x04B9), px565(0x04FB), px565(0x04FC), px565(0x0E2E), px565(0x02C0), px565(0x0D23), px565(0x0548), px565(0x1568), px565(0x051E), px565(0x15DF), px565(0x04DC), px565(0x04B3), px565(0x05A1), px565(0x05E1), px565(0x0DA1), px565(0x0480), px565(0x0460), px565(0x0320), px565(0x0481), px565(0x0540), px565(0x04E0), px565(0x0562), px565(0x0528), px565(0x04A9), px565(0x046C), px565(0x03D0), px565(0x032F), px565(0x04F3), px565(0x1634), px565(0x0731), px565(0x05E5), px565(0x0549), px565(0x2860), px565(0xFFFF), px565(0xFC66), px565(0xFC86), px565(0xFFFF), px565(0x2147), px565(0xAD15), px565(0xA242), px565(0xC201), px565(0x4B00), px565(0x8C91), px565(0x1D3A), px565(0x055C), px565(0x0DDD), px565(0x04C7), px565(0x0B80), px565(0x1B40), px565(0x2320),
+  px565(0x0EB6), px565(0x0597), px565(0x0E88), px565(0x0521), px565(0x0452), px565(0x040C), px565(0x0D43), px565(0x0100), px565(0x04B9), px565(0x04DA), px565(0x04DB), px565(0x060F), px565(0x05E0), px565(0x0580), px565(0x0560), px565(0x03C0), px565(0x0340), px565(0x02E0), px565(0x02C0), px565(0x0300), px565(0x0420), px565(0x0300), px565(0x0420), px565(0x04A3), px565(0x0467), px565(0x042D), px565(0x04D4), px565(0x0634), px565(0x355A), px565(0x1D6F), px565(0x05A1), px565(0x0440), px565(0x2147), px565(0x2147), px565(0xFD46), px565(0xFD27), px565(0x2147), px565(0x2147), px565(0xC65A), px565(0x8A86), px565(0xFBE5), px565(0xFCC5), px565(0xF484), px565(0xEDC7), px565(0x4A07), px565(0x138A), px565(0x0365), px565(0x03C0), px565(0x0460), px565(0x0360),
+  px565(0x0525), px565(0x053C), px565(0x0D58), px565(0x04C0), px565(0x04A2), px565(0x0C00), px565(0x1441), px565(0x0203), px565(0x043B), px565(0x0633), px565(0x0608), px565(0x066A), px565(0x0E87), px565(0x05C0), px565(0x0520), px565(0x02C0), px565(0x02E0), px565(0x02A0), px565(0x02C0), px565(0x02C0), px565(0x0340), px565(0x0240), px565(0x0321), px565(0x03A0), px565(0x0440), px565(0x03C1), px565(0x2EF3), px565(0x0DF4), px565(0x2020), px565(0xF3E4), px565(0xFCA5), px565(0x8CA4), px565(0xCED5), px565(0xFCA6), px565(0xFE4B), px565(0xF546), px565(0xFCE7), px565(0xFC26), px565(0xF7DE), px565(0xEAE3), px565(0xFCE5), px565(0xFCC5), px565(0xF463), px565(0xFDA5), px565(0x20A2), px565(0x3CE8), px565(0x0AA4), px565(0x22E0), px565(0x0B20), px565(0x0340),
+  px565(0x04D4), px565(0x051C), px565(0x0497), px565(0x1C21), px565(0x054E), px565(0x0CEC), px565(0x0CB6), px565(0x02C3), px565(0x0457), px565(0x0458), px565(0x0D98), px565(0x05DE), px565(0x169A), px565(0x0B93), px565(0x0301), px565(0x02E0), px565(0x0280), px565(0x1D58), px565(0x361F), px565(0x055E), px565(0x0520), px565(0x04E0), px565(0x1402), px565(0x01E0), px565(0x03E0), px565(0x04C7), px565(0x04EC), px565(0x0B4C), px565(0xE446), px565(0xFBE4), px565(0xFC64), px565(0xFD05), px565(0xEDD0), px565(0x2147), px565(0xFE46), px565(0xFE26), px565(0x2147), px565(0xFC67), px565(0xF7FE), px565(0xFC44), px565(0xFCC4), px565(0xFC84), px565(0xFCE4), px565(0xFD85), px565(0x08A1), px565(0x1C86), px565(0x1A22), px565(0x1A20), px565(0x22A0), px565(0x12A0),
+  px565(0x0DBF), px565(0x04F7), px565(0x0D2F), px565(0x24E0), px565(0x0474), px565(0x0497), px565(0x0402), px565(0x151E), px565(0x055D), px565(0x2CE5), px565(0x04FA), px565(0x055D), px565(0x05B9), px565(0x03ED), px565(0x2362), px565(0x1B69), px565(0x057A), px565(0x0CBA), px565(0x0D7D), px565(0x057D), px565(0x0540), px565(0x04E0), px565(0x0400), px565(0x03A0), px565(0x0320), px565(0x03C1), px565(0x0406), px565(0x2D71), px565(0xBB03), px565(0xD341), px565(0xFC65), px565(0xFC44), px565(0xE442), px565(0xF5A7), px565(0x2147), px565(0x2147), px565(0xFDA5), px565(0xFC64), px565(0xFFDD), px565(0xFC45), px565(0xFC64), px565(0xFC44), px565(0xFC43), px565(0xF4C4), px565(0x44E9), px565(0x2262), px565(0x12A0), px565(0x0BC0), px565(0x1A80), px565(0x2200),
+  px565(0x059E), px565(0x0577), px565(0x0E44), px565(0x1460), px565(0x04EF), px565(0x0416), px565(0x0CB6), px565(0x04DC), px565(0x0DDF), px565(0x0A40), px565(0x0321), px565(0x04FC), px565(0x04FB), px565(0x0C26), px565(0x174F), px565(0x03D7), px565(0x049A), px565(0x04FA), px565(0x04BB), px565(0x0D38), px565(0x0500), px565(0x0400), px565(0x0320), px565(0x02C0), px565(0x0AA1), px565(0x0260), px565(0x0401), px565(0x03C9), px565(0x0B86), px565(0x4100), px565(0xF3E4), px565(0xFCC6), px565(0xF523), px565(0xFFBA), px565(0xFE05), px565(0xFD05), px565(0xFDA5), px565(0xFFFF), px565(0xF544), px565(0xE5A7), px565(0xF444), px565(0xE321), px565(0xFC65), px565(0x2183), px565(0x02A8), px565(0x1204), px565(0x12A1), px565(0x0460), px565(0x02C0), px565(0x0A60),
+  px565(0x0518), px565(0x0E76), px565(0x04C0), px565(0x14EE), px565(0x162D), px565(0x0495), px565(0x0100), px565(0x059C), px565(0x05FB), px565(0x0980), px565(0x02E0), px565(0x0499), px565(0x051C), px565(0x1DED), px565(0x0520), px565(0x0459), px565(0x0479), px565(0x45E8), px565(0x08E0), px565(0x00E0), px565(0x0340), px565(0x02E0), px565(0x0260), px565(0x0220), px565(0x0260), px565(0x0260), px565(0x0240), px565(0x02A0), px565(0x0300), px565(0x0340), px565(0x0D43), px565(0xDCE7), px565(0xED64), px565(0xFDA3), px565(0xCD05), px565(0xD420), px565(0xF4E2), px565(0xFD65), px565(0xB2E2), px565(0x22A1), px565(0x1AA0), px565(0x0242), px565(0x0206), px565(0x09E6), px565(0x1962), px565(0x2161), px565(0x0AC3), px565(0x0428), px565(0x0423), px565(0x2282),
+  px565(0x057E), px565(0x0D29), px565(0x04FB), px565(0x155E), px565(0x0539), px565(0x14D4), px565(0x2572), px565(0x0D3C), px565(0x04DB), px565(0x0526), px565(0x2B02), px565(0x047B), px565(0x0497), px565(0x1E17), px565(0x1D9B), px565(0x2481), px565(0x262B), px565(0x00A0), px565(0x0160), px565(0x02A1), px565(0x0220), px565(0x01E0), px565(0x09C1), px565(0x1522), px565(0x0340), px565(0x0260), px565(0x0240), px565(0x0220), px565(0x0281), px565(0x1A01), px565(0x0500), px565(0x04E0), px565(0x0380), px565(0x0BA2), px565(0x6C84), px565(0xF726), px565(0x0D83), px565(0x3B00), px565(0x1A80), px565(0x11C1), px565(0x0A20), px565(0x1201), px565(0x08E0), px565(0x3E1E), px565(0x3E1E), px565(0x15DC), px565(0x0320), px565(0x0361), px565(0x0380), px565(0x0340),
+  px565(0x05DE), px565(0x04DB), px565(0x0539), px565(0x04FC), px565(0x0598), px565(0x1B80), px565(0x0CA8), px565(0x0457), px565(0x0456), px565(0x1C00), px565(0x2221), px565(0x072E), px565(0x0D6D), px565(0x04DB), px565(0x3E3F), px565(0x36BB), px565(0x33C1), px565(0x0100), px565(0x01E1), px565(0x02A0), px565(0x0A60), px565(0x0020), px565(0x0D61), px565(0x0480), px565(0x0440), px565(0x0340), px565(0x0AC0), px565(0x00C0), px565(0x0060), px565(0x09C3), px565(0x04E1), px565(0x0502), px565(0x1B60), px565(0x1B20), px565(0x2543), px565(0x0C40), px565(0x0C40), px565(0x0C40), px565(0x6E7F), px565(0x15BE), px565(0x14B7), px565(0x0B61), px565(0x0CFD), px565(0x0D1D), px565(0x155E), px565(0x04FC), px565(0x0307), px565(0x0361), px565(0x0360), px565(0x03A0),
+  px565(0x059D), px565(0x04BB), px565(0x0DE3), px565(0x1DEE), px565(0x0AE1), px565(0x1A80), px565(0x11A0), px565(0x1D6A), px565(0x05A5), px565(0x0980), px565(0x1941), px565(0x2E97), px565(0x0D0A), px565(0x04DC), px565(0x3D9F), px565(0x057D), px565(0x1DD3), px565(0x0020), px565(0x0300), px565(0x02E0), px565(0x0340), px565(0x0CA1), px565(0x0400), px565(0x04A0), px565(0x15E2), px565(0x1642), px565(0x15C3), px565(0x0580), px565(0x0500), px565(0x04E0), px565(0x0527), px565(0x04E0), px565(0x1BA2), px565(0x2360), px565(0x0D83), px565(0x0C40), px565(0x7E7B), px565(0x2513), px565(0x053E), px565(0x0438), px565(0x0476), px565(0x02A0), px565(0x047B), px565(0x04BB), px565(0x04DB), px565(0x04BA), px565(0x05B5), px565(0x0223), px565(0x0340), px565(0x0301),
+  px565(0x057A), px565(0x0EF1), px565(0x1582), px565(0x04C1), px565(0x02E0), px565(0x0140), px565(0x00E0), px565(0x1140), px565(0x2C64), px565(0x0C71), px565(0x0479), px565(0x0CDC), px565(0x0474), px565(0x053C), px565(0x047A), px565(0x043A), px565(0x05AE), px565(0x0DEA), px565(0x0605), px565(0x05E5), px565(0x05C3), px565(0x05A0), px565(0x0580), px565(0x0500), px565(0x04E0), px565(0x04C0), px565(0x0480), px565(0x0460), px565(0x03C0), px565(0x03C0), px565(0x1E32), px565(0x04E9), px565(0x0D91), px565(0x3360), px565(0x548B), px565(0x0C9C), px565(0x03F8), px565(0x0558), px565(0x0458), px565(0x0438), px565(0x0D2D), px565(0x04C1), px565(0x02A6), px565(0x04D8), px565(0x04BA), px565(0x04DA), px565(0x05CC), px565(0x0E23), px565(0x0340), px565(0x0D41),
+  px565(0x0601), px565(0x05E0), px565(0x04A1), px565(0x02C0), px565(0x03A0), px565(0x0587), px565(0x0506), px565(0x0464), px565(0x0BAA), px565(0x03D3), px565(0x0417), px565(0x0C17), px565(0x0511), px565(0x0D5D), px565(0x0438), px565(0x0439), px565(0x05A5), px565(0x05E0), px565(0x05C0), px565(0x05C0), px565(0x0580), px565(0x0580), px565(0x0560), px565(0x3E70), px565(0x0500), px565(0x04A0), px565(0x0480), px565(0x0440), px565(0x03A0), px565(0x03A0), px565(0x15D6), px565(0x04DB), px565(0x257E), px565(0x04FC), px565(0x25B9), px565(0x0419), px565(0x0416), px565(0x1431), px565(0x04B7), px565(0x0CB5), px565(0x3D01), px565(0x1C80), px565(0x0480), px565(0x0DEF), px565(0x1658), px565(0x0601), px565(0x05E0), px565(0x05A0), px565(0x0560), px565(0x03A2),
+  px565(0x04A0), px565(0x0580), px565(0x0D81), px565(0x3C63), px565(0x154C), px565(0x03D4), px565(0x040F), px565(0x0481), px565(0x0499), px565(0x0459), px565(0x1E10), px565(0x246A), px565(0x0980), px565(0x0287), px565(0x04F8), px565(0x0556), px565(0x0627), px565(0x0480), px565(0x04A0), px565(0x0D41), px565(0x0D80), px565(0x1D02), px565(0x3E5D), px565(0x2DBE), px565(0x0CF9), px565(0x0180), px565(0x0060), px565(0x0040), px565(0x0040), px565(0x00A0), px565(0x2579), px565(0x055D), px565(0x1D9F), px565(0x04DD), px565(0x0E09), px565(0x04BA), px565(0x0436), px565(0x54A2), px565(0x43E0), px565(0x2626), px565(0x0520), px565(0x0C40), px565(0x03A0), px565(0x051B), px565(0x04DB), px565(0x0651), px565(0x0641), px565(0x0DE0), px565(0x0560), px565(0x0560),
+  px565(0x0480), px565(0x0560), px565(0x03A0), px565(0x3400), px565(0x0352), px565(0x0D9E), px565(0x04FA), px565(0x156C), px565(0x0499), px565(0x0479), px565(0x0DCF), px565(0x0120), px565(0x00E0), px565(0x0D1B), px565(0x0C19), px565(0x0571), px565(0x0540), px565(0x04E0), px565(0x0440), px565(0x0380), px565(0x0280), px565(0x0A20), px565(0x15FD), px565(0x0CDD), px565(0x04F9), px565(0x0D82), px565(0x0CA1), px565(0x0180), px565(0x0261), px565(0x02E0), px565(0x0280), px565(0x04DC), px565(0x04DC), px565(0x0478), px565(0x8EF6), px565(0x1C40), px565(0x2420), px565(0x0C01), px565(0x03A0), px565(0x0360), px565(0x16A2), px565(0x04C0), px565(0x0B82), px565(0x04FB), px565(0x04DB), px565(0x0D72), px565(0x0300), px565(0x0621), px565(0x0601), px565(0x0540),
+  px565(0x03C0), px565(0x0380), px565(0x0AE0), px565(0x14CD), px565(0x03B5), px565(0x04DB), px565(0x04D9), px565(0x0D8A), px565(0x0D38), px565(0x04F6), px565(0x0521), px565(0x02C0), px565(0x0D3D), px565(0x04FC), px565(0x043A), px565(0x0498), px565(0x0560), px565(0x0C60), px565(0x02A0), px565(0x0261), px565(0x0220), px565(0x01E0), px565(0x0A01), px565(0x152B), px565(0x05A0), px565(0x04C0), px565(0x0460), px565(0x0360), px565(0x03C0), px565(0x1565), px565(0x0500), px565(0x04C1), px565(0x05DA), px565(0x0DBF), px565(0x25BF), px565(0x055C), px565(0x1BA2), px565(0x0BA0), px565(0x0B80), px565(0x0380), px565(0x0B41), px565(0x066A), px565(0x159C), px565(0x059E), px565(0x25ED), px565(0x05AB), px565(0x0D00), px565(0x0320), px565(0x05E0), px565(0x05E1),
+  px565(0x0C41), px565(0x0300), px565(0x0260), px565(0x0220), px565(0x1462), px565(0x0518), px565(0x0D9F), px565(0x057E), px565(0x0260), px565(0x0160), px565(0x02C1), px565(0x0200), px565(0x051B), px565(0x055C), px565(0x047A), px565(0x0D34), px565(0x00A0), px565(0x08C0), px565(0x01C1), px565(0x0260), px565(0x01A0), px565(0x01A0), px565(0x0220), px565(0x0BA1), px565(0x0360), px565(0x0260), px565(0x03A0), px565(0x1EE6), px565(0x0D00), px565(0x04C0), px565(0x04C0), px565(0x04A0), px565(0x0460), px565(0x055D), px565(0x051D), px565(0x04DC), px565(0x0EAC), px565(0x0B60), px565(0x0380), px565(0x0360), px565(0x0380), px565(0x0CDC), px565(0x155F), px565(0x051D), px565(0x0578), px565(0x04C0), px565(0x0420), px565(0x1A00), px565(0x0E25), px565(0x0600),
+  px565(0x1D0F), px565(0x0340), px565(0x0220), px565(0x0200), px565(0x0980), px565(0x04BA), px565(0x055E), px565(0x055E), px565(0x0D79), px565(0x0450), px565(0x00E0), px565(0x01A0), px565(0x0120), px565(0x060A), px565(0x1421), px565(0x01A1), px565(0x0080), px565(0x0060), px565(0x0040), px565(0x0040), px565(0x0121), px565(0x0340), px565(0x0421), px565(0x1CE6), px565(0x2667), px565(0x0669), px565(0x0500), px565(0x04C0), px565(0x04A0), px565(0x04A0), px565(0x04C0), px565(0x04A0), px565(0x0C60), px565(0x2E9C), px565(0x053B), px565(0x059B), px565(0x05C3), px565(0x0520), px565(0x03E0), px565(0x0360), px565(0x0320), px565(0x0479), px565(0x049A), px565(0x049A), px565(0x0579), px565(0x0420), px565(0x04E0), px565(0x0CA0), px565(0x0B02), px565(0x0640),
+  px565(0x04FA), px565(0x0DF2), px565(0x01C0), px565(0x0160), px565(0x0223), px565(0x0479), px565(0x04BA), px565(0x0499), px565(0x0386), px565(0x43C0), px565(0x0AC0), px565(0x0102), px565(0x151D), px565(0x04D7), px565(0x1C41), px565(0x0340), px565(0x00A0), px565(0x0248), px565(0x04FD), px565(0x0CBA), px565(0x05F2), px565(0x0D84), px565(0x04C0), px565(0x04A0), px565(0x0568), px565(0x0521), px565(0x04E0), px565(0x04C0), px565(0x04C0), px565(0x04E0), px565(0x1402), px565(0x0300), px565(0x0361), px565(0x0300), px565(0x0220), px565(0x1DA2), px565(0x05A0), px565(0x0500), px565(0x03A0), px565(0x03A0), px565(0x0360), px565(0x02E2), px565(0x0D96), px565(0x0DF4), px565(0x05E8), px565(0x0400), px565(0x0480), px565(0x04A0), px565(0x0940), px565(0x01A0),
+  px565(0x04B8), px565(0x0DA5), px565(0x0200), px565(0x0100), px565(0x0468), px565(0x06F3), px565(0x0E90), px565(0x0EB1), px565(0x0A42), px565(0x0AA0), px565(0x3BE1), px565(0x01E0), px565(0x0C57), px565(0x04D4), px565(0x1BC1), px565(0x1AC0), px565(0x1220), px565(0x363E), px565(0x04DC), px565(0x0478), px565(0x0587), px565(0x0540), px565(0x04E0), px565(0x05ED), px565(0x06D1), px565(0x0D81), px565(0x04E0), px565(0x0CE1), px565(0x0020), px565(0x0080), px565(0x0020), px565(0x0061), px565(0x0060), px565(0x0180), px565(0x02E0), px565(0x0320), px565(0x05C0), px565(0x0500), px565(0x03A0), px565(0x0380), px565(0x0360), px565(0x02E0), px565(0x0CA3), px565(0x0600), px565(0x05A0), px565(0x0600), px565(0x0400), px565(0x4E9D), px565(0x45BE), px565(0x25DF),
+  px565(0x0D8F), px565(0x0560), px565(0x03C0), px565(0x0A46), px565(0x03C1), px565(0x06EA), px565(0x0601), px565(0x0684), px565(0x09E0), px565(0x1220), px565(0x0AA0), px565(0x13C5), px565(0x0DCE), px565(0x2460), px565(0x54C5), px565(0x2AE0), px565(0x11E0), px565(0x2E1D), px565(0x04FB), px565(0x0478), px565(0x0E6F), px565(0x02E0), px565(0x1DD7), px565(0x04FB), px565(0x04BA), px565(0x15A2), px565(0x0160), px565(0x0160), px565(0x00C0), px565(0x0040), px565(0x0060), px565(0x0060), px565(0x0040), px565(0x0060), px565(0x02A1), px565(0x0641), px565(0x0580), px565(0x0480), px565(0x0CE1), px565(0x03E0), px565(0x0360), px565(0x0340), px565(0x02A0), px565(0x0600), px565(0x05A0), px565(0x0C20), px565(0x13E0), px565(0x0479), px565(0x03F7), px565(0x0BD7),
+  px565(0x05C0), px565(0x0480), px565(0x0D1B), px565(0x05DE), px565(0x1E7F), px565(0x0E42), px565(0x0600), px565(0x05E0), px565(0x0DA1), px565(0x1180), px565(0x1A20), px565(0x0060), px565(0x15AB), px565(0x0D9A), px565(0x03C5), px565(0x1579), px565(0x057E), px565(0x0519), px565(0x04B9), px565(0x1CCE), px565(0x0440), px565(0x0261), px565(0x1DDE), px565(0x055E), px565(0x04DA), px565(0x00C1), px565(0x0061), px565(0x0040), px565(0x0000), px565(0x0940), px565(0x0100), px565(0x0060), px565(0x0060), px565(0x0CA0), px565(0x0484), px565(0x06E9), px565(0x05A0), px565(0x03E0), px565(0x1242), px565(0x04A0), px565(0x0380), px565(0x02E0), px565(0x02E0), px565(0x0480), px565(0x04E0), px565(0x03E0), px565(0x0D20), px565(0x044C), px565(0x0416), px565(0x0571),
+  px565(0x0260), px565(0x0D60), px565(0x0497), px565(0x0498), px565(0x0478), px565(0x0462), px565(0x0440), px565(0x0440), px565(0x6F9A), px565(0x0380), px565(0x1121), px565(0x0960), px565(0x04FA), px565(0x057C), px565(0x0D18), px565(0x0507), px565(0x04FA), px565(0x04DA), px565(0x0479), px565(0x0477), px565(0x5E07), px565(0x08E1), px565(0x1350), px565(0x2E5F), px565(0x2E19), px565(0x7E7F), px565(0x45BE), px565(0x00C0), px565(0x0120), px565(0x0120), px565(0x0100), px565(0x0120), px565(0x0580), px565(0x0440), px565(0x06CC), px565(0x06EC), px565(0x05C0), px565(0x0240), px565(0x0040), px565(0x0840), px565(0x0460), px565(0x0320), px565(0x02A0), px565(0x0A41), px565(0x04C0), px565(0x0440), px565(0x0420), px565(0x0AE1), px565(0x0441), px565(0x2CC3),
+  px565(0x0A60), px565(0x0161), px565(0x0E15), px565(0x054F), px565(0x058C), px565(0x0340), px565(0x0340), px565(0x055D), px565(0x051D), px565(0x0558), px565(0x0320), px565(0x08E0), px565(0x04B9), px565(0x04FA), px565(0x0DD3), px565(0x02C0), px565(0x04D4), px565(0x0D38), px565(0x04BA), px565(0x0456), px565(0x7606), px565(0x0061), px565(0x0840), px565(0x0120), px565(0x0D9D), px565(0x259E), px565(0x0D5D), px565(0x57D6), px565(0x01A0), px565(0x0101), px565(0x00A0), px565(0x0460), px565(0x0360), px565(0x055E), px565(0x04DB), px565(0x04F6), px565(0x2EE8), px565(0x0060), px565(0x0060), px565(0x0080), px565(0x0140), px565(0x03C0), px565(0x02C0), px565(0x0A61), px565(0x057E), px565(0x057E), px565(0x25D7), px565(0x0CE0), px565(0x0B60), px565(0x0D88)
 };
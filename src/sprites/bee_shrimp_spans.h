@@ -0,0 +1,122 @@
+#pragma once
+// Generated by convert_sprite.py --spans --indexed --trim from bee_shrimp.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+const uint16_t BEE_SHRIMP_WIDTH = 14;
+const uint16_t BEE_SHRIMP_HEIGHT = 6;
+
+// bee_shrimpBitmap: 14x6, 7 colours, 4-bit (58 B instead of 168 B)
+const uint16_t bee_shrimpBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xFFFF), px565(0xC000), px565(0x0000), px565(0xF800), px565(0xE000), px565(0xF7BE), px565(0x2147),
+};
+const uint8_t bee_shrimpBitmap_idx[] PROGMEM = {
+  0x01, 0x10, 0x00, 0x11, 0x00, 0x02, 0x11, 0x01, 0x31, 0x45, 0x16, 0x14, 0x52, 0x61, 0x11, 0x16,
+  0x44, 0x11, 0x64, 0x45, 0x10, 0x16, 0x14, 0x52, 0x61, 0x45, 0x27, 0x10, 0x07, 0x62, 0x47, 0x16,
+  0x70, 0x00, 0x70, 0x07, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00,
+};
+const IndexedSprite bee_shrimpBitmapIdx = {
+  14, 6, 4, bee_shrimpBitmap_idx, bee_shrimpBitmap_pal, 0, 0
+};
+
+// bee_shrimpBitmap: 14x6, 58/84 opaque px, 11 spans
+const uint16_t bee_shrimpBitmap_rows[] PROGMEM = {
+  0, 3, 4, 5, 6, 8, 11
+};
+const SpriteSpan bee_shrimpBitmap_spans[] PROGMEM = {
+  {1, 2, 1}, {6, 2, 6}, {11, 3, 11},
+  {1, 13, 15},
+  {0, 13, 28},
+  {0, 13, 42},
+  {1, 8, 57}, {12, 1, 68},
+  {1, 1, 71}, {6, 1, 76}, {9, 1, 79},
+};
+const SpriteSpan bee_shrimpBitmap_spansFlip[] PROGMEM = {
+  {0, 3, 11}, {6, 2, 6}, {11, 2, 1},
+  {0, 13, 15},
+  {1, 13, 28},
+  {1, 13, 42},
+  {1, 1, 68}, {5, 8, 57},
+  {4, 1, 79}, {7, 1, 76}, {12, 1, 71},
+};
+const SpriteSpanTable bee_shrimpBitmapSpans = {
+  nullptr, 14, 6, bee_shrimpBitmap_rows, bee_shrimpBitmap_spans, bee_shrimpBitmap_spansFlip, &bee_shrimpBitmapIdx,
+  0, 0, 14
+};
+
+// shrimp_move_Bitmap: 14x6, 7 colours, 4-bit (58 B instead of 168 B)
+const uint16_t shrimp_move_Bitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xFFFF), px565(0xC000), px565(0x0000), px565(0xF800), px565(0xE000), px565(0xF7BE), px565(0x2147),
+};
+const uint8_t shrimp_move_Bitmap_idx[] PROGMEM = {
+  0x01, 0x10, 0x00, 0x11, 0x00, 0x02, 0x11, 0x01, 0x31, 0x45, 0x16, 0x14, 0x52, 0x61, 0x11, 0x16,
+  0x44, 0x11, 0x64, 0x45, 0x10, 0x16, 0x14, 0x52, 0x61, 0x45, 0x27, 0x10, 0x07, 0x62, 0x47, 0x16,
+  0x70, 0x07, 0x00, 0x70, 0x00, 0x07, 0x00, 0x70, 0x00, 0x00,
+};
+const IndexedSprite shrimp_move_BitmapIdx = {
+  14, 6, 4, shrimp_move_Bitmap_idx, shrimp_move_Bitmap_pal, 0, 0
+};
+
+// shrimp_move_Bitmap: 14x6, 58/84 opaque px, 11 spans
+const uint16_t shrimp_move_Bitmap_rows[] PROGMEM = {
+  0, 3, 4, 5, 6, 8, 11
+};
+const SpriteSpan shrimp_move_Bitmap_spans[] PROGMEM = {
+  {1, 2, 1}, {6, 2, 6}, {11, 3, 11},
+  {1, 13, 15},
+  {0, 13, 28},
+  {0, 13, 42},
+  {1, 8, 57}, {11, 1, 67},
+  {0, 1, 70}, {5, 1, 75}, {8, 1, 78},
+};
+const SpriteSpan shrimp_move_Bitmap_spansFlip[] PROGMEM = {
+  {0, 3, 11}, {6, 2, 6}, {11, 2, 1},
+  {0, 13, 15},
+  {1, 13, 28},
+  {1, 13, 42},
+  {2, 1, 67}, {5, 8, 57},
+  {5, 1, 78}, {8, 1, 75}, {13, 1, 70},
+};
+const SpriteSpanTable shrimp_move_BitmapSpans = {
+  nullptr, 14, 6, shrimp_move_Bitmap_rows, shrimp_move_Bitmap_spans, shrimp_move_Bitmap_spansFlip, &shrimp_move_BitmapIdx,
+  0, 0, 14
+};
+
+// shrimp_move01_Bitmap: 14x6, 7 colours, 4-bit (58 B instead of 168 B)
+const uint16_t shrimp_move01_Bitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xFFFF), px565(0xC000), px565(0x0000), px565(0xF800), px565(0xE000), px565(0xF7BE), px565(0x2147),
+};
+const uint8_t shrimp_move01_Bitmap_idx[] PROGMEM = {
+  0x01, 0x10, 0x00, 0x11, 0x00, 0x02, 0x11, 0x01, 0x31, 0x45, 0x16, 0x14, 0x52, 0x61, 0x11, 0x16,
+  0x44, 0x11, 0x64, 0x45, 0x10, 0x16, 0x14, 0x52, 0x61, 0x45, 0x27, 0x10, 0x07, 0x62, 0x47, 0x16,
+  0x70, 0x00, 0x77, 0x07, 0x70, 0x00, 0x77, 0x07, 0x70, 0x00,
+};
+const IndexedSprite shrimp_move01_BitmapIdx = {
+  14, 6, 4, shrimp_move01_Bitmap_idx, shrimp_move01_Bitmap_pal, 0, 0
+};
+
+// shrimp_move01_Bitmap: 14x6, 62/84 opaque px, 11 spans
+const uint16_t shrimp_move01_Bitmap_rows[] PROGMEM = {
+  0, 3, 4, 5, 6, 8, 11
+};
+const SpriteSpan shrimp_move01_Bitmap_spans[] PROGMEM = {
+  {1, 2, 1}, {6, 2, 6}, {11, 3, 11},
+  {1, 13, 15},
+  {0, 13, 28},
+  {0, 13, 42},
+  {1, 8, 57}, {12, 2, 68},
+  {1, 2, 71}, {6, 2, 76}, {9, 2, 79},
+};
+const SpriteSpan shrimp_move01_Bitmap_spansFlip[] PROGMEM = {
+  {0, 3, 11}, {6, 2, 6}, {11, 2, 1},
+  {0, 13, 15},
+  {1, 13, 28},
+  {1, 13, 42},
+  {0, 2, 68}, {5, 8, 57},
+  {3, 2, 79}, {6, 2, 76}, {11, 2, 71},
+};
+const SpriteSpanTable shrimp_move01_BitmapSpans = {
+  nullptr, 14, 6, shrimp_move01_Bitmap_rows, shrimp_move01_Bitmap_spans, shrimp_move01_Bitmap_spansFlip, &shrimp_move01_BitmapIdx,
+  0, 0, 14
+};
@@ -1,53 +1,53 @@
 #include "clownfish.h"
 #include "../animator.h"
-#include "clownfish_frames.h"
+#include "clownfish_frames_spans.h"
 
 // =============================================================================
 // IDLE Animation - 1 Frame (nur idle_f0)
 // =============================================================================
-const uint16_t* const clownfish_idle_frames[] PROGMEM = {
-  clownfish_idle_f0
+const SpriteSpanTable* const clownfish_idle_frames[] PROGMEM = {
+  &clownfish_idle_f0Spans
 };
 
 // =============================================================================
 // MOVING Animation - 5 Frames (idle_f0 -> moving_f0 -> moving_f1 -> moving_f0 -> idle_f0)
 // =============================================================================
-const uint16_t* const clownfish_moving_frames[] PROGMEM = {
-  clownfish_idle_f0,      // start idle
-  clownfish_moving_f0,    // swim 1
-  clownfish_moving_f1,    // swim 2
-  clownfish_moving_f0,    // swim 1 again
-  clownfish_idle_f0       // back to idle
+const SpriteSpanTable* const clownfish_moving_frames[] PROGMEM = {
+  &clownfish_idle_f0Spans,      // start idle
+  &clownfish_moving_f0Spans,    // swim 1
+  &clownfish_moving_f1Spans,    // swim 2
+  &clownfish_moving_f0Spans,    // swim 1 again
+  &clownfish_idle_f0Spans       // back to idle
 };
 
 // =============================================================================
 // EATING Animation - 1 Frame (statischer Fisch mit offenem Mund)
 // =============================================================================
-const uint16_t* const clownfish_eating_frames[] PROGMEM = {
-  clownfish_eating_f0
+const SpriteSpanTable* const clownfish_eating_frames[] PROGMEM = {
+  &clownfish_eating_f0Spans
 };
 
 // =============================================================================
 // PLAYING Animation - 3 Frames (Bälle 2s, dann Herzen 1s)
 // =============================================================================
-const uint16_t* const clownfish_playing_frames[] PROGMEM = {
-  clownfish_playing_f1,   // fish with colorful balls (1s)
-  clownfish_playing_f1,   // fish with colorful balls (2s total)
-  clownfish_playing_f0    // fish with hearts (3s total)
+const SpriteSpanTable* const clownfish_playing_frames[] PROGMEM = {
+  &clownfish_playing_f1Spans,   // fish with colorful balls (1s)
+  &clownfish_playing_f1Spans,   // fish with colorful balls (2s total)
+  &clownfish_playing_f0Spans    // fish with hearts (3s total)
 };
 
 // =============================================================================
 // SLEEPING Animation - 1 Frame (statischer Fisch mit ZZZ)
 // =============================================================================
-const uint16_t* const clownfish_sleeping_frames[] PROGMEM = {
-  clownfish_sleeping_f0
+const SpriteSpanTable* const clownfish_sleeping_frames[] PROGMEM = {
+  &clownfish_sleeping_f0Spans
 };
 
 // =============================================================================
 // POOPING Animation - 1 Frame (statischer Fisch beim Kaka machen)
 // =============================================================================
-const uint16_t* const clownfish_pooping_frames[] PROGMEM = {
-  clownfish_poopBitmap
+const SpriteSpanTable* const clownfish_pooping_frames[] PROGMEM = {
+  &clownfish_poopBitmapSpans
 };
 
 // =============================================================================
@@ -1,17 +1,15 @@
 #pragma once
 #include <Arduino.h>
 #include "../animator.h"
+#include "../sprite_common.h"
 
 // Clownfish - 30x25
 
 const uint16_t CLOWNFISH_WIDTH  = 30;
 const uint16_t CLOWNFISH_HEIGHT = 25;
 
-// Base sprite (backward compatibility)
-extern const uint16_t clownfishBitmap[] PROGMEM;
-
-// Dead fish sprite
-extern const uint16_t nemodeadBitmap[] PROGMEM;
+// Dead fish sprite (palette-indiziert, nur als Span-Tabelle)
+extern const SpriteSpanTable nemodeadBitmapSpans;
 
 // Animation Clips für alle States
 extern const AnimationClip CLIP_IDLE;
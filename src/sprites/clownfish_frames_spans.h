@@ -0,0 +1,833 @@
+#pragma once
+// Generated by convert_sprite.py --spans --indexed --trim from clownfish_frames.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+// clownfish_idle_f0: trimmed 30x25 -> 24x13 at +3,+6
+// clownfish_idle_f0: 24x13, 75 colours, 8-bit (464 B instead of 624 B)
+const uint16_t clownfish_idle_f0_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x0000), px565(0x39C7), px565(0x0020), px565(0x1000), px565(0xFC02), px565(0xF345), px565(0xFBE1), px565(0xFE6C), px565(0xFE4A), px565(0xF714), px565(0xFFFF), px565(0xB9A0), px565(0x8C71), px565(0xE463), px565(0x0800),
+  px565(0xF402), px565(0x0840), px565(0xFC22), px565(0xDA01), px565(0xFFDF), px565(0xF64A), px565(0x31A6), px565(0xC1E3), px565(0xFE8B), px565(0xB5D7), px565(0xEFDF), px565(0xEFBF), px565(0xFC01), px565(0x2147), px565(0x2945), px565(0xF465),
+  px565(0xCA21), px565(0xFBE3), px565(0xFC21), px565(0x2924), px565(0xFE6B), px565(0x5AEB), px565(0xFC04), px565(0xB961), px565(0xB121), px565(0x0841), px565(0xFC42), px565(0xF64B), px565(0xBBC9), px565(0x1020), px565(0x2840), px565(0xFC03),
+  px565(0xE7FF), px565(0xE7BF), px565(0xEFFF), px565(0xF3A4), px565(0x1800), px565(0xDA02), px565(0xBE9C), px565(0xBA65), px565(0xD9E2), px565(0xD1E2), px565(0xBEDD), px565(0x2125), px565(0xA8C1), px565(0xE222), px565(0xD9E1), px565(0xC9E3),
+  px565(0xA63C), px565(0xD1C2), px565(0x2124), px565(0xFC43), px565(0x9E3C), px565(0x2966), px565(0xA63B), px565(0xA65B), px565(0x89C4), px565(0xAA04), px565(0x2965), px565(0xA920),
+};
+const uint8_t clownfish_idle_f0_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x08,
+  0x09, 0x0A, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x05, 0x0C, 0x01, 0x01, 0x0D, 0x05, 0x09, 0x0E, 0x0F, 0x0B, 0x0B, 0x01, 0x10, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x13, 0x01, 0x01, 0x0B, 0x01, 0x05, 0x05, 0x05,
+  0x14, 0x0B, 0x01, 0x05, 0x05, 0x05, 0x15, 0x00, 0x01, 0x16, 0x08, 0x01, 0x00, 0x00, 0x01, 0x17,
+  0x18, 0x12, 0x19, 0x1A, 0x1B, 0x05, 0x1C, 0x05, 0x1A, 0x01, 0x05, 0x1D, 0x0B, 0x05, 0x05, 0x03,
+  0x1E, 0x1F, 0x20, 0x21, 0x22, 0x01, 0x0B, 0x12, 0x12, 0x12, 0x1B, 0x1A, 0x1A, 0x0F, 0x05, 0x0F,
+  0x1A, 0x01, 0x12, 0x23, 0x01, 0x05, 0x05, 0x24, 0x25, 0x26, 0x27, 0x28, 0x1C, 0x1A, 0x1A, 0x12,
+  0x1C, 0x05, 0x1B, 0x29, 0x2A, 0x2B, 0x2C, 0x01, 0x1A, 0x04, 0x05, 0x05, 0x05, 0x05, 0x12, 0x2D,
+  0x01, 0x2E, 0x2F, 0x12, 0x05, 0x30, 0x31, 0x1C, 0x1C, 0x05, 0x32, 0x16, 0x33, 0x12, 0x12, 0x2A,
+  0x1A, 0x01, 0x05, 0x05, 0x12, 0x1D, 0x1D, 0x34, 0x01, 0x03, 0x35, 0x35, 0x35, 0x01, 0x36, 0x37,
+  0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x01, 0x40, 0x41, 0x12, 0x05, 0x05, 0x2E, 0x00,
+  0x00, 0x42, 0x35, 0x35, 0x01, 0x00, 0x01, 0x43, 0x3E, 0x01, 0x01, 0x44, 0x45, 0x01, 0x39, 0x38,
+  0x39, 0x46, 0x47, 0x48, 0x49, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x4A, 0x01, 0x01, 0x00, 0x00, 0x01, 0x34, 0x3E, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x4B, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite clownfish_idle_f0Idx = {
+  24, 13, 8, clownfish_idle_f0_idx, clownfish_idle_f0_pal, 3, 6
+};
+
+// clownfish_idle_f0: 24x13, 208/312 opaque px, 18 spans
+const uint16_t clownfish_idle_f0_rows[] PROGMEM = {
+  0, 1, 2, 4, 5, 6, 8, 9, 10, 11, 12, 14, 17, 18
+};
+const SpriteSpan clownfish_idle_f0_spans[] PROGMEM = {
+  {12, 5, 12},
+  {12, 6, 36},
+  {8, 3, 56}, {12, 8, 60},
+  {6, 16, 78},
+  {6, 17, 102},
+  {0, 4, 120}, {6, 18, 126},
+  {0, 24, 144},
+  {0, 24, 168},
+  {0, 24, 192},
+  {0, 23, 216},
+  {1, 4, 241}, {6, 16, 246},
+  {2, 1, 266}, {7, 4, 271}, {13, 6, 277},
+  {13, 5, 301},
+};
+const SpriteSpan clownfish_idle_f0_spansFlip[] PROGMEM = {
+  {7, 5, 12},
+  {6, 6, 36},
+  {4, 8, 60}, {13, 3, 56},
+  {2, 16, 78},
+  {1, 17, 102},
+  {0, 18, 126}, {20, 4, 120},
+  {0, 24, 144},
+  {0, 24, 168},
+  {0, 24, 192},
+  {1, 23, 216},
+  {2, 16, 246}, {19, 4, 241},
+  {5, 6, 277}, {13, 4, 271}, {21, 1, 266},
+  {6, 5, 301},
+};
+const SpriteSpanTable clownfish_idle_f0Spans = {
+  nullptr, 24, 13, clownfish_idle_f0_rows, clownfish_idle_f0_spans, clownfish_idle_f0_spansFlip, &clownfish_idle_f0Idx,
+  3, 6, 30
+};
+
+// clownfish_moving_f1: trimmed 30x25 -> 24x15 at +3,+5
+// clownfish_moving_f1: 24x15, 73 colours, 8-bit (508 B instead of 720 B)
+const uint16_t clownfish_moving_f1_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x2147), px565(0x0000), px565(0xD3A1), px565(0x1000), px565(0xFC02), px565(0xF345), px565(0xFBE1), px565(0xFE6C), px565(0xFE4A), px565(0xB9A0), px565(0x8C71), px565(0xE463), px565(0x0800), px565(0xFFFF), px565(0xF402),
+  px565(0x0840), px565(0x0020), px565(0xFC22), px565(0xDA01), px565(0xFFDF), px565(0xF64A), px565(0xC1E3), px565(0xFE8B), px565(0xB5D7), px565(0xEFDF), px565(0xEFBF), px565(0xFC01), px565(0x2945), px565(0xF465), px565(0xCA21), px565(0xFBE3),
+  px565(0xFC21), px565(0x2924), px565(0xFE6B), px565(0x5AEB), px565(0xFC04), px565(0xB961), px565(0xB121), px565(0x0841), px565(0xFC42), px565(0xF64B), px565(0xBBC9), px565(0x1020), px565(0xFC03), px565(0xE7FF), px565(0xE7BF), px565(0xEFFF),
+  px565(0x31A6), px565(0xF3A4), px565(0x1800), px565(0xDA02), px565(0xBE9C), px565(0xBA65), px565(0xD9E2), px565(0xD1E2), px565(0xBEDD), px565(0x2125), px565(0xA8C1), px565(0xE222), px565(0xD9E1), px565(0xC9E3), px565(0xA63C), px565(0xD1C2),
+  px565(0x2840), px565(0xFC43), px565(0x9E3C), px565(0x2966), px565(0xA63B), px565(0xA65B), px565(0x89C4), px565(0xAA04), px565(0x2965), px565(0xA920),
+};
+const uint8_t clownfish_moving_f1_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x08, 0x09, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x05, 0x0A, 0x02, 0x02, 0x0B, 0x05, 0x09, 0x0C,
+  0x0D, 0x0E, 0x0E, 0x02, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12,
+  0x13, 0x02, 0x02, 0x0E, 0x02, 0x05, 0x05, 0x05, 0x14, 0x0E, 0x02, 0x05, 0x05, 0x05, 0x15, 0x00,
+  0x02, 0x03, 0x08, 0x02, 0x00, 0x00, 0x02, 0x16, 0x17, 0x12, 0x18, 0x19, 0x1A, 0x05, 0x1B, 0x05,
+  0x19, 0x02, 0x05, 0x0E, 0x0E, 0x05, 0x05, 0x11, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x02, 0x0E, 0x12,
+  0x12, 0x12, 0x1A, 0x19, 0x19, 0x0D, 0x05, 0x0D, 0x19, 0x02, 0x12, 0x21, 0x02, 0x05, 0x05, 0x22,
+  0x23, 0x24, 0x25, 0x26, 0x1B, 0x19, 0x19, 0x12, 0x1B, 0x05, 0x1A, 0x27, 0x28, 0x29, 0x2A, 0x02,
+  0x19, 0x04, 0x05, 0x05, 0x05, 0x05, 0x12, 0x2B, 0x02, 0x03, 0x2C, 0x12, 0x05, 0x2D, 0x2E, 0x1B,
+  0x1B, 0x05, 0x2F, 0x30, 0x31, 0x12, 0x12, 0x28, 0x19, 0x02, 0x05, 0x05, 0x12, 0x01, 0x01, 0x32,
+  0x02, 0x03, 0x33, 0x33, 0x33, 0x02, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D,
+  0x02, 0x3E, 0x3F, 0x12, 0x05, 0x05, 0x40, 0x00, 0x01, 0x01, 0x33, 0x01, 0x00, 0x00, 0x02, 0x41,
+  0x3C, 0x03, 0x02, 0x42, 0x43, 0x02, 0x37, 0x36, 0x37, 0x44, 0x45, 0x46, 0x47, 0x11, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00, 0x02, 0x03, 0x3C,
+  0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x48, 0x49, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite clownfish_moving_f1Idx = {
+  24, 15, 8, clownfish_moving_f1_idx, clownfish_moving_f1_pal, 3, 5
+};
+
+// clownfish_moving_f1: 24x15, 219/360 opaque px, 24 spans
+const uint16_t clownfish_moving_f1_rows[] PROGMEM = {
+  0, 1, 2, 4, 6, 8, 10, 12, 13, 14, 15, 16, 18, 21, 23, 24
+};
+const SpriteSpan clownfish_moving_f1_spans[] PROGMEM = {
+  {12, 3, 12},
+  {12, 4, 36},
+  {8, 2, 56}, {12, 5, 60},
+  {8, 3, 80}, {12, 8, 84},
+  {0, 1, 96}, {6, 16, 102},
+  {0, 2, 120}, {6, 17, 126},
+  {0, 4, 144}, {6, 18, 150},
+  {0, 24, 168},
+  {0, 24, 192},
+  {0, 24, 216},
+  {0, 23, 240},
+  {0, 4, 264}, {6, 16, 270},
+  {0, 1, 288}, {7, 4, 295}, {13, 6, 301},
+  {8, 2, 320}, {13, 5, 325},
+  {13, 3, 349},
+};
+const SpriteSpan clownfish_moving_f1_spansFlip[] PROGMEM = {
+  {9, 3, 12},
+  {8, 4, 36},
+  {7, 5, 60}, {14, 2, 56},
+  {4, 8, 84}, {13, 3, 80},
+  {2, 16, 102}, {23, 1, 96},
+  {1, 17, 126}, {22, 2, 120},
+  {0, 18, 150}, {20, 4, 144},
+  {0, 24, 168},
+  {0, 24, 192},
+  {0, 24, 216},
+  {1, 23, 240},
+  {2, 16, 270}, {20, 4, 264},
+  {5, 6, 301}, {13, 4, 295}, {23, 1, 288},
+  {6, 5, 325}, {14, 2, 320},
+  {8, 3, 349},
+};
+const SpriteSpanTable clownfish_moving_f1Spans = {
+  nullptr, 24, 15, clownfish_moving_f1_rows, clownfish_moving_f1_spans, clownfish_moving_f1_spansFlip, &clownfish_moving_f1Idx,
+  3, 5, 30
+};
+
+// clownfish_moving_f0: trimmed 30x25 -> 28x15 at +1,+5
+// clownfish_moving_f0: 28x15, 73 colours, 8-bit (568 B instead of 840 B)
+const uint16_t clownfish_moving_f0_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x0000), px565(0xB982), px565(0xE2E3), px565(0xFC03), px565(0xDD8F), px565(0x0020), px565(0xB960), px565(0xFBE3), px565(0xB121), px565(0xFE6F), px565(0x2147), px565(0xB46C), px565(0xC639), px565(0xFBC2), px565(0xFE2F),
+  px565(0xFFFF), px565(0xE46A), px565(0xEB45), px565(0xFBA2), px565(0xFBA3), px565(0x31A6), px565(0xF424), px565(0x0800), px565(0xEC05), px565(0xFE0F), px565(0xB941), px565(0xB142), px565(0xFD29), px565(0xFC23), px565(0xF631), px565(0xFE0E),
+  px565(0xEC47), px565(0x5205), px565(0xFBE5), px565(0x4A69), px565(0xC1A3), px565(0xB160), px565(0xB962), px565(0xF3C3), px565(0xC1A1), px565(0xF3E4), px565(0xFC06), px565(0xD6BB), px565(0xF407), px565(0x18E3), px565(0xEC27), px565(0xA942),
+  px565(0xDA23), px565(0xD203), px565(0xCE5A), px565(0xDA03), px565(0xE222), px565(0xFBC3), px565(0xCE59), px565(0xD1E3), px565(0xD222), px565(0x0841), px565(0xE223), px565(0x1082), px565(0xDA43), px565(0xC659), px565(0xC67A), px565(0xCE7A),
+  px565(0xD9E3), px565(0xA225), px565(0x0861), px565(0x69A2), px565(0xC162), px565(0xA902), px565(0xD224), px565(0xEAE4), px565(0x1000), px565(0xCE79),
+};
+const uint8_t clownfish_moving_f0_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x07, 0x04, 0x08, 0x04, 0x09, 0x0A, 0x0B, 0x0B, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x0C, 0x00,
+  0x00, 0x0D, 0x01, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x01, 0x10, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x12, 0x13, 0x14, 0x06, 0x10, 0x15, 0x16,
+  0x08, 0x08, 0x08, 0x17, 0x10, 0x10, 0x06, 0x18, 0x19, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x06, 0x00, 0x00, 0x01, 0x1A, 0x1B, 0x01, 0x01, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x01,
+  0x10, 0x06, 0x08, 0x08, 0x08, 0x1C, 0x01, 0x00, 0x01, 0x01, 0x1B, 0x1D, 0x04, 0x1E, 0x01, 0x01,
+  0x01, 0x1F, 0x1F, 0x01, 0x10, 0x10, 0x10, 0x01, 0x08, 0x08, 0x20, 0x10, 0x10, 0x04, 0x01, 0x10,
+  0x01, 0x08, 0x21, 0x00, 0x00, 0x01, 0x22, 0x1D, 0x04, 0x04, 0x01, 0x10, 0x01, 0x08, 0x08, 0x01,
+  0x10, 0x10, 0x01, 0x01, 0x16, 0x08, 0x01, 0x10, 0x01, 0x08, 0x01, 0x01, 0x23, 0x08, 0x08, 0x06,
+  0x01, 0x01, 0x24, 0x25, 0x25, 0x04, 0x01, 0x10, 0x01, 0x08, 0x08, 0x01, 0x10, 0x01, 0x06, 0x26,
+  0x27, 0x06, 0x01, 0x10, 0x01, 0x08, 0x0F, 0x28, 0x08, 0x29, 0x08, 0x06, 0x01, 0x01, 0x2A, 0x2A,
+  0x04, 0x04, 0x17, 0x2B, 0x01, 0x04, 0x04, 0x01, 0x10, 0x01, 0x2C, 0x2A, 0x2A, 0x08, 0x08, 0x2D,
+  0x10, 0x04, 0x08, 0x04, 0x04, 0x08, 0x2E, 0x00, 0x00, 0x01, 0x2F, 0x30, 0x30, 0x31, 0x17, 0x32,
+  0x01, 0x33, 0x33, 0x01, 0x0D, 0x32, 0x01, 0x34, 0x1B, 0x35, 0x35, 0x01, 0x36, 0x01, 0x37, 0x38,
+  0x31, 0x33, 0x39, 0x00, 0x00, 0x06, 0x17, 0x3A, 0x33, 0x01, 0x3B, 0x01, 0x3C, 0x37, 0x01, 0x37,
+  0x3D, 0x3E, 0x3F, 0x01, 0x01, 0x33, 0x40, 0x33, 0x3F, 0x3D, 0x01, 0x41, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x01, 0x01, 0x42, 0x00, 0x00, 0x06, 0x43, 0x26, 0x44, 0x45, 0x3A, 0x01, 0x06, 0x01,
+  0x01, 0x01, 0x40, 0x46, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0x17, 0x48,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite clownfish_moving_f0Idx = {
+  28, 15, 8, clownfish_moving_f0_idx, clownfish_moving_f0_pal, 1, 5
+};
+
+// clownfish_moving_f0: 28x15, 262/420 opaque px, 20 spans
+const uint16_t clownfish_moving_f0_rows[] PROGMEM = {
+  0, 1, 2, 3, 5, 6, 8, 9, 10, 11, 12, 13, 14, 16, 18, 20
+};
+const SpriteSpan clownfish_moving_f0_spans[] PROGMEM = {
+  {17, 2, 17},
+  {15, 6, 43},
+  {13, 10, 69},
+  {8, 3, 92}, {13, 11, 97},
+  {7, 19, 119},
+  {1, 4, 141}, {7, 20, 147},
+  {0, 27, 168},
+  {1, 27, 197},
+  {0, 28, 224},
+  {0, 27, 252},
+  {1, 26, 281},
+  {1, 24, 309},
+  {1, 4, 337}, {7, 15, 343},
+  {10, 2, 374}, {16, 5, 380},
+  {17, 1, 409}, {19, 1, 411},
+};
+const SpriteSpan clownfish_moving_f0_spansFlip[] PROGMEM = {
+  {9, 2, 17},
+  {7, 6, 43},
+  {5, 10, 69},
+  {4, 11, 97}, {17, 3, 92},
+  {2, 19, 119},
+  {1, 20, 147}, {23, 4, 141},
+  {1, 27, 168},
+  {0, 27, 197},
+  {0, 28, 224},
+  {1, 27, 252},
+  {1, 26, 281},
+  {3, 24, 309},
+  {6, 15, 343}, {23, 4, 337},
+  {7, 5, 380}, {16, 2, 374},
+  {8, 1, 411}, {10, 1, 409},
+};
+const SpriteSpanTable clownfish_moving_f0Spans = {
+  nullptr, 28, 15, clownfish_moving_f0_rows, clownfish_moving_f0_spans, clownfish_moving_f0_spansFlip, &clownfish_moving_f0Idx,
+  1, 5, 30
+};
+
+// clownfish_eating_f0: trimmed 30x25 -> 28x16 at +1,+3
+// clownfish_eating_f0: 28x16, 94 colours, 8-bit (638 B instead of 896 B)
+const uint16_t clownfish_eating_f0_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xD925), px565(0x0001), px565(0xFD4E), px565(0xFD6C), px565(0xFD49), px565(0xFD4B), px565(0xFFFF), px565(0xEF7D), px565(0x0000), px565(0xB9A1), px565(0xB181), px565(0xEB24), px565(0xF321), px565(0xFB62), px565(0x0021),
+  px565(0x0800), px565(0xFD2A), px565(0xB63A), px565(0xBE59), px565(0xEB82), px565(0xFD29), px565(0xFD09), px565(0x49A4), px565(0xFDAD), px565(0xF509), px565(0xFD0B), px565(0xFB61), px565(0xDA41), px565(0xF320), px565(0xF340), px565(0xFB40),
+  px565(0xEBA4), px565(0xFB20), px565(0xFC87), px565(0x2147), px565(0xA960), px565(0xB981), px565(0xB9C0), px565(0xFD6B), px565(0x0002), px565(0xF360), px565(0xB180), px565(0xFCEB), px565(0xE2C0), px565(0xF341), px565(0xF300), px565(0xF79E),
+  px565(0xF7BE), px565(0x6B4D), px565(0xFD4A), px565(0xA920), px565(0xDD2D), px565(0xF79D), px565(0xC1C0), px565(0xFB81), px565(0xA166), px565(0x1000), px565(0xF651), px565(0xD4ED), px565(0xB160), px565(0xB980), px565(0xA5D8), px565(0x3186),
+  px565(0xFB60), px565(0xB326), px565(0xA9A7), px565(0xA308), px565(0xDD2E), px565(0xAB49), px565(0xC1A1), px565(0x2000), px565(0x6161), px565(0xB960), px565(0xADD8), px565(0x2145), px565(0x3000), px565(0xADF8), px565(0xC181), px565(0xCA00),
+  px565(0xC180), px565(0xC9A1), px565(0x89C4), px565(0xA328), px565(0xAB48), px565(0xB9C1), px565(0xC69B), px565(0xBE7A), px565(0xC160), px565(0xB203), px565(0xB619), px565(0x5B0C), px565(0x1800), px565(0xFFDF), px565(0xA1E4),
+};
+const uint8_t clownfish_eating_f0_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04,
+  0x05, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x08, 0x09, 0x02, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x11, 0x02, 0x12, 0x13, 0x14, 0x15, 0x15, 0x16, 0x17, 0x07, 0x07, 0x18, 0x19, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x07, 0x02, 0x1A, 0x1B, 0x1C, 0x02, 0x07,
+  0x07, 0x1D, 0x1E, 0x1F, 0x20, 0x07, 0x07, 0x1E, 0x1F, 0x21, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x23, 0x0F, 0x24, 0x16, 0x02, 0x00, 0x02, 0x25, 0x26, 0x27, 0x02, 0x07, 0x07, 0x28, 0x1F, 0x29,
+  0x07, 0x07, 0x02, 0x1E, 0x02, 0x02, 0x1E, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1E, 0x2A, 0x2B,
+  0x2C, 0x02, 0x07, 0x02, 0x1E, 0x1F, 0x0F, 0x07, 0x07, 0x02, 0x21, 0x1E, 0x07, 0x07, 0x2D, 0x1E,
+  0x1E, 0x1F, 0x11, 0x2E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1F, 0x1F, 0x1F, 0x0F, 0x2F, 0x02,
+  0x1F, 0x1F, 0x02, 0x30, 0x31, 0x32, 0x33, 0x34, 0x09, 0x35, 0x1E, 0x1E, 0x36, 0x37, 0x38, 0x02,
+  0x39, 0x3A, 0x3B, 0x00, 0x02, 0x1E, 0x3C, 0x3D, 0x1F, 0x02, 0x3E, 0x02, 0x1E, 0x1E, 0x0F, 0x30,
+  0x3F, 0x24, 0x3C, 0x40, 0x02, 0x30, 0x41, 0x1E, 0x1D, 0x21, 0x28, 0x42, 0x43, 0x44, 0x45, 0x09,
+  0x09, 0x02, 0x3C, 0x46, 0x46, 0x39, 0x02, 0x47, 0x48, 0x49, 0x0F, 0x4A, 0x4B, 0x4C, 0x3D, 0x46,
+  0x0A, 0x4D, 0x02, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x00, 0x53, 0x54, 0x00, 0x00, 0x02, 0x02, 0x02,
+  0x00, 0x00, 0x00, 0x0F, 0x21, 0x25, 0x55, 0x56, 0x57, 0x58, 0x46, 0x46, 0x46, 0x59, 0x5A, 0x5B,
+  0x0B, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x4F, 0x5C, 0x0F, 0x5D, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1E, 0x1F, 0x0F, 0x5E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite clownfish_eating_f0Idx = {
+  28, 16, 8, clownfish_eating_f0_idx, clownfish_eating_f0_pal, 1, 3
+};
+
+// clownfish_eating_f0: 28x16, 226/448 opaque px, 22 spans
+const uint16_t clownfish_eating_f0_rows[] PROGMEM = {
+  0, 2, 3, 4, 5, 6, 7, 8, 10, 12, 13, 14, 15, 17, 20, 21, 22
+};
+const SpriteSpan clownfish_eating_f0_spans[] PROGMEM = {
+  {21, 2, 21}, {24, 2, 24},
+  {21, 5, 49},
+  {22, 3, 78},
+  {23, 1, 107},
+  {13, 6, 125},
+  {8, 12, 148},
+  {8, 15, 176},
+  {1, 2, 197}, {5, 19, 201},
+  {0, 5, 224}, {6, 18, 230},
+  {0, 25, 252},
+  {1, 26, 281},
+  {0, 28, 308},
+  {0, 24, 336}, {25, 2, 361},
+  {1, 3, 365}, {7, 15, 371}, {25, 2, 389},
+  {14, 6, 406},
+  {14, 5, 434},
+};
+const SpriteSpan clownfish_eating_f0_spansFlip[] PROGMEM = {
+  {2, 2, 24}, {5, 2, 21},
+  {2, 5, 49},
+  {3, 3, 78},
+  {4, 1, 107},
+  {9, 6, 125},
+  {8, 12, 148},
+  {5, 15, 176},
+  {4, 19, 201}, {25, 2, 197},
+  {4, 18, 230}, {23, 5, 224},
+  {3, 25, 252},
+  {1, 26, 281},
+  {0, 28, 308},
+  {1, 2, 361}, {4, 24, 336},
+  {1, 2, 389}, {6, 15, 371}, {24, 3, 365},
+  {8, 6, 406},
+  {9, 5, 434},
+};
+const SpriteSpanTable clownfish_eating_f0Spans = {
+  nullptr, 28, 16, clownfish_eating_f0_rows, clownfish_eating_f0_spans, clownfish_eating_f0_spansFlip, &clownfish_eating_f0Idx,
+  1, 3, 30
+};
+
+// clownfish_playing_f0: trimmed 30x25 -> 28x23 at +1,+1
+// clownfish_playing_f0: 28x23, 77 colours, 8-bit (800 B instead of 1288 B)
+const uint16_t clownfish_playing_f0_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xD925), px565(0x0000), px565(0x39C7), px565(0x0020), px565(0x1000), px565(0xFC02), px565(0xF345), px565(0xFBE1), px565(0xFE6C), px565(0xFE4A), px565(0xF714), px565(0x2147), px565(0xB9A0), px565(0x8C71), px565(0xE463),
+  px565(0x0800), px565(0xFFFF), px565(0xF402), px565(0x0840), px565(0xFC22), px565(0xDA01), px565(0xF64A), px565(0x31A6), px565(0xC1E3), px565(0xFE8B), px565(0xB5D7), px565(0xEFDF), px565(0xEFBF), px565(0xFC01), px565(0xE73D), px565(0x2945),
+  px565(0xF465), px565(0xCA21), px565(0xFBE3), px565(0xFC21), px565(0x2924), px565(0xFE6B), px565(0x5AEB), px565(0xFC04), px565(0xB961), px565(0xB121), px565(0x0841), px565(0xFC42), px565(0xF64B), px565(0xBBC9), px565(0xE1E2), px565(0x1020),
+  px565(0x2840), px565(0xFC03), px565(0xE7FF), px565(0xE7BF), px565(0xEFFF), px565(0xF3A4), px565(0x1800), px565(0xDA02), px565(0xBE9C), px565(0xBA65), px565(0xD9E2), px565(0xD1E2), px565(0xBEDD), px565(0x2125), px565(0xA8C1), px565(0xE222),
+  px565(0xD9E1), px565(0xC9E3), px565(0xA63C), px565(0xD1C2), px565(0x2124), px565(0xFC43), px565(0x9E3C), px565(0x2966), px565(0xA63B), px565(0xA65B), px565(0x89C4), px565(0xAA04), px565(0x2965), px565(0xA920),
+};
+const uint8_t clownfish_playing_f0_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x04, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x08, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
+  0x02, 0x00, 0x02, 0x02, 0x02, 0x09, 0x0A, 0x0B, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x06, 0x0D, 0x02, 0x02, 0x0E, 0x06,
+  0x0A, 0x0F, 0x10, 0x11, 0x11, 0x02, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x15, 0x02, 0x02, 0x11, 0x02, 0x06, 0x06, 0x06, 0x11, 0x11,
+  0x02, 0x06, 0x06, 0x06, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x17, 0x09, 0x02, 0x00, 0x00,
+  0x02, 0x18, 0x19, 0x14, 0x1A, 0x1B, 0x1C, 0x06, 0x1D, 0x06, 0x11, 0x02, 0x06, 0x02, 0x1E, 0x06,
+  0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x02, 0x11, 0x14, 0x14, 0x14,
+  0x1C, 0x1B, 0x1B, 0x10, 0x06, 0x10, 0x11, 0x02, 0x14, 0x24, 0x02, 0x06, 0x06, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x26, 0x27, 0x28, 0x29, 0x1D, 0x1B, 0x1B, 0x14, 0x1D, 0x06, 0x1C, 0x2A, 0x2B, 0x2C,
+  0x2D, 0x02, 0x11, 0x05, 0x06, 0x2E, 0x06, 0x06, 0x14, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30,
+  0x31, 0x14, 0x06, 0x32, 0x33, 0x1D, 0x1D, 0x06, 0x34, 0x17, 0x35, 0x14, 0x14, 0x2B, 0x11, 0x02,
+  0x06, 0x06, 0x14, 0x0C, 0x0C, 0x36, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x37, 0x37, 0x37, 0x02,
+  0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x02, 0x42, 0x43, 0x14, 0x06, 0x06,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x37, 0x37, 0x02, 0x00, 0x02, 0x45, 0x40, 0x02,
+  0x02, 0x46, 0x47, 0x02, 0x3B, 0x3A, 0x3B, 0x48, 0x49, 0x4A, 0x4B, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4C, 0x02, 0x02, 0x00, 0x00, 0x02,
+  0x36, 0x40, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x4D, 0x02, 0x02, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite clownfish_playing_f0Idx = {
+  28, 23, 8, clownfish_playing_f0_idx, clownfish_playing_f0_pal, 1, 1
+};
+
+// clownfish_playing_f0: 28x23, 286/644 opaque px, 48 spans
+const uint16_t clownfish_playing_f0_rows[] PROGMEM = {
+  0, 2, 3, 6, 8, 11, 14, 16, 19, 20, 21, 23, 24, 25, 26, 27, 29, 32, 33, 37, 41, 44, 47, 48
+};
+const SpriteSpan clownfish_playing_f0_spans[] PROGMEM = {
+  {12, 2, 12}, {15, 2, 15},
+  {12, 5, 40},
+  {13, 3, 69}, {23, 2, 79}, {26, 2, 82},
+  {14, 1, 98}, {23, 5, 107},
+  {2, 2, 114}, {5, 2, 117}, {24, 3, 136},
+  {2, 5, 142}, {14, 5, 154}, {25, 1, 165},
+  {3, 3, 171}, {14, 6, 182},
+  {4, 1, 200}, {10, 3, 206}, {14, 8, 210},
+  {8, 16, 232},
+  {8, 17, 260},
+  {2, 4, 282}, {8, 18, 288},
+  {2, 24, 310},
+  {2, 24, 338},
+  {2, 24, 366},
+  {2, 23, 394},
+  {3, 4, 423}, {8, 16, 428},
+  {4, 1, 452}, {9, 4, 457}, {15, 6, 463},
+  {15, 5, 491},
+  {0, 2, 504}, {3, 2, 507}, {23, 2, 527}, {26, 2, 530},
+  {0, 5, 532}, {11, 2, 543}, {14, 2, 546}, {23, 5, 555},
+  {1, 3, 561}, {11, 5, 571}, {24, 3, 584},
+  {2, 1, 590}, {12, 3, 600}, {25, 1, 613},
+  {13, 1, 629},
+};
+const SpriteSpan clownfish_playing_f0_spansFlip[] PROGMEM = {
+  {11, 2, 15}, {14, 2, 12},
+  {11, 5, 40},
+  {0, 2, 82}, {3, 2, 79}, {12, 3, 69},
+  {0, 5, 107}, {13, 1, 98},
+  {1, 3, 136}, {21, 2, 117}, {24, 2, 114},
+  {2, 1, 165}, {9, 5, 154}, {21, 5, 142},
+  {8, 6, 182}, {22, 3, 171},
+  {6, 8, 210}, {15, 3, 206}, {23, 1, 200},
+  {4, 16, 232},
+  {3, 17, 260},
+  {2, 18, 288}, {22, 4, 282},
+  {2, 24, 310},
+  {2, 24, 338},
+  {2, 24, 366},
+  {3, 23, 394},
+  {4, 16, 428}, {21, 4, 423},
+  {7, 6, 463}, {15, 4, 457}, {23, 1, 452},
+  {8, 5, 491},
+  {0, 2, 530}, {3, 2, 527}, {23, 2, 507}, {26, 2, 504},
+  {0, 5, 555}, {12, 2, 546}, {15, 2, 543}, {23, 5, 532},
+  {1, 3, 584}, {12, 5, 571}, {24, 3, 561},
+  {2, 1, 613}, {13, 3, 600}, {25, 1, 590},
+  {14, 1, 629},
+};
+const SpriteSpanTable clownfish_playing_f0Spans = {
+  nullptr, 28, 23, clownfish_playing_f0_rows, clownfish_playing_f0_spans, clownfish_playing_f0_spansFlip, &clownfish_playing_f0Idx,
+  1, 1, 30
+};
+
+// clownfish_playing_f1: trimmed 30x25 -> 25x23 at +3,+1
+// clownfish_playing_f1: 25x23, 84 colours, 8-bit (745 B instead of 1150 B)
+const uint16_t clownfish_playing_f1_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xD925), px565(0x3693), px565(0x3C1E), px565(0xFDE4), px565(0x0000), px565(0x39C7), px565(0x0020), px565(0x1000), px565(0xFC02), px565(0xF345), px565(0xFBE1), px565(0x2147), px565(0xF7DF), px565(0xFE6C), px565(0xFE4A),
+  px565(0xF714), px565(0xFFFF), px565(0xB9A0), px565(0x8C71), px565(0xE463), px565(0x0800), px565(0xF402), px565(0x0840), px565(0xFC22), px565(0xDA01), px565(0xFFDF), px565(0xF64A), px565(0x31A6), px565(0xC1E3), px565(0xFE8B), px565(0xB5D7),
+  px565(0xEFDF), px565(0xEFBF), px565(0xFC01), px565(0xE73D), px565(0x2945), px565(0xF465), px565(0xCA21), px565(0xFBE3), px565(0xFC21), px565(0x2924), px565(0xFE6B), px565(0x5AEB), px565(0xFC04), px565(0xB961), px565(0xB121), px565(0x0841),
+  px565(0xFC42), px565(0xF64B), px565(0xBBC9), px565(0xE1E2), px565(0x1020), px565(0x2840), px565(0xFC03), px565(0xE7FF), px565(0xE7BF), px565(0xEFFF), px565(0xF3A4), px565(0x1800), px565(0xDA02), px565(0xBE9C), px565(0xBA65), px565(0xD9E2),
+  px565(0xD1E2), px565(0xBEDD), px565(0x2125), px565(0xA8C1), px565(0xE222), px565(0xD9E1), px565(0xC9E3), px565(0xA63C), px565(0xD1C2), px565(0x2124), px565(0xFC43), px565(0x9E3C), px565(0x2966), px565(0xA63B), px565(0xA65B), px565(0x89C4),
+  px565(0xAA04), px565(0x2965), px565(0xA920), px565(0xFE89), px565(0x6F36),
+};
+const uint8_t clownfish_playing_f1_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x05, 0x07, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x09, 0x0A, 0x0B, 0x09, 0x05, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0D, 0x05, 0x05, 0x05, 0x0E, 0x0F,
+  0x10, 0x11, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+  0x09, 0x12, 0x05, 0x05, 0x13, 0x09, 0x0F, 0x14, 0x15, 0x11, 0x11, 0x05, 0x16, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18, 0x19, 0x05, 0x05, 0x11, 0x05, 0x09, 0x09,
+  0x09, 0x1A, 0x11, 0x05, 0x09, 0x09, 0x09, 0x1B, 0x00, 0x00, 0x05, 0x1C, 0x0E, 0x05, 0x00, 0x00,
+  0x05, 0x1D, 0x1E, 0x18, 0x1F, 0x20, 0x21, 0x09, 0x22, 0x09, 0x20, 0x05, 0x09, 0x05, 0x23, 0x09,
+  0x09, 0x07, 0x00, 0x24, 0x25, 0x26, 0x27, 0x28, 0x05, 0x11, 0x18, 0x18, 0x18, 0x21, 0x20, 0x20,
+  0x15, 0x09, 0x15, 0x20, 0x05, 0x18, 0x29, 0x05, 0x09, 0x09, 0x2A, 0x00, 0x2B, 0x2C, 0x2D, 0x2E,
+  0x22, 0x20, 0x20, 0x18, 0x22, 0x09, 0x21, 0x2F, 0x30, 0x31, 0x32, 0x05, 0x20, 0x08, 0x09, 0x33,
+  0x09, 0x09, 0x18, 0x34, 0x00, 0x05, 0x35, 0x36, 0x18, 0x09, 0x37, 0x38, 0x22, 0x22, 0x09, 0x39,
+  0x1C, 0x3A, 0x18, 0x18, 0x30, 0x20, 0x05, 0x09, 0x09, 0x18, 0x0C, 0x0C, 0x3B, 0x00, 0x05, 0x07,
+  0x3C, 0x3C, 0x3C, 0x05, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x05, 0x47,
+  0x48, 0x18, 0x09, 0x09, 0x35, 0x00, 0x00, 0x00, 0x49, 0x3C, 0x3C, 0x05, 0x00, 0x05, 0x4A, 0x45,
+  0x05, 0x05, 0x4B, 0x4C, 0x05, 0x40, 0x3F, 0x40, 0x4D, 0x4E, 0x4F, 0x50, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0x05, 0x05, 0x00, 0x00, 0x05, 0x3B, 0x45,
+  0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x52, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x53, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x54, 0x01, 0x53, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00,
+};
+const IndexedSprite clownfish_playing_f1Idx = {
+  25, 23, 8, clownfish_playing_f1_idx, clownfish_playing_f1_pal, 3, 1
+};
+
+// clownfish_playing_f1: 25x23, 234/575 opaque px, 25 spans
+const uint16_t clownfish_playing_f1_rows[] PROGMEM = {
+  0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 17, 20, 21, 21, 22, 23, 24, 25
+};
+const SpriteSpan clownfish_playing_f1_spans[] PROGMEM = {
+  {21, 2, 21},
+  {20, 4, 45},
+  {20, 4, 70},
+  {21, 2, 96},
+  {12, 5, 137},
+  {12, 7, 162},
+  {8, 12, 183},
+  {6, 16, 206},
+  {6, 17, 231},
+  {0, 4, 250}, {6, 18, 256},
+  {0, 24, 275},
+  {0, 24, 300},
+  {0, 24, 325},
+  {0, 23, 350},
+  {1, 4, 376}, {6, 16, 381},
+  {2, 1, 402}, {7, 4, 407}, {13, 6, 413},
+  {13, 5, 438},
+  {22, 2, 497},
+  {21, 4, 521},
+  {21, 4, 546},
+  {22, 2, 572},
+};
+const SpriteSpan clownfish_playing_f1_spansFlip[] PROGMEM = {
+  {2, 2, 21},
+  {1, 4, 45},
+  {1, 4, 70},
+  {2, 2, 96},
+  {8, 5, 137},
+  {6, 7, 162},
+  {5, 12, 183},
+  {3, 16, 206},
+  {2, 17, 231},
+  {1, 18, 256}, {21, 4, 250},
+  {1, 24, 275},
+  {1, 24, 300},
+  {1, 24, 325},
+  {2, 23, 350},
+  {3, 16, 381}, {20, 4, 376},
+  {6, 6, 413}, {14, 4, 407}, {22, 1, 402},
+  {7, 5, 438},
+  {1, 2, 497},
+  {0, 4, 521},
+  {0, 4, 546},
+  {1, 2, 572},
+};
+const SpriteSpanTable clownfish_playing_f1Spans = {
+  nullptr, 25, 23, clownfish_playing_f1_rows, clownfish_playing_f1_spans, clownfish_playing_f1_spansFlip, &clownfish_playing_f1Idx,
+  3, 1, 30
+};
+
+// clownfish_sleeping_f0: trimmed 30x25 -> 27x20 at +2,+0
+// clownfish_sleeping_f0: 27x20, 75 colours, 8-bit (692 B instead of 1080 B)
+const uint16_t clownfish_sleeping_f0_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x2147), px565(0x0001), px565(0xEDCB), px565(0x0821), px565(0xF3E4), px565(0xCAA4), px565(0xC2A6), px565(0xA1A3), px565(0x0800), px565(0x0021), px565(0xC67A), px565(0xAA24), px565(0xA1C3), px565(0xF404), px565(0xF3C4),
+  px565(0xDBC6), px565(0x2925), px565(0x0000), px565(0x1020), px565(0xB204), px565(0xC264), px565(0xFC24), px565(0xB65A), px565(0xDEFC), px565(0xFFFF), px565(0xEC25), px565(0xF5C8), px565(0xFDC8), px565(0x0801), px565(0xFC84), px565(0xA9E4),
+  px565(0xF424), px565(0x0002), px565(0xE424), px565(0xF3E3), px565(0x71E3), px565(0xC2A5), px565(0xF5C7), px565(0x2800), px565(0xFFDF), px565(0xF425), px565(0xDC07), px565(0x0022), px565(0xF426), px565(0xEC47), px565(0xDBA6), px565(0xA1A4),
+  px565(0xA9C3), px565(0xA9C0), px565(0xC307), px565(0x1000), px565(0xA1C0), px565(0xF428), px565(0x2000), px565(0xD284), px565(0xCA84), px565(0xBE5A), px565(0xBE7A), px565(0xA9A3), px565(0xA9E3), px565(0xF406), px565(0xE407), px565(0xC65A),
+  px565(0xCA64), px565(0xA266), px565(0xA9C2), px565(0xB5B6), px565(0x6960), px565(0xCAA5), px565(0xCA63), px565(0x5163), px565(0x2105), px565(0x7225), px565(0xC244), px565(0xBA43),
+};
+const uint8_t clownfish_sleeping_f0_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x02, 0x03, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x06, 0x07, 0x08,
+  0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0x0A, 0x0A, 0x02, 0x00, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x05, 0x10, 0x11, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x15, 0x16, 0x17,
+  0x18, 0x19, 0x1A, 0x1B, 0x1B, 0x1C, 0x12, 0x19, 0x19, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1E, 0x0E, 0x1F, 0x0E, 0x19, 0x19, 0x19, 0x09, 0x0E, 0x20,
+  0x20, 0x19, 0x19, 0x21, 0x0E, 0x1B, 0x22, 0x00, 0x00, 0x0A, 0x23, 0x20, 0x24, 0x0A, 0x00, 0x00,
+  0x02, 0x25, 0x05, 0x26, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x20, 0x0E, 0x27, 0x19, 0x28, 0x29, 0x0E,
+  0x0E, 0x0E, 0x2A, 0x00, 0x2B, 0x20, 0x0E, 0x08, 0x2C, 0x0E, 0x12, 0x19, 0x19, 0x2D, 0x0E, 0x0E,
+  0x02, 0x19, 0x19, 0x19, 0x0E, 0x20, 0x19, 0x19, 0x02, 0x0E, 0x02, 0x01, 0x2E, 0x0E, 0x02, 0x02,
+  0x20, 0x2F, 0x30, 0x31, 0x0E, 0x02, 0x19, 0x19, 0x0A, 0x20, 0x0E, 0x02, 0x19, 0x0A, 0x02, 0x0E,
+  0x0E, 0x19, 0x19, 0x32, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x33, 0x0A, 0x0D, 0x08, 0x08, 0x34, 0x20,
+  0x02, 0x19, 0x19, 0x2B, 0x0E, 0x0E, 0x0A, 0x19, 0x30, 0x35, 0x20, 0x02, 0x2B, 0x19, 0x04, 0x0E,
+  0x0E, 0x0E, 0x29, 0x36, 0x0A, 0x2B, 0x37, 0x38, 0x2C, 0x08, 0x37, 0x0A, 0x0B, 0x39, 0x0A, 0x38,
+  0x38, 0x0A, 0x3A, 0x3B, 0x3C, 0x3D, 0x20, 0x3E, 0x3F, 0x19, 0x40, 0x29, 0x20, 0x2C, 0x41, 0x00,
+  0x0A, 0x37, 0x38, 0x42, 0x38, 0x32, 0x43, 0x2B, 0x44, 0x45, 0x37, 0x37, 0x0A, 0x3A, 0x0A, 0x30,
+  0x46, 0x47, 0x40, 0x2B, 0x3A, 0x2B, 0x37, 0x38, 0x2B, 0x00, 0x00, 0x2B, 0x0A, 0x40, 0x33, 0x0A,
+  0x00, 0x00, 0x48, 0x49, 0x0E, 0x05, 0x0E, 0x2B, 0x0A, 0x39, 0x02, 0x07, 0x40, 0x40, 0x40, 0x39,
+  0x12, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x4B, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0x05, 0x0E, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite clownfish_sleeping_f0Idx = {
+  27, 20, 8, clownfish_sleeping_f0_idx, clownfish_sleeping_f0_pal, 2, 0
+};
+
+// clownfish_sleeping_f0: 27x20, 278/540 opaque px, 31 spans
+const uint16_t clownfish_sleeping_f0_rows[] PROGMEM = {
+  0, 2, 4, 7, 10, 11, 12, 13, 14, 16, 17, 19, 21, 22, 23, 24, 25, 26, 28, 30, 31
+};
+const SpriteSpan clownfish_sleeping_f0_spans[] PROGMEM = {
+  {7, 4, 7}, {15, 4, 15},
+  {9, 1, 36}, {17, 1, 44},
+  {8, 1, 62}, {16, 1, 70}, {22, 4, 76},
+  {7, 4, 88}, {15, 4, 96}, {24, 1, 105},
+  {23, 1, 131},
+  {22, 4, 157},
+  {15, 5, 177},
+  {14, 7, 203},
+  {9, 4, 225}, {14, 9, 230},
+  {8, 16, 251},
+  {1, 2, 271}, {7, 18, 277},
+  {0, 5, 297}, {7, 19, 304},
+  {0, 27, 324},
+  {0, 27, 351},
+  {0, 27, 378},
+  {0, 26, 405},
+  {0, 25, 432},
+  {0, 5, 459}, {7, 16, 466},
+  {1, 2, 487}, {16, 4, 502},
+  {15, 4, 528},
+};
+const SpriteSpan clownfish_sleeping_f0_spansFlip[] PROGMEM = {
+  {8, 4, 15}, {16, 4, 7},
+  {9, 1, 44}, {17, 1, 36},
+  {1, 4, 76}, {10, 1, 70}, {18, 1, 62},
+  {2, 1, 105}, {8, 4, 96}, {16, 4, 88},
+  {3, 1, 131},
+  {1, 4, 157},
+  {7, 5, 177},
+  {6, 7, 203},
+  {4, 9, 230}, {14, 4, 225},
+  {3, 16, 251},
+  {2, 18, 277}, {24, 2, 271},
+  {1, 19, 304}, {22, 5, 297},
+  {0, 27, 324},
+  {0, 27, 351},
+  {0, 27, 378},
+  {1, 26, 405},
+  {2, 25, 432},
+  {4, 16, 466}, {22, 5, 459},
+  {7, 4, 502}, {24, 2, 487},
+  {8, 4, 528},
+};
+const SpriteSpanTable clownfish_sleeping_f0Spans = {
+  nullptr, 27, 20, clownfish_sleeping_f0_rows, clownfish_sleeping_f0_spans, clownfish_sleeping_f0_spansFlip, &clownfish_sleeping_f0Idx,
+  2, 0, 30
+};
+
+// clownfish_poopBitmap: trimmed 30x25 -> 29x19 at +0,+6
+// clownfish_poopBitmap: 29x19, 79 colours, 8-bit (711 B instead of 1102 B)
+const uint16_t clownfish_poopBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x0001), px565(0xEDCB), px565(0x0821), px565(0xF3E4), px565(0xCAA4), px565(0xC2A6), px565(0xA1A3), px565(0x0800), px565(0x0021), px565(0xC67A), px565(0xAA24), px565(0xA1C3), px565(0xF404), px565(0xF3C4), px565(0xDBC6),
+  px565(0x2925), px565(0x0000), px565(0x1020), px565(0xB204), px565(0xC264), px565(0xFC24), px565(0xB65A), px565(0xDEFC), px565(0xFFFF), px565(0xEC25), px565(0xF5C8), px565(0xFDC8), px565(0x0801), px565(0xFC84), px565(0xA9E4), px565(0xF424),
+  px565(0x0002), px565(0xE424), px565(0xF3E3), px565(0x71E3), px565(0xC2A5), px565(0xF5C7), px565(0x2800), px565(0xFFDF), px565(0xF425), px565(0xDC07), px565(0x0022), px565(0xF426), px565(0xEC47), px565(0x2147), px565(0xDBA6), px565(0xA1A4),
+  px565(0xA9C3), px565(0xA9C0), px565(0xC307), px565(0x1000), px565(0xA1C0), px565(0xF428), px565(0x2000), px565(0xD284), px565(0xCA84), px565(0xBE5A), px565(0xBE7A), px565(0xA9A3), px565(0xA9E3), px565(0xF406), px565(0xE407), px565(0xC65A),
+  px565(0xCA64), px565(0xA266), px565(0xA9C2), px565(0xB5B6), px565(0x6960), px565(0xCAA5), px565(0xCA63), px565(0x5163), px565(0xF4E1), px565(0x2105), px565(0x7225), px565(0xC244), px565(0xBA43), px565(0x9202), px565(0xB2A1), px565(0x79A2),
+};
+const uint8_t clownfish_poopBitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05,
+  0x06, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x01, 0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x04,
+  0x0F, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1A, 0x1B, 0x11, 0x18, 0x18, 0x11,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1D, 0x0D,
+  0x1E, 0x0D, 0x18, 0x18, 0x18, 0x08, 0x0D, 0x1F, 0x1F, 0x18, 0x18, 0x20, 0x0D, 0x1A, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x22, 0x1F, 0x23, 0x09, 0x00, 0x00, 0x01, 0x24, 0x04, 0x25, 0x1A, 0x18,
+  0x18, 0x18, 0x18, 0x1F, 0x0D, 0x26, 0x18, 0x27, 0x28, 0x0D, 0x0D, 0x0D, 0x29, 0x00, 0x00, 0x00,
+  0x2A, 0x1F, 0x0D, 0x07, 0x2B, 0x0D, 0x11, 0x18, 0x18, 0x2C, 0x0D, 0x0D, 0x01, 0x18, 0x18, 0x18,
+  0x0D, 0x1F, 0x18, 0x18, 0x01, 0x0D, 0x01, 0x2D, 0x2E, 0x0D, 0x01, 0x00, 0x00, 0x01, 0x1F, 0x2F,
+  0x30, 0x31, 0x0D, 0x01, 0x18, 0x18, 0x09, 0x1F, 0x0D, 0x01, 0x18, 0x09, 0x01, 0x0D, 0x0D, 0x18,
+  0x18, 0x32, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x33, 0x00, 0x00, 0x09, 0x0C, 0x07, 0x07, 0x34, 0x1F,
+  0x01, 0x18, 0x18, 0x2A, 0x0D, 0x0D, 0x09, 0x18, 0x30, 0x35, 0x1F, 0x01, 0x2A, 0x18, 0x03, 0x0D,
+  0x0D, 0x0D, 0x28, 0x36, 0x09, 0x00, 0x00, 0x2A, 0x37, 0x38, 0x2B, 0x07, 0x37, 0x09, 0x0A, 0x39,
+  0x09, 0x38, 0x38, 0x09, 0x3A, 0x3B, 0x3C, 0x3D, 0x1F, 0x3E, 0x3F, 0x18, 0x40, 0x28, 0x1F, 0x2B,
+  0x41, 0x00, 0x00, 0x00, 0x09, 0x37, 0x38, 0x42, 0x38, 0x32, 0x43, 0x2A, 0x44, 0x45, 0x37, 0x37,
+  0x09, 0x3A, 0x09, 0x30, 0x46, 0x47, 0x40, 0x2A, 0x3A, 0x2A, 0x37, 0x38, 0x2A, 0x00, 0x00, 0x48,
+  0x00, 0x2A, 0x09, 0x40, 0x33, 0x09, 0x00, 0x00, 0x49, 0x4A, 0x0D, 0x04, 0x0D, 0x2A, 0x09, 0x39,
+  0x01, 0x06, 0x40, 0x40, 0x40, 0x39, 0x11, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x2D,
+  0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x4C,
+  0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x00, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x0D, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x48, 0x00, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x4D, 0x4D, 0x00, 0x48, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x4E, 0x4E, 0x4E, 0x00, 0x00, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x4D,
+  0x4D, 0x4D, 0x4D, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+  0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite clownfish_poopBitmapIdx = {
+  29, 19, 8, clownfish_poopBitmap_idx, clownfish_poopBitmap_pal, 0, 6
+};
+
+// clownfish_poopBitmap: 29x19, 280/551 opaque px, 36 spans
+const uint16_t clownfish_poopBitmap_rows[] PROGMEM = {
+  0, 1, 2, 4, 5, 7, 9, 10, 11, 12, 13, 14, 17, 20, 23, 26, 30, 33, 35, 36
+};
+const SpriteSpan clownfish_poopBitmap_spans[] PROGMEM = {
+  {17, 5, 17},
+  {16, 7, 45},
+  {11, 4, 69}, {16, 9, 74},
+  {10, 16, 97},
+  {3, 2, 119}, {9, 18, 125},
+  {2, 5, 147}, {9, 19, 154},
+  {2, 27, 176},
+  {2, 27, 205},
+  {2, 27, 234},
+  {2, 26, 263},
+  {2, 25, 292},
+  {0, 1, 319}, {2, 5, 321}, {9, 16, 328},
+  {0, 1, 348}, {3, 2, 351}, {18, 4, 366},
+  {1, 2, 378}, {5, 1, 382}, {17, 4, 394},
+  {2, 1, 408}, {5, 1, 411}, {8, 1, 414},
+  {0, 1, 435}, {3, 2, 438}, {6, 1, 441}, {8, 1, 443},
+  {0, 1, 464}, {2, 3, 466}, {7, 2, 471},
+  {1, 5, 494}, {7, 1, 500},
+  {0, 7, 522},
+};
+const SpriteSpan clownfish_poopBitmap_spansFlip[] PROGMEM = {
+  {7, 5, 17},
+  {6, 7, 45},
+  {4, 9, 74}, {14, 4, 69},
+  {3, 16, 97},
+  {2, 18, 125}, {24, 2, 119},
+  {1, 19, 154}, {22, 5, 147},
+  {0, 27, 176},
+  {0, 27, 205},
+  {0, 27, 234},
+  {1, 26, 263},
+  {2, 25, 292},
+  {4, 16, 328}, {22, 5, 321}, {28, 1, 319},
+  {7, 4, 366}, {24, 2, 351}, {28, 1, 348},
+  {8, 4, 394}, {23, 1, 382}, {26, 2, 378},
+  {20, 1, 414}, {23, 1, 411}, {26, 1, 408},
+  {20, 1, 443}, {22, 1, 441}, {24, 2, 438}, {28, 1, 435},
+  {20, 2, 471}, {24, 3, 466}, {28, 1, 464},
+  {21, 1, 500}, {23, 5, 494},
+  {22, 7, 522},
+};
+const SpriteSpanTable clownfish_poopBitmapSpans = {
+  nullptr, 29, 19, clownfish_poopBitmap_rows, clownfish_poopBitmap_spans, clownfish_poopBitmap_spansFlip, &clownfish_poopBitmapIdx,
+  0, 6, 30
+};
+
+// nemodeadBitmap: trimmed 30x25 -> 24x13 at +3,+6
+// nemodeadBitmap: 24x13, 75 colours, 8-bit (464 B instead of 624 B)
+const uint16_t nemodeadBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x2965), px565(0xA920), px565(0x0000), px565(0x1800), px565(0xD9E1), px565(0x2124), px565(0xDA02), px565(0xFC43), px565(0x9E3C), px565(0x2966), px565(0xD1E2), px565(0xD9E2), px565(0xA63B), px565(0xA65B), px565(0x89C4),
+  px565(0xAA04), px565(0x0020), px565(0xBE9C), px565(0xBA65), px565(0xBEDD), px565(0x2125), px565(0xA8C1), px565(0xE222), px565(0xC9E3), px565(0xA63C), px565(0xD1C2), px565(0xFC22), px565(0xFC02), px565(0x2840), px565(0xFC03), px565(0xE7FF),
+  px565(0xE7BF), px565(0xFC01), px565(0xEFFF), px565(0x31A6), px565(0xF3A4), px565(0xFC42), px565(0xEFDF), px565(0x2147), px565(0x5AEB), px565(0xFC04), px565(0xB961), px565(0xB121), px565(0xEFBF), px565(0x0841), px565(0xF64B), px565(0xBBC9),
+  px565(0x1000), px565(0x1020), px565(0x2945), px565(0xF465), px565(0xCA21), px565(0xFBE3), px565(0xFC21), px565(0xFFFF), px565(0x0800), px565(0x2924), px565(0xFE6B), px565(0xFE6C), px565(0xC1E3), px565(0xFE8B), px565(0xB5D7), px565(0xDA01),
+  px565(0xFFDF), px565(0xF64A), px565(0xB9A0), px565(0x8C71), px565(0xFE4A), px565(0xE463), px565(0xF402), px565(0x0840), px565(0xF714), px565(0xF345), px565(0xFBE1), px565(0x39C7),
+};
+const uint8_t nemodeadBitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x01, 0x03, 0x03, 0x00, 0x00, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x07, 0x07, 0x03, 0x00, 0x03, 0x08, 0x05, 0x03, 0x03, 0x09, 0x0A, 0x03, 0x0B, 0x0C,
+  0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x00, 0x03, 0x11, 0x07, 0x07, 0x07, 0x03, 0x12, 0x13,
+  0x0C, 0x0B, 0x14, 0x15, 0x16, 0x17, 0x05, 0x18, 0x03, 0x19, 0x1A, 0x1B, 0x1C, 0x1C, 0x1D, 0x00,
+  0x03, 0x1D, 0x1E, 0x1B, 0x1C, 0x1F, 0x20, 0x21, 0x21, 0x1C, 0x22, 0x23, 0x24, 0x1B, 0x1B, 0x25,
+  0x26, 0x03, 0x1C, 0x1C, 0x1B, 0x27, 0x27, 0x04, 0x28, 0x29, 0x2A, 0x2B, 0x21, 0x26, 0x26, 0x1B,
+  0x21, 0x1C, 0x2C, 0x2D, 0x25, 0x2E, 0x2F, 0x03, 0x26, 0x30, 0x1C, 0x1C, 0x1C, 0x1C, 0x1B, 0x31,
+  0x32, 0x33, 0x34, 0x35, 0x36, 0x03, 0x37, 0x1B, 0x1B, 0x1B, 0x2C, 0x26, 0x26, 0x38, 0x1C, 0x38,
+  0x26, 0x03, 0x1B, 0x39, 0x03, 0x1C, 0x1C, 0x3A, 0x03, 0x23, 0x3B, 0x03, 0x00, 0x00, 0x03, 0x3C,
+  0x3D, 0x1B, 0x3E, 0x26, 0x2C, 0x1C, 0x21, 0x1C, 0x26, 0x03, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1B, 0x3F, 0x03, 0x03, 0x37, 0x03, 0x1C, 0x1C, 0x1C,
+  0x40, 0x37, 0x03, 0x1C, 0x1C, 0x1C, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+  0x1C, 0x42, 0x03, 0x03, 0x43, 0x1C, 0x44, 0x45, 0x38, 0x37, 0x37, 0x03, 0x46, 0x47, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x3B,
+  0x44, 0x48, 0x37, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x1C, 0x49, 0x4A, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x4B, 0x03, 0x11,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite nemodeadBitmapIdx = {
+  24, 13, 8, nemodeadBitmap_idx, nemodeadBitmap_pal, 3, 6
+};
+
+// nemodeadBitmap: 24x13, 208/312 opaque px, 18 spans
+const uint16_t nemodeadBitmap_rows[] PROGMEM = {
+  0, 1, 4, 6, 7, 8, 9, 10, 12, 13, 14, 16, 17, 18
+};
+const SpriteSpan nemodeadBitmap_spans[] PROGMEM = {
+  {13, 5, 13},
+  {2, 1, 26}, {7, 4, 31}, {13, 6, 37},
+  {1, 4, 49}, {6, 16, 54},
+  {0, 23, 72},
+  {0, 24, 96},
+  {0, 24, 120},
+  {0, 24, 144},
+  {0, 4, 168}, {6, 18, 174},
+  {6, 17, 198},
+  {6, 16, 222},
+  {8, 3, 248}, {12, 8, 252},
+  {12, 6, 276},
+  {12, 5, 300},
+};
+const SpriteSpan nemodeadBitmap_spansFlip[] PROGMEM = {
+  {6, 5, 13},
+  {5, 6, 37}, {13, 4, 31}, {21, 1, 26},
+  {2, 16, 54}, {19, 4, 49},
+  {1, 23, 72},
+  {0, 24, 96},
+  {0, 24, 120},
+  {0, 24, 144},
+  {0, 18, 174}, {20, 4, 168},
+  {1, 17, 198},
+  {2, 16, 222},
+  {4, 8, 252}, {13, 3, 248},
+  {6, 6, 276},
+  {7, 5, 300},
+};
+const SpriteSpanTable nemodeadBitmapSpans = {
+  nullptr, 24, 13, nemodeadBitmap_rows, nemodeadBitmap_spans, nemodeadBitmap_spansFlip, &nemodeadBitmapIdx,
+  3, 6, 30
+};
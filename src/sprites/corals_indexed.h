@@ -0,0 +1,161 @@
+#pragma once
+// Generated by convert_sprite.py --indexed --trim from corals.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+const uint16_t BRAIN_CORAL_WIDTH = 16;
+const uint16_t BRAIN_CORAL_HEIGHT = 16;
+const uint16_t FAN_CORAL_WIDTH = 16;
+const uint16_t FAN_CORAL_HEIGHT = 16;
+const uint16_t STAGHORN_CORAL_WIDTH = 16;
+const uint16_t STAGHORN_CORAL_HEIGHT = 16;
+const uint16_t EXTRA_CORAL_WIDTH = 16;
+const uint16_t EXTRA_CORAL_HEIGHT = 16;
+const uint16_t TUBE_CORAL_WIDTH = 16;
+const uint16_t TUBE_CORAL_HEIGHT = 16;
+const uint16_t SEAWEED_WIDTH = 24;
+const uint16_t SEAWEED_HEIGHT = 32;
+
+// brain_coralBitmap: 16x16, 8 colours, 4-bit (146 B instead of 512 B)
+const uint16_t brain_coralBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x80C8), px565(0xB8CB), px565(0xEA53), px565(0xF55A), px565(0xFE7C), px565(0xFE89), px565(0xFDE4), px565(0xF4E1),
+};
+const uint8_t brain_coralBitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x34, 0x43, 0x21, 0x00, 0x00, 0x00,
+  0x01, 0x23, 0x45, 0x44, 0x32, 0x10, 0x00, 0x00, 0x02, 0x34, 0x11, 0x54, 0x43, 0x21, 0x00, 0x00,
+  0x13, 0x41, 0x23, 0x15, 0x44, 0x32, 0x10, 0x00, 0x24, 0x12, 0x44, 0x31, 0x54, 0x43, 0x21, 0x00,
+  0x24, 0x13, 0x54, 0x43, 0x15, 0x44, 0x32, 0x10, 0x13, 0x41, 0x15, 0x44, 0x31, 0x44, 0x43, 0x21,
+  0x02, 0x43, 0x11, 0x54, 0x43, 0x14, 0x43, 0x20, 0x01, 0x34, 0x31, 0x15, 0x44, 0x31, 0x32, 0x10,
+  0x00, 0x12, 0x44, 0x31, 0x54, 0x43, 0x21, 0x00, 0x00, 0x01, 0x24, 0x43, 0x14, 0x32, 0x10, 0x00,
+  0x00, 0x00, 0x12, 0x34, 0x43, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x66, 0x66, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x77, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x78, 0x87, 0x60, 0x00, 0x00,
+};
+const IndexedSprite brain_coralBitmapIdx = {
+  16, 16, 4, brain_coralBitmap_idx, brain_coralBitmap_pal, 0, 0
+};
+
+// fan_coralBitmap: trimmed 16x16 -> 13x16 at +0,+0
+// fan_coralBitmap: 13x16, 5 colours, 4-bit (116 B instead of 416 B)
+const uint16_t fan_coralBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x58F0), px565(0x79DD), px565(0xA45E), px565(0xC5BF), px565(0xDEBF),
+};
+const uint8_t fan_coralBitmap_idx[] PROGMEM = {
+  0x00, 0x12, 0x34, 0x43, 0x21, 0x00, 0x00, 0x12, 0x34, 0x55, 0x43, 0x21, 0x00, 0x12, 0x34, 0x55,
+  0x55, 0x43, 0x21, 0x02, 0x34, 0x51, 0x11, 0x55, 0x43, 0x21, 0x12, 0x34, 0x13, 0x31, 0x54, 0x32,
+  0x10, 0x12, 0x34, 0x11, 0x55, 0x43, 0x21, 0x00, 0x12, 0x34, 0x55, 0x43, 0x21, 0x00, 0x00, 0x12,
+  0x34, 0x43, 0x21, 0x00, 0x00, 0x00, 0x12, 0x33, 0x21, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+};
+const IndexedSprite fan_coralBitmapIdx = {
+  13, 16, 4, fan_coralBitmap_idx, fan_coralBitmap_pal, 0, 0
+};
+
+// staghorn_coralBitmap: trimmed 16x16 -> 15x16 at +0,+0
+// staghorn_coralBitmap: 15x16, 3 colours, 4-bit (128 B instead of 480 B)
+const uint16_t staghorn_coralBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x0AE9), px565(0x15D0), px565(0x3693),
+};
+const uint8_t staghorn_coralBitmap_idx[] PROGMEM = {
+  0x01, 0x22, 0x10, 0x01, 0x22, 0x10, 0x00, 0x00, 0x23, 0x32, 0x00, 0x23, 0x32, 0x00, 0x00, 0x01,
+  0x22, 0x10, 0x01, 0x22, 0x10, 0x00, 0x00, 0x01, 0x23, 0x21, 0x23, 0x21, 0x00, 0x00, 0x00, 0x01,
+  0x23, 0x33, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x21, 0x00, 0x00, 0x00, 0x12, 0x10, 0x01,
+  0x21, 0x00, 0x12, 0x10, 0x02, 0x32, 0x10, 0x23, 0x20, 0x12, 0x32, 0x10, 0x12, 0x22, 0x11, 0x21,
+  0x12, 0x22, 0x22, 0x10, 0x12, 0x32, 0x23, 0x32, 0x23, 0x33, 0x21, 0x00, 0x12, 0x33, 0x33, 0x33,
+  0x33, 0x21, 0x00, 0x00, 0x12, 0x33, 0x33, 0x33, 0x21, 0x00, 0x00, 0x00, 0x12, 0x33, 0x33, 0x21,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x33, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+};
+const IndexedSprite staghorn_coralBitmapIdx = {
+  15, 16, 4, staghorn_coralBitmap_idx, staghorn_coralBitmap_pal, 0, 0
+};
+
+// coral_extra1: trimmed 24x20 -> 23x17 at +1,+0
+// coral_extra1: 23x17, 182 colours, 8-bit (757 B instead of 782 B)
+const uint16_t coral_extra1_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x5827), px565(0xEC94), px565(0x994A), px565(0xD2CE), px565(0xEC31), px565(0xFCD5), px565(0xEB70), px565(0xE3F2), px565(0xDB50), px565(0xFE39), px565(0x810A), px565(0x8109), px565(0xFDD8), px565(0x6046), px565(0x998A),
+  px565(0xA9CD), px565(0xDB2F), px565(0xE3F1), px565(0xFCD4), px565(0x994B), px565(0xEBD2), px565(0x996A), px565(0xA16B), px565(0xED96), px565(0x5066), px565(0xFD77), px565(0xFDF9), px565(0xB20D), px565(0xFE7A), px565(0x8969), px565(0xCCF6),
+  px565(0xCAD0), px565(0xDB90), px565(0xF492), px565(0xA14B), px565(0xD2CF), px565(0xCACE), px565(0xBA4D), px565(0xA9AB), px565(0xBA0C), px565(0xD2AF), px565(0xAA4D), px565(0xFEFE), px565(0xC24E), px565(0xFC53), px565(0xEB50), px565(0xF432),
+  px565(0xE32F), px565(0xEC33), px565(0xE432), px565(0xCA8D), px565(0xA9EC), px565(0xDAEF), px565(0xEB91), px565(0xC28D), px565(0xE351), px565(0xA98B), px565(0x916B), px565(0xFEFD), px565(0xE34F), px565(0xF3D1), px565(0xF412), px565(0xE330),
+  px565(0xFC54), px565(0xA1AC), px565(0xC2CE), px565(0x4805), px565(0xDB31), px565(0xD2AE), px565(0xFC32), px565(0xE310), px565(0xDB51), px565(0xC26F), px565(0x8909), px565(0x4045), px565(0xECB4), px565(0xF576), px565(0x70CA), px565(0xDB72),
+  px565(0xBA6E), px565(0x914B), px565(0x9129), px565(0x992A), px565(0x912A), px565(0xBA6F), px565(0xE391), px565(0xF433), px565(0xF454), px565(0xFC94), px565(0x7ACD), px565(0xE371), px565(0xCBB1), px565(0xE61A), px565(0xBA0D), px565(0xEBF2),
+  px565(0xDB30), px565(0x88C9), px565(0xC2AF), px565(0xC26E), px565(0xCA6E), px565(0xA9CC), px565(0xA14C), px565(0x996B), px565(0x5007), px565(0xF413), px565(0xA1CD), px565(0xD2F1), px565(0xD2F0), px565(0xDB11), px565(0xA1ED), px565(0xDB91),
+  px565(0xBA2D), px565(0xEBD1), px565(0xFCB4), px565(0x916C), px565(0xA16C), px565(0xB1AD), px565(0x914C), px565(0xE392), px565(0x892A), px565(0x910A), px565(0x916A), px565(0x3044), px565(0xDB52), px565(0xCA8F), px565(0x3805), px565(0xF475),
+  px565(0x2044), px565(0xF414), px565(0x898C), px565(0xBA2F), px565(0xEBB1), px565(0xB1ED), px565(0x918B), px565(0xA9EE), px565(0x910B), px565(0x996C), px565(0x6869), px565(0xB20E), px565(0xB9EE), px565(0x99AD), px565(0x998C), px565(0x68A7),
+  px565(0xBA2E), px565(0xA18C), px565(0xD26F), px565(0xA9ED), px565(0xCAF1), px565(0xFF5E), px565(0x916D), px565(0xA1AD), px565(0x918C), px565(0xEB93), px565(0x78C9), px565(0xC290), px565(0xFF1D), px565(0x998D), px565(0xBA4F), px565(0x99CD),
+  px565(0x58A7), px565(0x892B), px565(0x912B), px565(0x9553), px565(0x532C), px565(0x3064), px565(0x40A6), px565(0x9DB5), px565(0x1125), px565(0x4B0C), px565(0x534D), px565(0x6C0F), px565(0x536D), px565(0x8CF3), px565(0x4B4C), px565(0x5B8E),
+  px565(0x2186), px565(0x0A67), px565(0x4AAC), px565(0x6B90), px565(0x03CB), px565(0x15D0), px565(0x2147),
+};
+const uint8_t coral_extra1_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x06, 0x07, 0x08,
+  0x09, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0D, 0x0E, 0x00, 0x00, 0x0F, 0x10,
+  0x11, 0x12, 0x13, 0x00, 0x14, 0x07, 0x15, 0x16, 0x17, 0x18, 0x19, 0x00, 0x00, 0x00, 0x00, 0x1A,
+  0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x00, 0x20, 0x21, 0x22, 0x23, 0x24, 0x00, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2A, 0x00, 0x00, 0x00, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x00, 0x33, 0x34,
+  0x35, 0x36, 0x00, 0x37, 0x36, 0x38, 0x39, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x11, 0x3C, 0x3D,
+  0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00, 0x47, 0x48, 0x49, 0x4A, 0x00, 0x4B,
+  0x4C, 0x4D, 0x4E, 0x00, 0x4F, 0x50, 0x29, 0x51, 0x52, 0x53, 0x54, 0x55, 0x00, 0x03, 0x15, 0x56,
+  0x00, 0x57, 0x58, 0x59, 0x5A, 0x00, 0x41, 0x25, 0x5B, 0x5C, 0x00, 0x5D, 0x50, 0x5E, 0x5F, 0x60,
+  0x2C, 0x61, 0x62, 0x00, 0x63, 0x24, 0x00, 0x24, 0x64, 0x58, 0x65, 0x00, 0x0E, 0x5E, 0x39, 0x66,
+  0x67, 0x00, 0x00, 0x00, 0x68, 0x24, 0x49, 0x14, 0x69, 0x6A, 0x00, 0x49, 0x69, 0x00, 0x6B, 0x6C,
+  0x6D, 0x6E, 0x00, 0x6F, 0x70, 0x6C, 0x71, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x75,
+  0x76, 0x00, 0x41, 0x77, 0x00, 0x78, 0x79, 0x7A, 0x00, 0x7B, 0x7C, 0x70, 0x41, 0x14, 0x7D, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x79, 0x7F, 0x80, 0x00, 0x81, 0x00, 0x69, 0x78, 0x82, 0x00,
+  0x83, 0x84, 0x17, 0x85, 0x70, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x88, 0x89,
+  0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x1C, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x89, 0x97, 0x8B, 0x67, 0x8E, 0x98, 0x65, 0x97, 0x99, 0x9A,
+  0x9B, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x85, 0x67,
+  0x9E, 0x97, 0x9F, 0xA0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xA1, 0xA2, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xA4, 0xA5, 0x8E, 0xA6,
+  0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xB1, 0xB2, 0xB3, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0xB6, 0xB6,
+  0xB2, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite coral_extra1Idx = {
+  23, 17, 8, coral_extra1_idx, coral_extra1_pal, 1, 0
+};
+
+// tube_coralBitmap: trimmed 16x16 -> 11x16 at +1,+0
+// tube_coralBitmap: 11x16, 5 colours, 4-bit (100 B instead of 352 B)
+const uint16_t tube_coralBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xE2C1), px565(0xFC87), px565(0xFF31), px565(0xC201), px565(0x9202),
+};
+const uint8_t tube_coralBitmap_idx[] PROGMEM = {
+  0x01, 0x22, 0x10, 0x12, 0x21, 0x01, 0x23, 0x32, 0x12, 0x33, 0x21, 0x12, 0x33, 0x21, 0x23, 0x32,
+  0x11, 0x22, 0x21, 0x01, 0x22, 0x10, 0x41, 0x21, 0x40, 0x41, 0x21, 0x44, 0x12, 0x14, 0x04, 0x12,
+  0x14, 0x41, 0x21, 0x40, 0x41, 0x21, 0x44, 0x12, 0x14, 0x04, 0x12, 0x14, 0x41, 0x21, 0x40, 0x41,
+  0x21, 0x44, 0x12, 0x14, 0x04, 0x12, 0x14, 0x41, 0x21, 0x40, 0x41, 0x21, 0x45, 0x41, 0x45, 0x05,
+  0x41, 0x45, 0x54, 0x14, 0x50, 0x54, 0x14, 0x55, 0x41, 0x45, 0x05, 0x41, 0x45, 0x54, 0x45, 0x00,
+  0x54, 0x45, 0x00, 0x55, 0x00, 0x00, 0x55, 0x00,
+};
+const IndexedSprite tube_coralBitmapIdx = {
+  11, 16, 4, tube_coralBitmap_idx, tube_coralBitmap_pal, 1, 0
+};
+
+// seaweedBitmap: trimmed 24x32 -> 13x32 at +0,+0
+// seaweedBitmap: 13x32, 10 colours, 4-bit (230 B instead of 832 B)
+const uint16_t seaweedBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x0CAD), px565(0x15D0), px565(0x3693), px565(0x03CB), px565(0x6F36), px565(0xFF98), px565(0xFE89), px565(0xE73D), px565(0xFEB5), px565(0xF79E),
+};
+const uint8_t seaweedBitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x10,
+  0x00, 0x00, 0x01, 0x12, 0x10, 0x01, 0x00, 0x00, 0x00, 0x11, 0x21, 0x03, 0x10, 0x00, 0x00, 0x01,
+  0x22, 0x10, 0x31, 0x00, 0x00, 0x00, 0x12, 0x01, 0x43, 0x10, 0x00, 0x00, 0x01, 0x22, 0x14, 0x31,
+  0x00, 0x00, 0x50, 0x10, 0x20, 0x43, 0x10, 0x00, 0x05, 0x11, 0x22, 0x04, 0x31, 0x00, 0x00, 0x51,
+  0x02, 0x10, 0x43, 0x10, 0x00, 0x35, 0x11, 0x21, 0x04, 0x31, 0x00, 0x03, 0x50, 0x12, 0x14, 0x43,
+  0x10, 0x00, 0x35, 0x01, 0x21, 0x40, 0x31, 0x00, 0x03, 0x51, 0x12, 0x04, 0x03, 0x10, 0x00, 0x35,
+  0x10, 0x20, 0x44, 0x01, 0x00, 0x03, 0x51, 0x02, 0x00, 0x40, 0x11, 0x00, 0x35, 0x10, 0x20, 0x44,
+  0x33, 0x10, 0x03, 0x51, 0x02, 0x04, 0x03, 0x01, 0x00, 0x35, 0x11, 0x22, 0x40, 0x33, 0x10, 0x03,
+  0x50, 0x10, 0x24, 0x40, 0x31, 0x00, 0x35, 0x01, 0x02, 0x04, 0x03, 0x10, 0x03, 0x53, 0x10, 0x22,
+  0x40, 0x31, 0x00, 0x30, 0x31, 0x10, 0x24, 0x03, 0x10, 0x03, 0x03, 0x01, 0x02, 0x40, 0x31, 0x00,
+  0x30, 0x30, 0x10, 0x24, 0x03, 0x10, 0x03, 0x03, 0x01, 0x02, 0x40, 0x31, 0x00, 0x30, 0x30, 0x10,
+  0x24, 0x03, 0x10, 0x63, 0x73, 0x31, 0x82, 0x47, 0x31, 0x66, 0x67, 0x69, 0x96, 0x77, 0xAA, 0x66,
+};
+const IndexedSprite seaweedBitmapIdx = {
+  13, 32, 4, seaweedBitmap_idx, seaweedBitmap_pal, 0, 0
+};
@@ -0,0 +1,60 @@
+#pragma once
+// Generated by convert_sprite.py --indexed --trim from kelp.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+const uint16_t KELP_WIDTH = 16;
+const uint16_t KELP_HEIGHT = 32;
+
+// kelpBitmap: trimmed 16x32 -> 6x30 at +5,+1
+// kelpBitmap: 6x30, 99 colours, 8-bit (380 B instead of 360 B)
+const uint16_t kelpBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xFFFF), px565(0x9E8A), px565(0xF7BE), px565(0xA6EA), px565(0x4249), px565(0x7545), px565(0x0905), px565(0x6D05), px565(0xFFDF), px565(0x0082), px565(0x7D47), px565(0x53C7), px565(0xEF7D), px565(0x4269), px565(0x5385),
+  px565(0x7505), px565(0x08E3), px565(0x64A3), px565(0x3AE5), px565(0x3B24), px565(0x64C5), px565(0x4324), px565(0x6CA5), px565(0x32A3), px565(0x9EA8), px565(0x9688), px565(0x8C72), px565(0x08E4), px565(0x00E3), px565(0x5CA2), px565(0x11E2),
+  px565(0x8E47), px565(0x8DE8), px565(0x64A5), px565(0x85C5), px565(0x6465), px565(0x5C45), px565(0x31E8), px565(0x6CE5), px565(0x00C2), px565(0x08E2), px565(0x4364), px565(0xB5F8), px565(0x6485), px565(0x0904), px565(0xA6E9), px565(0x1185),
+  px565(0x9686), px565(0x9E87), px565(0x8E26), px565(0xA555), px565(0x0104), px565(0x4B65), px565(0x9EA9), px565(0x3B46), px565(0x00C3), px565(0x4325), px565(0x3AE4), px565(0x9668), px565(0x32E5), px565(0x6D25), px565(0x42E4), px565(0x5C0A),
+  px565(0x8605), px565(0x21E4), px565(0x6445), px565(0x2A45), px565(0x32E4), px565(0x4B45), px565(0x2A24), px565(0x0925), px565(0x0124), px565(0x1984), px565(0x7565), px565(0x1125), px565(0x2AC0), px565(0x2205), px565(0x8E06), px565(0x19C4),
+  px565(0x0142), px565(0x32C6), px565(0x53C5), px565(0x5C83), px565(0x9E88), px565(0x19A3), px565(0x6486), px565(0x64C3), px565(0x5405), px565(0x08C3), px565(0x5C06), px565(0x8E07), px565(0x00A3), px565(0x42E5), px565(0x1985), px565(0x53A3),
+  px565(0x644B), px565(0x3AC5), px565(0x4305), px565(0x2A43),
+};
+const uint8_t kelpBitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x05, 0x06, 0x03,
+  0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x0E,
+  0x0F, 0x10, 0x11, 0x00, 0x00, 0x12, 0x13, 0x14, 0x15, 0x00, 0x11, 0x16, 0x17, 0x18, 0x19, 0x00,
+  0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x00, 0x00, 0x21, 0x01, 0x22, 0x23, 0x11, 0x24, 0x25,
+  0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x00, 0x2E, 0x2F, 0x01, 0x30, 0x00, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x1C, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x17, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40,
+  0x15, 0x41, 0x42, 0x3A, 0x43, 0x00, 0x44, 0x45, 0x24, 0x46, 0x47, 0x2D, 0x00, 0x48, 0x49, 0x4A,
+  0x4B, 0x3A, 0x00, 0x4C, 0x41, 0x08, 0x4D, 0x00, 0x00, 0x4E, 0x4F, 0x49, 0x17, 0x00, 0x50, 0x51,
+  0x52, 0x1C, 0x53, 0x00, 0x54, 0x00, 0x55, 0x07, 0x56, 0x00, 0x57, 0x00, 0x2D, 0x58, 0x39, 0x00,
+  0x59, 0x2D, 0x5A, 0x5B, 0x5C, 0x00, 0x00, 0x5D, 0x5E, 0x5F, 0x01, 0x00, 0x00, 0x60, 0x61, 0x58,
+  0x62, 0x00, 0x00, 0x00, 0x2D, 0x41, 0x24, 0x00, 0x00, 0x00, 0x63, 0x62, 0x00, 0x00, 0x00, 0x00,
+  0x56, 0x4B, 0x00, 0x00,
+};
+const IndexedSprite kelpBitmapIdx = {
+  6, 30, 8, kelpBitmap_idx, kelpBitmap_pal, 5, 1
+};
+
+// kelp2Bitmap: trimmed 16x32 -> 12x32 at +2,+0
+// kelp2Bitmap: 12x32, 8 colours, 4-bit (210 B instead of 768 B)
+const uint16_t kelp2Bitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x03CB), px565(0x15D0), px565(0x3693), px565(0x6F36), px565(0xA799), px565(0xCFDC), px565(0x0CAD), px565(0x0A67),
+};
+const uint8_t kelp2Bitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x12, 0x32, 0x10, 0x00, 0x00, 0x01, 0x23, 0x43, 0x21, 0x00, 0x00, 0x12, 0x34, 0x54,
+  0x32, 0x10, 0x01, 0x23, 0x45, 0x65, 0x43, 0x20, 0x02, 0x34, 0x56, 0x65, 0x43, 0x21, 0x00, 0x23,
+  0x45, 0x54, 0x32, 0x10, 0x00, 0x12, 0x34, 0x43, 0x21, 0x00, 0x00, 0x01, 0x23, 0x32, 0x10, 0x00,
+  0x01, 0x23, 0x45, 0x54, 0x32, 0x00, 0x12, 0x34, 0x56, 0x65, 0x43, 0x20, 0x23, 0x45, 0x66, 0x54,
+  0x32, 0x10, 0x12, 0x34, 0x55, 0x43, 0x21, 0x00, 0x02, 0x34, 0x44, 0x32, 0x10, 0x00, 0x00, 0x12,
+  0x33, 0x21, 0x00, 0x00, 0x01, 0x23, 0x44, 0x32, 0x10, 0x00, 0x12, 0x34, 0x55, 0x43, 0x20, 0x00,
+  0x23, 0x45, 0x54, 0x32, 0x10, 0x00, 0x12, 0x34, 0x43, 0x21, 0x00, 0x00, 0x01, 0x23, 0x32, 0x10,
+  0x00, 0x00, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x71, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+};
+const IndexedSprite kelp2BitmapIdx = {
+  12, 32, 4, kelp2Bitmap_idx, kelp2Bitmap_pal, 2, 0
+};
@@ -0,0 +1,58 @@
+#pragma once
+// Generated by convert_sprite.py --spans --indexed --trim from medium_bubble.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+const uint16_t MEDIUM_BUBBLE_WIDTH = 16;
+const uint16_t MEDIUM_BUBBLE_HEIGHT = 16;
+
+// medium_bubbleBitmap: trimmed 16x16 -> 10x11 at +2,+2
+// medium_bubbleBitmap: 10x11, 7 colours, 4-bit (71 B instead of 220 B)
+const uint16_t medium_bubbleBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x3C1E), px565(0x653E), px565(0xDF9F), px565(0x963F), px565(0xF79E), px565(0xDF5F), px565(0xFFFF),
+};
+const uint8_t medium_bubbleBitmap_idx[] PROGMEM = {
+  0x00, 0x12, 0x22, 0x21, 0x00, 0x01, 0x33, 0x34, 0x42, 0x10, 0x13, 0x55, 0x66, 0x64, 0x21, 0x23,
+  0x57, 0x66, 0x66, 0x42, 0x23, 0x66, 0x66, 0x66, 0x42, 0x24, 0x66, 0x66, 0x66, 0x42, 0x24, 0x66,
+  0x66, 0x66, 0x42, 0x24, 0x66, 0x66, 0x66, 0x42, 0x12, 0x44, 0x44, 0x44, 0x21, 0x01, 0x22, 0x22,
+  0x22, 0x10, 0x00, 0x11, 0x11, 0x11, 0x00,
+};
+const IndexedSprite medium_bubbleBitmapIdx = {
+  10, 11, 4, medium_bubbleBitmap_idx, medium_bubbleBitmap_pal, 2, 2
+};
+
+// medium_bubbleBitmap: 10x11, 98/110 opaque px, 11 spans
+const uint16_t medium_bubbleBitmap_rows[] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11
+};
+const SpriteSpan medium_bubbleBitmap_spans[] PROGMEM = {
+  {2, 6, 2},
+  {1, 8, 11},
+  {0, 10, 20},
+  {0, 10, 30},
+  {0, 10, 40},
+  {0, 10, 50},
+  {0, 10, 60},
+  {0, 10, 70},
+  {0, 10, 80},
+  {1, 8, 91},
+  {2, 6, 102},
+};
+const SpriteSpan medium_bubbleBitmap_spansFlip[] PROGMEM = {
+  {2, 6, 2},
+  {1, 8, 11},
+  {0, 10, 20},
+  {0, 10, 30},
+  {0, 10, 40},
+  {0, 10, 50},
+  {0, 10, 60},
+  {0, 10, 70},
+  {0, 10, 80},
+  {1, 8, 91},
+  {2, 6, 102},
+};
+const SpriteSpanTable medium_bubbleBitmapSpans = {
+  nullptr, 10, 11, medium_bubbleBitmap_rows, medium_bubbleBitmap_spans, medium_bubbleBitmap_spansFlip, &medium_bubbleBitmapIdx,
+  2, 2, 16
+};
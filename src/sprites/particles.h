@@ -1,5 +1,6 @@
 #pragma once
 #include <Arduino.h>
+#include "../sprite_common.h"
 
 
 const uint16_t PARTICLE_DIRT_WIDTH = 8;
@@ -8,13 +9,13 @@ const uint16_t PARTICLE_DIRT_HEIGHT = 8;
 
 // Dirt/Algae
 const uint16_t particle_dirt[] PROGMEM = {
-  0xF4E1, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F,
-  0xF4E1, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF81F, 0xF4E1,
-  0xF81F, 0xF4E1, 0xF4E1, 0xF81F, 0xF81F, 0xF4E1, 0xF81F, 0xF4E1,
-  0xF81F, 0xF81F, 0xF4E1, 0xF81F, 0xF81F, 0xF4E1, 0xF81F, 0xF81F,
-  0xF4E1, 0xF81F, 0xF81F, 0x9202, 0x9202, 0xF81F, 0xF4E1, 0xF81F,
-  0xF4E1, 0xF81F, 0xB2A1, 0xB2A1, 0xB2A1, 0xF81F, 0xF81F, 0xF4E1,
-  0xF81F, 0x9202, 0x9202, 0x9202, 0x9202, 0x9202, 0xF81F, 0xF4E1,
-  0x79A2, 0x79A2, 0x79A2, 0x79A2, 0x79A2, 0x79A2, 0x79A2, 0xF81F
+  px565(0xF4E1), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF81F),
+  px565(0xF4E1), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF81F), px565(0xF4E1),
+  px565(0xF81F), px565(0xF4E1), px565(0xF4E1), px565(0xF81F), px565(0xF81F), px565(0xF4E1), px565(0xF81F), px565(0xF4E1),
+  px565(0xF81F), px565(0xF81F), px565(0xF4E1), px565(0xF81F), px565(0xF81F), px565(0xF4E1), px565(0xF81F), px565(0xF81F),
+  px565(0xF4E1), px565(0xF81F), px565(0xF81F), px565(0x9202), px565(0x9202), px565(0xF81F), px565(0xF4E1), px565(0xF81F),
+  px565(0xF4E1), px565(0xF81F), px565(0xB2A1), px565(0xB2A1), px565(0xB2A1), px565(0xF81F), px565(0xF81F), px565(0xF4E1),
+  px565(0xF81F), px565(0x9202), px565(0x9202), px565(0x9202), px565(0x9202), px565(0x9202), px565(0xF81F), px565(0xF4E1),
+  px565(0x79A2), px565(0x79A2), px565(0x79A2), px565(0x79A2), px565(0x79A2), px565(0x79A2), px565(0x79A2), px565(0xF81F)
 };
 
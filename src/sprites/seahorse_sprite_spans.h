@@ -0,0 +1,143 @@
+#pragma once
+// Generated by convert_sprite.py --spans --indexed --trim from seahorse_sprite.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+const uint16_t SEAHORSE_WIDTH = 16;
+const uint16_t SEAHORSE_HEIGHT = 16;
+const uint16_t SEAHORSE2_WIDTH = 16;
+const uint16_t SEAHORSE2_HEIGHT = 16;
+
+// seahorseBitmap: trimmed 16x16 -> 9x16 at +3,+0
+// seahorseBitmap: 9x16, 46 colours, 8-bit (238 B instead of 288 B)
+const uint16_t seahorseBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x0044), px565(0x073F), px565(0x04D9), px565(0x03F7), px565(0x071E), px565(0x073E), px565(0x0045), px565(0x053A), px565(0x04DA), px565(0x5FDF), px565(0x03B6), px565(0x979E), px565(0x0025), px565(0x569D), px565(0x051A),
+  px565(0x055A), px565(0x0F1E), px565(0x2B93), px565(0x05BB), px565(0x0DDC), px565(0x0396), px565(0x6517), px565(0x2147), px565(0x879F), px565(0x167B), px565(0xFFFC), px565(0x0046), px565(0x14F7), px565(0x0F3E), px565(0xB73D), px565(0x2988),
+  px565(0x6598), px565(0x0458), px565(0x8598), px565(0x04F9), px565(0x0395), px565(0xDF1B), px565(0x95F9), px565(0x54F7), px565(0x8578), px565(0x0EFD), px565(0x03D7), px565(0x04B8), px565(0x04FA), px565(0x016B), px565(0x0354),
+};
+const uint8_t seahorseBitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x05, 0x06, 0x0A, 0x00, 0x00, 0x0B, 0x0C, 0x05, 0x05,
+  0x05, 0x0D, 0x05, 0x00, 0x00, 0x03, 0x0E, 0x0F, 0x10, 0x06, 0x07, 0x11, 0x00, 0x00, 0x0D, 0x07,
+  0x0B, 0x12, 0x05, 0x05, 0x13, 0x05, 0x00, 0x00, 0x0B, 0x14, 0x15, 0x16, 0x0D, 0x00, 0x17, 0x00,
+  0x18, 0x07, 0x05, 0x19, 0x1A, 0x00, 0x00, 0x00, 0x1B, 0x1C, 0x1D, 0x05, 0x02, 0x1E, 0x1A, 0x00,
+  0x00, 0x1F, 0x20, 0x0B, 0x0B, 0x21, 0x22, 0x22, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x23, 0x24, 0x25,
+  0x26, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x03, 0x27, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x28,
+  0x0D, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0D, 0x2B, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0x2C, 0x00, 0x2D, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x23, 0x2E, 0x00, 0x00, 0x00,
+};
+const IndexedSprite seahorseBitmapIdx = {
+  9, 16, 8, seahorseBitmap_idx, seahorseBitmap_pal, 3, 0
+};
+
+// seahorseBitmap: 9x16, 85/144 opaque px, 19 spans
+const uint16_t seahorseBitmap_rows[] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 16, 18, 19
+};
+const SpriteSpan seahorseBitmap_spans[] PROGMEM = {
+  {4, 3, 4},
+  {3, 4, 12},
+  {2, 6, 20},
+  {1, 7, 28},
+  {1, 7, 37},
+  {1, 8, 46},
+  {2, 5, 56}, {8, 1, 62},
+  {1, 5, 64},
+  {0, 7, 72},
+  {0, 7, 81},
+  {1, 6, 91},
+  {2, 4, 101},
+  {2, 4, 110},
+  {2, 3, 119}, {6, 1, 123},
+  {2, 2, 128}, {5, 2, 131},
+  {3, 3, 138},
+};
+const SpriteSpan seahorseBitmap_spansFlip[] PROGMEM = {
+  {2, 3, 4},
+  {2, 4, 12},
+  {1, 6, 20},
+  {1, 7, 28},
+  {1, 7, 37},
+  {0, 8, 46},
+  {0, 1, 62}, {2, 5, 56},
+  {3, 5, 64},
+  {2, 7, 72},
+  {2, 7, 81},
+  {2, 6, 91},
+  {3, 4, 101},
+  {3, 4, 110},
+  {2, 1, 123}, {4, 3, 119},
+  {2, 2, 131}, {5, 2, 128},
+  {3, 3, 138},
+};
+const SpriteSpanTable seahorseBitmapSpans = {
+  nullptr, 9, 16, seahorseBitmap_rows, seahorseBitmap_spans, seahorseBitmap_spansFlip, &seahorseBitmapIdx,
+  3, 0, 16
+};
+
+// seahorse2Bitmap: trimmed 16x16 -> 9x16 at +4,+0
+// seahorse2Bitmap: 9x16, 17 colours, 8-bit (180 B instead of 288 B)
+const uint16_t seahorse2Bitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0xB2A1), px565(0xE73D), px565(0x0044), px565(0x0045), px565(0x2147), px565(0xFF98), px565(0xFE89), px565(0x0025), px565(0x0CAD), px565(0xFFFC), px565(0x0046), px565(0xD3A1), px565(0x2988), px565(0xDF1B), px565(0xFDCE),
+  px565(0x79A2), px565(0xFC87),
+};
+const uint8_t seahorse2Bitmap_idx[] PROGMEM = {
+  0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00, 0x02, 0x05, 0x02, 0x02,
+  0x02, 0x06, 0x02, 0x00, 0x00, 0x02, 0x05, 0x02, 0x01, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x02,
+  0x02, 0x07, 0x07, 0x04, 0x08, 0x00, 0x09, 0x00, 0x09, 0x07, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0x07, 0x06, 0x04, 0x06, 0x00, 0x00, 0x00, 0x0A, 0x07, 0x06, 0x06, 0x06, 0x01,
+  0x0B, 0x00, 0x00, 0x0C, 0x0C, 0x06, 0x01, 0x01, 0x07, 0x0D, 0x00, 0x00, 0x0C, 0x0E, 0x01, 0x0F,
+  0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0x0F, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x06, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x09, 0x00, 0x00, 0x00,
+};
+const IndexedSprite seahorse2BitmapIdx = {
+  9, 16, 8, seahorse2Bitmap_idx, seahorse2Bitmap_pal, 4, 0
+};
+
+// seahorse2Bitmap: 9x16, 85/144 opaque px, 19 spans
+const uint16_t seahorse2Bitmap_rows[] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 16, 18, 19
+};
+const SpriteSpan seahorse2Bitmap_spans[] PROGMEM = {
+  {2, 3, 2},
+  {2, 4, 11},
+  {1, 6, 19},
+  {1, 7, 28},
+  {1, 7, 37},
+  {0, 8, 45},
+  {0, 1, 54}, {2, 5, 56},
+  {3, 5, 66},
+  {2, 7, 74},
+  {2, 7, 83},
+  {2, 6, 92},
+  {3, 4, 102},
+  {3, 4, 111},
+  {2, 1, 119}, {4, 3, 121},
+  {2, 2, 128}, {5, 2, 131},
+  {3, 3, 138},
+};
+const SpriteSpan seahorse2Bitmap_spansFlip[] PROGMEM = {
+  {4, 3, 2},
+  {3, 4, 11},
+  {2, 6, 19},
+  {1, 7, 28},
+  {1, 7, 37},
+  {1, 8, 45},
+  {2, 5, 56}, {8, 1, 54},
+  {1, 5, 66},
+  {0, 7, 74},
+  {0, 7, 83},
+  {1, 6, 92},
+  {2, 4, 102},
+  {2, 4, 111},
+  {2, 3, 121}, {6, 1, 119},
+  {2, 2, 131}, {5, 2, 128},
+  {3, 3, 138},
+};
+const SpriteSpanTable seahorse2BitmapSpans = {
+  nullptr, 9, 16, seahorse2Bitmap_rows, seahorse2Bitmap_spans, seahorse2Bitmap_spansFlip, &seahorse2BitmapIdx,
+  4, 0, 16
+};
@@ -0,0 +1,45 @@
+#pragma once
+// Generated by convert_sprite.py --spans --indexed --trim from small_bubble.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+const uint16_t SMALL_BUBBLE_WIDTH = 6;
+const uint16_t SMALL_BUBBLE_HEIGHT = 6;
+
+// small_bubbleBitmap: 6x6, 6 colours, 4-bit (32 B instead of 72 B)
+const uint16_t small_bubbleBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x3C1E), px565(0x653E), px565(0xF79E), px565(0xDF5F), px565(0x963F), px565(0xFFFF),
+};
+const uint8_t small_bubbleBitmap_idx[] PROGMEM = {
+  0x01, 0x22, 0x10, 0x13, 0x34, 0x51, 0x23, 0x64, 0x42, 0x24, 0x44, 0x42, 0x15, 0x44, 0x51, 0x01,
+  0x22, 0x10,
+};
+const IndexedSprite small_bubbleBitmapIdx = {
+  6, 6, 4, small_bubbleBitmap_idx, small_bubbleBitmap_pal, 0, 0
+};
+
+// small_bubbleBitmap: 6x6, 32/36 opaque px, 6 spans
+const uint16_t small_bubbleBitmap_rows[] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 6
+};
+const SpriteSpan small_bubbleBitmap_spans[] PROGMEM = {
+  {1, 4, 1},
+  {0, 6, 6},
+  {0, 6, 12},
+  {0, 6, 18},
+  {0, 6, 24},
+  {1, 4, 31},
+};
+const SpriteSpan small_bubbleBitmap_spansFlip[] PROGMEM = {
+  {1, 4, 1},
+  {0, 6, 6},
+  {0, 6, 12},
+  {0, 6, 18},
+  {0, 6, 24},
+  {1, 4, 31},
+};
+const SpriteSpanTable small_bubbleBitmapSpans = {
+  nullptr, 6, 6, small_bubbleBitmap_rows, small_bubbleBitmap_spans, small_bubbleBitmap_spansFlip, &small_bubbleBitmapIdx,
+  0, 0, 6
+};
@@ -0,0 +1,45 @@
+#pragma once
+// Generated by convert_sprite.py --indexed --trim from stone.h
+// (the source header is only converter input, include this one instead)
+#include <Arduino.h>
+#include "../sprite_common.h"
+
+const uint16_t STONE_WIDTH = 8;
+const uint16_t STONE_HEIGHT = 8;
+
+// stoneBitmap: 8x8, 3 colours, 4-bit (40 B instead of 128 B)
+const uint16_t stoneBitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x4AAC), px565(0x9D15), px565(0xE73D),
+};
+const uint8_t stoneBitmap_idx[] PROGMEM = {
+  0x00, 0x12, 0x21, 0x00, 0x01, 0x23, 0x32, 0x10, 0x12, 0x33, 0x33, 0x21, 0x12, 0x33, 0x33, 0x21,
+  0x12, 0x33, 0x33, 0x21, 0x12, 0x33, 0x33, 0x21, 0x01, 0x22, 0x22, 0x10, 0x00, 0x11, 0x11, 0x00,
+};
+const IndexedSprite stoneBitmapIdx = {
+  8, 8, 4, stoneBitmap_idx, stoneBitmap_pal, 0, 0
+};
+
+// stone2Bitmap: 8x8, 3 colours, 4-bit (40 B instead of 128 B)
+const uint16_t stone2Bitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x4AAC), px565(0x9D15), px565(0xE73D),
+};
+const uint8_t stone2Bitmap_idx[] PROGMEM = {
+  0x00, 0x11, 0x10, 0x00, 0x01, 0x22, 0x10, 0x00, 0x12, 0x32, 0x10, 0x00, 0x12, 0x33, 0x21, 0x00,
+  0x12, 0x33, 0x32, 0x11, 0x12, 0x33, 0x33, 0x21, 0x01, 0x22, 0x22, 0x10, 0x00, 0x11, 0x11, 0x00,
+};
+const IndexedSprite stone2BitmapIdx = {
+  8, 8, 4, stone2Bitmap_idx, stone2Bitmap_pal, 0, 0
+};
+
+// stone3Bitmap: trimmed 8x8 -> 7x8 at +1,+0
+// stone3Bitmap: 7x8, 3 colours, 4-bit (36 B instead of 112 B)
+const uint16_t stone3Bitmap_pal[] PROGMEM = {
+  px565(0xF81F), px565(0x4AAC), px565(0x9D15), px565(0xE73D),
+};
+const uint8_t stone3Bitmap_idx[] PROGMEM = {
+  0x01, 0x11, 0x10, 0x01, 0x22, 0x22, 0x10, 0x12, 0x33, 0x32, 0x11, 0x23, 0x33, 0x21, 0x01, 0x23,
+  0x32, 0x10, 0x01, 0x23, 0x21, 0x00, 0x12, 0x21, 0x00, 0x01, 0x11, 0x00,
+};
+const IndexedSprite stone3BitmapIdx = {
+  7, 8, 4, stone3Bitmap_idx, stone3Bitmap_pal, 1, 0
+};
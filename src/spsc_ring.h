@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// ---- Lock-freier Ringpuffer (ein Schreiber, ein Leser) ----
+// Der Schreiber (ISR oder anderer Task) hängt mit push() an, der Leser holt
+// mit pop() in derselben Reihenfolge ab. head gehört dem Schreiber, tail dem
+// Leser; jeder liest den Index des anderen nur, keiner wartet. Ist der Ring
+// voll, schlägt push() fehl und der Eintrag geht verloren (Aufrufer zählt).
+// N muss eine Zweierpotenz <= 128 sein, die Indizes laufen über uint8_t.
+
+template <typename T, uint8_t N>
+class SpscRing {
+  static_assert(N >= 2 && N <= 128 && (N & (N - 1)) == 0, "N: Zweierpotenz 2..128");
+
+public:
+  // Schreiber: false = Ring voll
+  bool push(const T& item) {
+    uint8_t h = head.load(std::memory_order_relaxed);
+    if ((uint8_t)(h - tail.load(std::memory_order_acquire)) == N) return false;
+    items[h & (N - 1)] = item;
+    head.store((uint8_t)(h + 1), std::memory_order_release);
+    return true;
+  }
+
+  // Leser: false = Ring leer
+  bool pop(T& item) {
+    uint8_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;
+    item = items[t & (N - 1)];
+    tail.store((uint8_t)(t + 1), std::memory_order_release);
+    return true;
+  }
+
+private:
+  T items[N] = {};
+  std::atomic<uint8_t> head{0};   // nächster Schreibplatz (nur Schreiber ändert)
+  std::atomic<uint8_t> tail{0};   // nächster Leseplatz (nur Leser ändert)
+};
@@ -2,132 +2,136 @@
 #include "gfx.h"
 #include "config.h"
 #include "eeprom_store.h"
-#include "buttons.h"
-
-StartChoice runStartMenu(bool hasSaveAvailable) {
-  uint8_t selected = 0;
-  uint8_t lastDrawn = 255; // Force initial draw
-  const uint8_t NUM_OPTIONS = 3;
-  
-  // Draw initial screen once
-  tft.fillScreen(0x0010);
+#include "Buttons.h"
+
+static const uint8_t NUM_OPTIONS = 3;
+static const char* const options[NUM_OPTIONS] = {"Start New", "Load", "Reset"};
+static const int16_t OPTIONS_Y = 90;
+static const int16_t OPTIONS_SPACING = 25;
+static const uint16_t MENU_BG = 0x0010;
+static const uint32_t CLEARED_MS = 1000;   // "Save cleared!" so lange zeigen
+
+// Gewünschter Zustand
+static uint8_t selected = 0;
+static bool saveAvailable = false;
+static uint32_t clearedSinceMs = 0;
+static bool showingCleared = false;
+
+// Was auf dem Display steht (255 = Zeile neu zeichnen)
+static uint8_t drawnLook[NUM_OPTIONS];
+static bool titleDrawn = false;
+
+static void drawTitle() {
+  tft.fillScreen(MENU_BG);
   tft.setTextColor(0xFFFF);
   tft.setTextSize(3);
   tft.setCursor((TFT_WIDTH - 18 * 10) / 2, 20);
   tft.print("OzeanLive");
-  
+
   tft.setTextSize(2);
   tft.setCursor((TFT_WIDTH - 11 * 12) / 2, 50);
   tft.print("Tamagotchi");
-  
-  while (true) {
-    // Only redraw menu options if selection changed
-    if (selected != lastDrawn) {
-      const char* options[NUM_OPTIONS] = {"Start New", "Load", "Reset"};
-      int16_t startY = 90;
-      int16_t spacing = 25;
-      
-      // Clear menu area only
-      tft.fillRect(70, startY - 5, TFT_WIDTH - 140, NUM_OPTIONS * spacing + 10, 0x0010);
-      
-      tft.setTextSize(2);
-      for (uint8_t i = 0; i < NUM_OPTIONS; i++) {
-        int16_t y = startY + i * spacing;
-        
-        if (i == 1 && !hasSaveAvailable) {
-          tft.setTextColor(0x7BEF); // Grayed out
-        } else if (i == selected) {
-          tft.setTextColor(0xFFE0); // Highlighted
-        } else {
-          tft.setTextColor(0xFFFF); // Normal
-        }
-        
-        tft.setCursor(80, y);
-        if (i == selected) {
-          tft.print("> ");
-        } else {
-          tft.print("  ");
-        }
-        tft.print(options[i]);
-      }
-      
-      lastDrawn = selected;
-    }
-    
-    delay(50); // Reduced from 100ms for better responsiveness
-    
-    Buttons.poll();
-    bool btnLeftPressed = false;
-    bool btnOkPressed = false;
-    bool btnRightPressed = false;
-    Buttons.getAndClearPressed(btnLeftPressed, btnOkPressed, btnRightPressed);
-    
-    if (btnLeftPressed) {
+
+  for (uint8_t i = 0; i < NUM_OPTIONS; i++) drawnLook[i] = 255;
+  titleDrawn = true;
+}
+
+// Darstellung einer Zeile: Bit 0 ausgewählt ("> "), Bit 1 ausgegraut
+static uint8_t optionLook(uint8_t i) {
+  return (i == selected ? 1 : 0) | (i == 1 && !saveAvailable ? 2 : 0);
+}
+
+static void drawOption(uint8_t i, uint8_t look) {
+  int16_t y = OPTIONS_Y + i * OPTIONS_SPACING;
+  tft.fillRect(70, y - 4, TFT_WIDTH - 140, OPTIONS_SPACING - 2, MENU_BG);
+
+  tft.setTextSize(2);
+  if (look & 2) {
+    tft.setTextColor(0x7BEF); // Grayed out
+  } else if (look & 1) {
+    tft.setTextColor(0xFFE0); // Highlighted
+  } else {
+    tft.setTextColor(0xFFFF); // Normal
+  }
+  tft.setCursor(80, y);
+  tft.print((look & 1) ? "> " : "  ");
+  tft.print(options[i]);
+  drawnLook[i] = look;
+}
+
+void startMenuOpen(bool hasSaveAvailable) {
+  selected = 0;
+  saveAvailable = hasSaveAvailable;
+  showingCleared = false;
+  titleDrawn = false;
+}
+
+StartChoice startMenuUpdate() {
+  SpiCallerScope spiScope(SPI_CALLER_UI);
+
+  if (showingCleared) {
+    if (millis() - clearedSinceMs < CLEARED_MS) return START_PENDING;
+    showingCleared = false;
+    titleDrawn = false;   // Titel nach der Meldung wieder aufbauen
+  }
+  if (!titleDrawn) drawTitle();
+
+  bool btnLeftPressed = false;
+  bool btnOkPressed = false;
+  bool btnRightPressed = false;
+  Buttons.getAndClearPressed(btnLeftPressed, btnOkPressed, btnRightPressed);
+
+  if (btnLeftPressed) {
 #ifdef DEBUG_BUTTONS
-      Serial.println("[START] LEFT - Navigate menu");
+    Serial.println("[START] LEFT - Navigate menu");
 #endif
-      if (selected == 0) {
-        selected = NUM_OPTIONS - 1;
-      } else {
-        selected--;
-      }
-    }
-    
-    if (btnRightPressed) {
+    selected = (selected == 0) ? NUM_OPTIONS - 1 : selected - 1;
+  }
+
+  if (btnRightPressed) {
 #ifdef DEBUG_BUTTONS
-      Serial.println("[START] RIGHT - Navigate menu");
+    Serial.println("[START] RIGHT - Navigate menu");
 #endif
-      selected = (selected + 1) % NUM_OPTIONS;
-    }
-    
-    if (btnOkPressed) {
-      
-      if (selected == 1 && !hasSaveAvailable) {
+    selected = (selected + 1) % NUM_OPTIONS;
+  }
+
+  if (btnOkPressed) {
+    if (selected == 1 && !saveAvailable) {
 #ifdef DEBUG_BUTTONS
-        Serial.println("[START] OK - Cannot load (no save available)");
+      Serial.println("[START] OK - Cannot load (no save available)");
 #endif
-        continue;
-      }
-      
-      if (selected == 2) {
+    } else if (selected == 2) {
 #ifdef DEBUG_BUTTONS
-        Serial.println("[START] OK - Reset save");
+      Serial.println("[START] OK - Reset save");
 #endif
-        clearSave();
-        
-        tft.fillScreen(0x0000);
-        tft.setTextColor(0xFFFF);
-        tft.setTextSize(2);
-        tft.setCursor((TFT_WIDTH - 13 * 12) / 2, TFT_HEIGHT / 2);
-        tft.print("Save cleared!");
-        delay(1000);
-        
-        // Redraw title screen after reset
-        tft.fillScreen(0x0010);
-        tft.setTextColor(0xFFFF);
-        tft.setTextSize(3);
-        tft.setCursor((TFT_WIDTH - 18 * 10) / 2, 20);
-        tft.print("OzeanLive");
-        tft.setTextSize(2);
-        tft.setCursor((TFT_WIDTH - 11 * 12) / 2, 50);
-        tft.print("Tamagotchi");
-        
-        hasSaveAvailable = false;
-        selected = 0;
-        lastDrawn = 255; // Force redraw
-        continue;
-      }
-      
+      clearSave();
+
+      tft.fillScreen(0x0000);
+      tft.setTextColor(0xFFFF);
+      tft.setTextSize(2);
+      tft.setCursor((TFT_WIDTH - 13 * 12) / 2, TFT_HEIGHT / 2);
+      tft.print("Save cleared!");
+      clearedSinceMs = millis();
+      showingCleared = true;
+
+      saveAvailable = false;
+      selected = 0;
+      return START_PENDING;
+    } else {
 #ifdef DEBUG_BUTTONS
       Serial.print("[START] OK - Selected: ");
       Serial.println(selected == 0 ? "START NEW" : "LOAD");
 #endif
-      
-      // Wait for button release before returning
-      while (digitalRead(PIN_BTN_OK) == LOW)
-        ;
-      
+      // Gehaltenes OK nicht ins Spiel mitnehmen (kein Langdruck)
+      Buttons.consumeHeld();
       return (StartChoice)selected;
     }
   }
+
+  // Nur Zeilen, deren Darstellung sich geändert hat
+  for (uint8_t i = 0; i < NUM_OPTIONS; i++) {
+    uint8_t look = optionLook(i);
+    if (look != drawnLook[i]) drawOption(i, look);
+  }
+  return START_PENDING;
 }
@@ -3,9 +3,16 @@
 enum StartChoice {
   START_NEW,
   START_LOAD,
-  RESET_SAVE
+  RESET_SAVE,
+  START_PENDING   // noch keine Wahl, Menü bleibt offen
 };
 
-// Returns user's choice. Blocks until selection made.
+// Startbildschirm als Zustand im normalen Frame-Loop (blockiert nicht).
+// startMenuOpen() zeichnet Titel und Optionen einmal, startMenuUpdate()
+// einmal pro Frame: wertet die Tasten aus (Buttons.poll() macht loop()) und
+// zeichnet nur die Zeilen neu, deren Inhalt sich geändert hat.
 // hasSaveAvailable: if false, "Load" option is disabled/grayed out
-StartChoice runStartMenu(bool hasSaveAvailable);
+void startMenuOpen(bool hasSaveAvailable);
+
+// START_NEW / START_LOAD, sobald gewählt, sonst START_PENDING
+StartChoice startMenuUpdate();
@@ -0,0 +1,64 @@
+#include "text_atlas.h"
+#include "gfx.h"
+#include "sprite_common.h"
+
+static const char FIRST_GLYPH = 32;
+static const char LAST_GLYPH = 126;
+static const uint8_t GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+
+// Zeilenmasken: Bit i = Spalte i gesetzt
+static uint8_t glyphRows[GLYPH_COUNT][TEXT_CELL_H];
+
+// Aktuelles Feld für die Zeilenquelle (spiFlushRect kennt keinen Kontext)
+static const char* fieldText = nullptr;
+static int16_t fieldTextX = 0;
+static int16_t fieldTextY = 0;
+static uint16_t fieldFg = 0;  // Speicherformat (px565), wie der Staging-Puffer
+static uint16_t fieldBg = 0;
+
+void textAtlasInit() {
+  // Über die Library-Font rendern, damit die Pixel exakt tft.print() entsprechen
+  GFXcanvas16 cell(TEXT_CELL_W, TEXT_CELL_H);
+  for (uint8_t g = 0; g < GLYPH_COUNT; g++) {
+    cell.fillScreen(0x0000);
+    cell.drawChar(0, 0, (unsigned char)(FIRST_GLYPH + g), 0xFFFF, 0x0000, 1);
+    for (int16_t row = 0; row < TEXT_CELL_H; row++) {
+      uint8_t mask = 0;
+      for (int16_t col = 0; col < TEXT_CELL_W; col++) {
+        if (cell.getPixel(col, row)) mask |= (uint8_t)(1 << col);
+      }
+      glyphRows[g][row] = mask;
+    }
+  }
+}
+
+// SpiRowSource: eine Feldzeile aus Hintergrund und Glyphmasken
+static void textFieldRow(int16_t x, int16_t y, int16_t w, uint16_t* dst) {
+  for (int16_t i = 0; i < w; i++) dst[i] = fieldBg;
+
+  int16_t row = y - fieldTextY;
+  if (row < 0 || row >= TEXT_CELL_H) return;
+
+  int16_t cx = fieldTextX - x;
+  for (const char* p = fieldText; *p && cx < w; p++, cx += TEXT_CELL_W) {
+    if (cx + TEXT_CELL_W <= 0) continue;
+    char c = *p;
+    if (c < FIRST_GLYPH || c > LAST_GLYPH) continue;
+    uint8_t mask = glyphRows[c - FIRST_GLYPH][row];
+    for (int16_t col = 0; mask; col++, mask >>= 1) {
+      int16_t px = cx + col;
+      if ((mask & 1) && px >= 0 && px < w) dst[px] = fieldFg;
+    }
+  }
+}
+
+void textDrawField(int16_t x, int16_t y, int16_t w, int16_t h,
+                   const char* text, int16_t textX, int16_t textY,
+                   uint16_t fg, uint16_t bg) {
+  fieldText = text;
+  fieldTextX = textX;
+  fieldTextY = textY;
+  fieldFg = px565(fg);
+  fieldBg = px565(bg);
+  spiFlushRect(textFieldRow, x, y, w, h);
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino.h>
+
+// ---- Glyph-Atlas für UI-Text (5x7-Font, Größe 1) ----
+// Die Glyphen werden einmal über die Font-Routine der Grafik-Library in
+// einen kleinen Canvas gerendert und als Zeilenmasken im RAM abgelegt
+// (8 Zeilen à 6 Bit pro Zeichen). Ein Textfeld wird danach zeilenweise in
+// den SPI-Staging-Puffer komponiert – Hintergrund und Schrift in einem
+// Address-Window, statt fillRect plus ein Window pro gesetztem Pixel.
+// Status-Bar und Menüs aktualisieren damit nur die Felder, die sich
+// geändert haben (eine 3-stellige Zahl: 18x8 px, ~300 Bytes SPI).
+
+constexpr int16_t TEXT_CELL_W = 6;
+constexpr int16_t TEXT_CELL_H = 8;
+
+// Einmal nach initDisplay()
+void textAtlasInit();
+
+// Rechteck (x,y,w,h) mit bg füllen und text ab (textX,textY) in fg
+// hineinsetzen (Bildschirmkoordinaten, am Feldrand abgeschnitten).
+// Ein Address-Window, Schrift pixelgleich zu tft.print() mit Textgröße 1.
+void textDrawField(int16_t x, int16_t y, int16_t w, int16_t h,
+                   const char* text, int16_t textX, int16_t textY,
+                   uint16_t fg, uint16_t bg);
@@ -0,0 +1,45 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// ---- Lock-freier Dreifachpuffer (ein Schreiber, ein Leser) ----
+// Der Schreiber füllt writeBuffer() und gibt ihn mit publish() ab, der Leser
+// holt sich mit update() den neuesten veröffentlichten Puffer. Keiner wartet
+// auf den anderen: ein Puffer gehört dem Schreiber, einer dem Leser, der
+// dritte liegt in der Mitte. Veröffentlicht der Schreiber zweimal, bevor der
+// Leser abholt, wird der ältere Stand überschrieben (immer der neueste).
+// Nur Standard-C++ (std::atomic), läuft auf ESP32, Teensy und dem Host.
+
+template <typename T>
+class TripleBuffer {
+public:
+  // Schreiber: Puffer für den nächsten Stand
+  T& writeBuffer() { return bufs[writeIdx]; }
+
+  // Schreiber: writeBuffer() veröffentlichen und den Mittelpuffer übernehmen
+  void publish() {
+    uint8_t prev = middle.exchange(writeIdx | FRESH, std::memory_order_acq_rel);
+    writeIdx = prev & INDEX_MASK;
+  }
+
+  // Leser: neuesten Stand übernehmen. false = seit dem letzten Aufruf nichts
+  // Neues, readBuffer() bleibt, wie er war.
+  bool update() {
+    if (!(middle.load(std::memory_order_acquire) & FRESH)) return false;
+    uint8_t prev = middle.exchange(readIdx, std::memory_order_acq_rel);
+    readIdx = prev & INDEX_MASK;
+    return true;
+  }
+
+  // Leser: aktueller Stand (gültig bis zum nächsten update())
+  const T& readBuffer() const { return bufs[readIdx]; }
+
+private:
+  static constexpr uint8_t INDEX_MASK = 0x03;
+  static constexpr uint8_t FRESH = 0x04;   // Mittelpuffer noch nicht abgeholt
+
+  T bufs[3] = {};
+  uint8_t writeIdx = 0;                    // nur Schreiber
+  uint8_t readIdx = 1;                     // nur Leser
+  std::atomic<uint8_t> middle{2};
+};